@@ -12,11 +12,12 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "precomp_headers.hpp"
 
-#include <fstream>
+#include <cstdio>
+#include <cstring>
+#include <openssl/evp.h>
 
 #include "TglFile.hpp"
 #include "TglUtils.hpp"
-#include "AES.h"
 #include "stwtypes.hpp"
 #include "stwerrors.hpp"
 #include "C_OscUtils.hpp"
@@ -35,6 +36,7 @@ using namespace stw::opensyde_core;
 using namespace std;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32_t C_OscAesFile::mhu32_CHUNK_SIZE = 65536U;
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
@@ -51,14 +53,14 @@ using namespace std;
 
    Create AES encrypted file using ECB mode.
    As the algorithm only can work with blocks of 16 bytes. So we apply PKCS#7 algorithm to fill up.
-   The library we use supports padding, but only with zeros, not with PKCS#7.
 
    Steps:
    * create an MD5 hash over the passed key to use as an 128bit AES encryption key
-   * load input file to RAM
-   * append values for PKCS#7 algorithm
-   * perform encryption in RAM (so not suitable for very large files)
-   * write resulting output file
+   * read input file in chunks of fixed size
+   * encrypt each chunk and write it to the output file
+   * append the last block including the PKCS#7 values
+
+   So the memory consumption does not depend on the file size.
 
    If the output file already exists the function will overwrite it.
 
@@ -77,106 +79,7 @@ int32_t C_OscAesFile::h_EncryptFile(const C_SclString & orc_Key, const C_SclStri
                                     const C_SclString & orc_OutFilePath)
 
 {
-   int32_t s32_Return = C_NO_ERR;
-
-   //lint -e{9176} //no problems as long as charn has the same size as uint8; if not we'd be in deep !"=?& anyway
-   const C_SclString c_AesKey = stw::md5::C_Md5Checksum::GetMD5(
-      reinterpret_cast<const uint8_t *>(orc_Key.c_str()), orc_Key.Length());
-
-   tgl_assert(c_AesKey.Length() == 32); //really should be 16 bytes, resp. 32 hex characters
-
-   //check whether input file exists:
-   if (TglFileExists(orc_InFilePath) == false)
-   {
-      s32_Return = C_RD_WR;
-   }
-   else
-   {
-      //load data from input file:
-      vector<uint8_t> c_InputData;
-      std::ifstream c_InputFileStream;
-      const uint32_t u32_InputFileSize = static_cast<uint32_t>(TglFileSize(orc_InFilePath));
-      const uint8_t u8_Pkcs7Size = static_cast<uint8_t>(16U - (u32_InputFileSize % 16U));
-
-      c_InputData.resize(static_cast<size_t>(u32_InputFileSize) + u8_Pkcs7Size);
-
-      c_InputFileStream.open(orc_InFilePath.c_str(), std::ifstream::binary);
-
-      if (c_InputFileStream.is_open() == false)
-      {
-         s32_Return = C_RD_WR;
-      }
-      else
-      {
-         //read file content
-         bool q_HasFailed;
-         //lint -e{9176} //no problems as long as charn has the same size as uint8; if not we'd be in deep !"=?& anyway
-         c_InputFileStream.read(reinterpret_cast<char_t *>(&c_InputData[0]), u32_InputFileSize);
-         //check for error
-         q_HasFailed = c_InputFileStream.fail();
-         //close file
-         c_InputFileStream.close();
-
-         if (q_HasFailed == true)
-         {
-            s32_Return = C_RD_WR;
-         }
-         else
-         {
-            //do the encryption:
-            uint8_t au8_Key[16];
-            uint8_t * pu8_EncryptedData;
-            unsigned int x_EncryptedSize; //lint !e8080 !e970  //using type to match library interface
-            std::ofstream c_OutputFileStream;
-            AES c_Aes(128);
-
-            //add PKCS#7 values:
-            for (uint8_t u8_ByteIndex = 0U; u8_ByteIndex < u8_Pkcs7Size; u8_ByteIndex++)
-            {
-               c_InputData[static_cast<size_t>(u32_InputFileSize) + u8_ByteIndex] = u8_Pkcs7Size;
-            }
-
-            //convert key from string to array:
-            for (uint8_t u8_Index = 0U; u8_Index < 16U; u8_Index++)
-            {
-               const C_SclString c_Text = "0x" + c_AesKey.SubString((static_cast<uint32_t>(u8_Index) * 2U) + 1U, 2U);
-               au8_Key[u8_Index] = static_cast<uint8_t>(c_Text.ToInt());
-            }
-
-            pu8_EncryptedData = c_Aes.EncryptECB(
-               &c_InputData[0],
-               static_cast<unsigned int>(c_InputData.size()), //lint !e970  //using type to match library interface
-               &au8_Key[0],
-               x_EncryptedSize);
-            //we added the padding manually: no magic expected here ...
-            tgl_assert(x_EncryptedSize == c_InputData.size());
-
-            //save to output file:
-            c_OutputFileStream.open(orc_OutFilePath.c_str(), std::ofstream::binary | std::ofstream::trunc);
-            if (c_OutputFileStream.is_open())
-            {
-               //lint -e{9176} //no problems as long as charn has the same size as uint8; if not we'd be in deep !"=?&
-               // anyway
-               c_OutputFileStream.write(reinterpret_cast<const char_t *>(pu8_EncryptedData), x_EncryptedSize);
-               q_HasFailed = c_OutputFileStream.fail();
-               c_OutputFileStream.close();
-               if (q_HasFailed == true)
-               {
-                  s32_Return = C_NOACT;
-               }
-            }
-            else
-            {
-               s32_Return = C_NOACT;
-            }
-
-            //clean up memory allocated by AES library:
-            delete[] pu8_EncryptedData;
-         }
-      }
-   }
-
-   return s32_Return;
+   return mh_CryptFile(orc_Key, orc_InFilePath, orc_OutFilePath, true);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -184,12 +87,14 @@ int32_t C_OscAesFile::h_EncryptFile(const C_SclString & orc_Key, const C_SclStri
 
    Steps:
    * create an MD5 hash over the passed key to use as an 128bit AES encryption key
-   * load input file
-   * perform decryption in RAM (so not suitable for very large files)
-   * size decrypted data according to PKCS#7 algorithm
-   * write resulting output file
+   * read input file in chunks of fixed size
+   * decrypt each chunk and write it to the output file
+   * check and remove the PKCS#7 values of the last block
+
+   So the memory consumption does not depend on the file size.
 
    If the output file already exists the function will overwrite it.
+   If the PKCS#7 check fails the output file is removed again.
 
    The size of the file must be a multiple of 16bytes.
    The file must have been written with PKCS#7 algorithm.
@@ -203,7 +108,7 @@ int32_t C_OscAesFile::h_EncryptFile(const C_SclString & orc_Key, const C_SclStri
    C_NO_ERR    success
    C_RD_WR     input file does not exist or could not be loaded
    C_CONFIG    input file size is not a multiple of 16
-   C_CHECKSUM  input file is invalid; PKCS#7 value is > 16 or > file size (checked after decryption)
+   C_CHECKSUM  input file is invalid; PKCS#7 values are not consistent (checked after decryption)
    C_NOACT     output file could not be written
 */
 //----------------------------------------------------------------------------------------------------------------------
@@ -213,109 +118,19 @@ int32_t C_OscAesFile::h_DecryptFile(const C_SclString & orc_Key, const C_SclStri
 {
    int32_t s32_Return = C_NO_ERR;
 
-   //lint -e{9176} //no problems as long as charn has the same size as uint8; if not we'd be in deep !"=?& anyway
-   const C_SclString c_AesKey = stw::md5::C_Md5Checksum::GetMD5(
-      reinterpret_cast<const uint8_t *>(orc_Key.c_str()), orc_Key.Length());
-
-   tgl_assert(c_AesKey.Length() == 32); //really should be 16 bytes, resp. 32 hex characters
-
    //check whether input file exists:
    if (TglFileExists(orc_InFilePath) == false)
    {
       s32_Return = C_RD_WR;
    }
+   //is the file correctly padded ?
+   else if ((static_cast<uint32_t>(TglFileSize(orc_InFilePath)) % 16U) != 0U)
+   {
+      s32_Return = C_CONFIG;
+   }
    else
    {
-      //load data from input file:
-      vector<uint8_t> c_InputData;
-      std::ifstream c_InputFileStream;
-      const uint32_t u32_InputFileSize = TglFileSize(orc_InFilePath);
-
-      //is the file correctly padded ?
-      if ((u32_InputFileSize % 16U) != 0U)
-      {
-         s32_Return = C_CONFIG;
-      }
-      else
-      {
-         c_InputData.resize(TglFileSize(orc_InFilePath));
-
-         c_InputFileStream.open(orc_InFilePath.c_str(), std::ifstream::binary);
-
-         if (c_InputFileStream.is_open() == false)
-         {
-            s32_Return = C_RD_WR;
-         }
-         else
-         {
-            //read file content
-            bool q_HasFailed;
-            //lint -e{9176} //no problems as long as charn has the same size as uint8; if not we'd be in deep !"=?&
-            // anyway
-            c_InputFileStream.read(reinterpret_cast<char_t *>(&c_InputData[0]), c_InputData.size());
-            //check for error
-            q_HasFailed = c_InputFileStream.fail();
-            //close file
-            c_InputFileStream.close();
-
-            if (q_HasFailed == true)
-            {
-               s32_Return = C_RD_WR;
-            }
-            else
-            {
-               //do the decryption:
-               uint8_t au8_Key[16];
-               uint8_t * pu8_DecryptedData;
-               std::ofstream c_OutputFileStream;
-               uint8_t u8_Pkcs7Value;
-               AES c_Aes(128);
-               //using type to match library interface
-               const unsigned int x_InputSize = static_cast<unsigned int>(c_InputData.size()); //lint  !e8080 !e970
-
-               //convert key from string to array:
-               for (uint8_t u8_Index = 0U; u8_Index < 16U; u8_Index++)
-               {
-                  const C_SclString c_Text = "0x" + c_AesKey.SubString((static_cast<uint32_t>(u8_Index) * 2U) + 1U, 2U);
-                  au8_Key[u8_Index] = static_cast<uint8_t>(c_Text.ToInt());
-               }
-
-               pu8_DecryptedData = c_Aes.DecryptECB(&c_InputData[0], x_InputSize, &au8_Key[0]);
-               //remove padding:
-               u8_Pkcs7Value = pu8_DecryptedData[c_InputData.size() - 1];
-               if ((u8_Pkcs7Value > 16) || (u8_Pkcs7Value > c_InputData.size()))
-               {
-                  //this is unexpected; possible reasons: incorrect key; not a file encrypted with AES + PKCS#7
-                  s32_Return = C_CHECKSUM;
-               }
-               else
-               {
-                  //save to output file:
-                  c_OutputFileStream.open(orc_OutFilePath.c_str(), std::ofstream::binary | std::ofstream::trunc);
-                  if (c_OutputFileStream.is_open())
-                  {
-                     //write without the PKCS#7 bytes:
-                     //lint -e{9176} //no problems as long as charn has the same size as uint8; if not we'd be in deep
-                     // !"=?& anyway
-                     c_OutputFileStream.write(reinterpret_cast<const char_t *>(pu8_DecryptedData),
-                                              static_cast<streamsize>(c_InputData.size()) - u8_Pkcs7Value);
-                     q_HasFailed = c_OutputFileStream.fail();
-                     c_OutputFileStream.close();
-                     if (q_HasFailed == true)
-                     {
-                        s32_Return = C_NOACT;
-                     }
-                  }
-                  else
-                  {
-                     s32_Return = C_NOACT;
-                  }
-               }
-               //clean up memory allocated by AES library:
-               delete[] pu8_DecryptedData;
-            }
-         }
-      }
+      s32_Return = mh_CryptFile(orc_Key, orc_InFilePath, orc_OutFilePath, false);
    }
 
    return s32_Return;
@@ -485,3 +300,156 @@ int32_t C_OscAesFile::h_UnpackEncryptedZipFile(const C_SclString & orc_PathOfZip
 
    return s32_Return;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Encrypt or decrypt file in chunks
+
+   Uses AES-128 in ECB mode with PKCS#7 padding via the OpenSSL EVP interface
+   (which uses hardware acceleration where available).
+   Input is read and output is written in chunks of mhu32_CHUNK_SIZE bytes.
+   If the operation fails after the output file was created the output file is removed again.
+
+   \param[in]  orc_Key           Key; a MD5 hash over this key will be used as 128bit AES key
+   \param[in]  orc_InFilePath    Path to input file
+   \param[in]  orc_OutFilePath   Path to resulting output file
+   \param[in]  oq_Encrypt        true: encrypt; false: decrypt
+
+   \return
+   C_NO_ERR    success
+   C_RD_WR     input file does not exist or could not be loaded
+   C_CHECKSUM  decryption: PKCS#7 values are not consistent
+   C_NOACT     output file could not be written
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscAesFile::mh_CryptFile(const C_SclString & orc_Key, const C_SclString & orc_InFilePath,
+                                   const C_SclString & orc_OutFilePath, const bool oq_Encrypt)
+{
+   int32_t s32_Return = C_NO_ERR;
+   std::FILE * pc_InFile = NULL;
+   std::FILE * pc_OutFile = NULL;
+
+   //lint -e{9176} //no problems as long as charn has the same size as uint8; if not we'd be in deep !"=?& anyway
+   const C_SclString c_AesKey = stw::md5::C_Md5Checksum::GetMD5(
+      reinterpret_cast<const uint8_t *>(orc_Key.c_str()), orc_Key.Length());
+
+   tgl_assert(c_AesKey.Length() == 32); //really should be 16 bytes, resp. 32 hex characters
+
+   //check whether input file exists:
+   if (TglFileExists(orc_InFilePath) == false)
+   {
+      s32_Return = C_RD_WR;
+   }
+   else
+   {
+      pc_InFile = std::fopen(orc_InFilePath.c_str(), "rb");
+      if (pc_InFile == NULL)
+      {
+         s32_Return = C_RD_WR;
+      }
+   }
+
+   if (s32_Return == C_NO_ERR)
+   {
+      pc_OutFile = std::fopen(orc_OutFilePath.c_str(), "wb");
+      if (pc_OutFile == NULL)
+      {
+         s32_Return = C_NOACT;
+      }
+   }
+
+   if (s32_Return == C_NO_ERR)
+   {
+      uint8_t au8_Key[16];
+      EVP_CIPHER_CTX * const pc_Context = EVP_CIPHER_CTX_new();
+      //output of one update can be up to one block larger than the input
+      std::vector<uint8_t> c_InputData(mhu32_CHUNK_SIZE);
+      std::vector<uint8_t> c_OutputData(static_cast<size_t>(mhu32_CHUNK_SIZE) + 16U);
+      int x_OutputSize = 0; //lint !e8080 !e970  //using type to match library interface
+
+      //convert key from string to array:
+      for (uint8_t u8_Index = 0U; u8_Index < 16U; u8_Index++)
+      {
+         const C_SclString c_Text = "0x" + c_AesKey.SubString((static_cast<uint32_t>(u8_Index) * 2U) + 1U, 2U);
+         au8_Key[u8_Index] = static_cast<uint8_t>(c_Text.ToInt());
+      }
+
+      //PKCS#7 padding is enabled by default
+      if ((pc_Context == NULL) ||
+          (EVP_CipherInit_ex(pc_Context, EVP_aes_128_ecb(), NULL, &au8_Key[0], NULL, (oq_Encrypt ? 1 : 0)) != 1))
+      {
+         s32_Return = C_NOACT;
+      }
+
+      while (s32_Return == C_NO_ERR)
+      {
+         //lint -e{8080} //using type expected by the library for compatibility
+         const size_t x_NumRead = std::fread(&c_InputData[0], 1U, c_InputData.size(), pc_InFile);
+         if (x_NumRead == 0U)
+         {
+            if (std::ferror(pc_InFile) != 0)
+            {
+               s32_Return = C_RD_WR;
+            }
+            break;
+         }
+         if (EVP_CipherUpdate(pc_Context, &c_OutputData[0], &x_OutputSize, &c_InputData[0],
+                              static_cast<int>(x_NumRead)) != 1) //lint !e970  //using type to match library interface
+         {
+            s32_Return = C_NOACT;
+         }
+         else if ((x_OutputSize > 0) &&
+                  (std::fwrite(&c_OutputData[0], 1U, static_cast<size_t>(x_OutputSize), pc_OutFile) !=
+                   static_cast<size_t>(x_OutputSize)))
+         {
+            s32_Return = C_NOACT;
+         }
+         else
+         {
+            //next chunk
+         }
+      }
+
+      if (s32_Return == C_NO_ERR)
+      {
+         //last block: add resp. check and remove PKCS#7 values
+         if (EVP_CipherFinal_ex(pc_Context, &c_OutputData[0], &x_OutputSize) != 1)
+         {
+            //decryption: possible reasons: incorrect key; not a file encrypted with AES + PKCS#7
+            s32_Return = (oq_Encrypt == true) ? C_NOACT : C_CHECKSUM;
+         }
+         else if ((x_OutputSize > 0) &&
+                  (std::fwrite(&c_OutputData[0], 1U, static_cast<size_t>(x_OutputSize), pc_OutFile) !=
+                   static_cast<size_t>(x_OutputSize)))
+         {
+            s32_Return = C_NOACT;
+         }
+         else
+         {
+            //finished
+         }
+      }
+
+      //do not leave the key in memory:
+      (void)std::memset(&au8_Key[0], 0, sizeof(au8_Key));
+      EVP_CIPHER_CTX_free(pc_Context);
+   }
+
+   if (pc_InFile != NULL)
+   {
+      (void)std::fclose(pc_InFile);
+   }
+   if (pc_OutFile != NULL)
+   {
+      if ((std::fclose(pc_OutFile) != 0) && (s32_Return == C_NO_ERR))
+      {
+         s32_Return = C_NOACT;
+      }
+      if (s32_Return != C_NO_ERR)
+      {
+         //do not leave incomplete data behind
+         (void)std::remove(orc_OutFilePath.c_str());
+      }
+   }
+
+   return s32_Return;
+}
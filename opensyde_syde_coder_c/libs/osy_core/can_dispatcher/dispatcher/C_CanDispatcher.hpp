@@ -15,7 +15,8 @@
 #define CCANDISPATCHERHPP
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
-#include <deque>
+#include <atomic>
+#include <vector>
 #include "stwtypes.hpp"
 #include "C_CanBase.hpp"
 #include "TglTasks.hpp"
@@ -28,30 +29,56 @@ namespace can
 {
 /* -- Defines ------------------------------------------------------------------------------------------------------- */
 const uint32_t mu32_CAN_QUEUE_DEFAULT_MAX_SIZE = 2048U;
+const uint32_t mu32_CAN_DISPATCH_BATCH_SIZE = 32U; ///< maximum number of messages read from driver in one go
+const uint32_t mu32_CAN_QUEUE_CACHE_LINE_SIZE = 64U; ///< used to keep producer and consumer data apart
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
-///We wrap up a deque in order to provide thread safety.
-//Also we limit the maximum size, to make sure we don't waste all of the heap if nobody clears the RX queue.
+///Fixed capacity single-producer/single-consumer ring buffer for received messages.
+//Push and Pop are wait-free and can be called concurrently from one producer and one consumer thread.
+//The buffer is allocated once by SetMaxSize so no allocations are done while receiving.
+//We limit the maximum size, to make sure we don't waste all of the heap if nobody clears the RX queue.
 class C_CanRxQueue
 {
 private:
-   std::deque<T_STWCAN_Msg_RX> mc_Messages;
+   //this class can not be copied:
+   C_CanRxQueue(const C_CanRxQueue & orc_Source);
+   C_CanRxQueue & operator = (const C_CanRxQueue & orc_Source);
+
+   std::vector<T_STWCAN_Msg_RX> mc_Messages; ///< ring storage; size is a power of two
+   uint32_t mu32_IndexMask;
    uint32_t mu32_MaxSize;
-   int32_t ms32_Status;
+   uint8_t mau8_PaddingShared[mu32_CAN_QUEUE_CACHE_LINE_SIZE];
+
+   //producer side
+   std::atomic<uint32_t> mc_WriteIndex;
+   uint32_t mu32_ProducerCachedReadIndex;
+   std::atomic<uint32_t> mc_NumOverflows;
+   std::atomic<int32_t> mc_Status;
+   uint8_t mau8_PaddingProducer[mu32_CAN_QUEUE_CACHE_LINE_SIZE];
+
+   //consumer side
+   std::atomic<uint32_t> mc_ReadIndex;
+   uint32_t mu32_ConsumerCachedWriteIndex;
+   uint8_t mau8_PaddingConsumer[mu32_CAN_QUEUE_CACHE_LINE_SIZE];
 
 public:
    C_CanRxQueue(void);
 
+   //producer side:
    int32_t Push(const T_STWCAN_Msg_RX & orc_Message);
+
+   //consumer side:
    int32_t Pop(T_STWCAN_Msg_RX & orc_Message);
+   uint32_t PopMany(T_STWCAN_Msg_RX * const opc_Messages, const uint32_t ou32_MaxMessages);
+   void Clear(void);
+   int32_t GetStatus(void);
 
+   //not thread safe; only to be called while no producer or consumer is active:
    void SetMaxSize(const uint32_t ou32_MaxSize);
-   uint32_t GetMaxSize(void) const;
 
+   uint32_t GetMaxSize(void) const;
    uint32_t GetSize(void) const;
-   void Clear(void);
-
-   int32_t GetStatus(void);
+   uint32_t GetOverflowCount(void) const;
 };
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -80,22 +107,46 @@ public:
 ///Information about one registered dispatch client
 class C_CanDispatchClient
 {
+private:
+   //this class can not be copied (queue is shared between producer and consumer thread):
+   C_CanDispatchClient(const C_CanDispatchClient & orc_Source);
+   C_CanDispatchClient & operator = (const C_CanDispatchClient & orc_Source);
+
 public:
+   C_CanDispatchClient(void);
+
    C_CanRxQueue c_RXQueue;
    C_CanRxFilter c_RXFilter;
    uint16_t u16_Handle; //for resyncing with pointer list
 };
 
+//----------------------------------------------------------------------------------------------------------------------
+///Mapping of handles to registered clients; never modified after it was published
+class C_CanDispatchClientTable
+{
+public:
+   stw::scl::C_SclDynamicArray<C_CanDispatchClient *> c_ClientsByHandle;
+};
+
 //----------------------------------------------------------------------------------------------------------------------
 ///Extends C_CAN_Base by queuing and filtering mechanisms
 class C_CanDispatcher :
    public C_CanBase
 {
 private:
-   stw::scl::C_SclDynamicArray<C_CanDispatchClient *> mc_ClientsByHandle;
-   stw::scl::C_SclDynamicArray<C_CanDispatchClient> mc_InstalledClients;
+   //current handle mapping; replaced as a whole on each change so readers can use it without locking
+   std::atomic<const C_CanDispatchClientTable *> mpc_ClientsByHandle;
+   //all published mappings not freed yet; readers might still use an older one
+   stw::scl::C_SclDynamicArray<C_CanDispatchClientTable *> mc_ClientTables;
+   //number of m_GetClient calls currently looking at a mapping; older mappings are freed when there are none
+   mutable std::atomic<uint32_t> mu32_NumTableReaders;
+   //clients are allocated individually so their queues stay in place while other clients are added or removed
+   stw::scl::C_SclDynamicArray<C_CanDispatchClient *> mc_InstalledClients;
 
    void m_ResyncShortcutPointers(void);
+   void m_DeleteClientTables(void);
+   void m_DeleteSupersededClientTables(void);
+   C_CanDispatchClient * m_GetClient(const uint16_t ou16_Handle) const;
 
    stw::tgl::C_TglCriticalSection mc_CriticalSection;
 
@@ -116,6 +167,11 @@ protected:
    //-----------------------------------------------------------------------------
    virtual int32_t m_CAN_Read_Msg(T_STWCAN_Msg_RX & orc_Message) = 0;
 
+   virtual int32_t m_CAN_Read_Msgs(T_STWCAN_Msg_RX * const opc_Messages, const uint32_t ou32_MaxMessages,
+                                   uint32_t & oru32_NumRead);
+
+   virtual int32_t m_CAN_WaitForRx(const uint32_t ou32_TimeoutMs);
+
 public:
    C_CanDispatcher(void);
    C_CanDispatcher(const uint8_t ou8_CommChannel);
@@ -128,7 +184,11 @@ public:
    int32_t SetRXFilter(const uint16_t ou16_Handle, const C_CanRxFilter & orc_RXFilter);
 
    int32_t ReadFromQueue(const uint16_t ou16_Handle, T_STWCAN_Msg_RX & orc_Message);
+   int32_t ReadFromQueue(const uint16_t ou16_Handle, T_STWCAN_Msg_RX * const opc_Messages,
+                         const uint32_t ou32_MaxMessages, uint32_t & oru32_NumRead);
    int32_t ClearQueue(const uint16_t ou16_Handle);
+   int32_t GetQueueStatus(const uint16_t ou16_Handle, uint32_t & oru32_NumOverflows);
+   int32_t WaitForIncoming(const uint16_t ou16_Handle, const uint32_t ou32_TimeoutMs);
 
    //we hide the base class function on purpose here
    int32_t CAN_Read_Msg(const uint16_t ou16_Handle, T_STWCAN_Msg_RX & orc_Message); //lint !e1411
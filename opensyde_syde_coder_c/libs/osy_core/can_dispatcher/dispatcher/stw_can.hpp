@@ -39,8 +39,36 @@ struct STW_CAN_EXTMSG
    uint8_t msg[8];  ///< message data
 };
 
+const uint8_t STWCAN_CLASSIC_MAX_DLC = 8U; ///< maximum number of data bytes of a classic CAN frame
+const uint8_t STWCAN_FD_MAX_DLC = 64U;     ///< maximum number of data bytes of a CAN FD frame
+
 ///11bit or 29bit CAN message structure for received messages
 struct T_STWCAN_Msg_RX
+{
+   uint32_t u32_ID;        ///< CAN message ID
+   uint8_t u8_XTD;         ///< 0 -> 11bit ID; 1 -> 29bit ID
+   uint8_t u8_DLC;         ///< number of data bytes (0..8; CAN FD: 0..8,12,16,20,24,32,48,64)
+   uint8_t u8_RTR;         ///< 0 -> regular frame; 1 -> remote frame
+   uint8_t u8_FDF = 0U;    ///< 0 -> classic CAN frame; 1 -> CAN FD frame
+   uint8_t au8_Data[STWCAN_FD_MAX_DLC]; ///< message data
+   uint64_t u64_TimeStamp; ///< message reception time in micro-seconds since system start; 0 -> not available
+};
+
+///11bit or 29bit CAN message structure for sending messages
+struct T_STWCAN_Msg_TX
+{
+   uint32_t u32_ID;     ///< CAN message ID
+   uint8_t u8_XTD;      ///< 0 -> 11bit ID; 1 -> 29bit ID
+   uint8_t u8_DLC;      ///< number of data bytes (0..8; CAN FD: 0..8,12,16,20,24,32,48,64)
+   uint8_t u8_RTR;      ///< 0 -> regular frame; 1 -> remote frame
+   uint8_t u8_FDF = 0U; ///< 0 -> classic CAN frame; 1 -> CAN FD frame
+   uint8_t au8_Data[STWCAN_FD_MAX_DLC]; ///< message data
+};
+
+//binary layout of the message structures as used by the STW CAN DLL interface (classic CAN only)
+//use old prefixes to stay compatible with existing DLLs:
+///11bit or 29bit classic CAN message structure for received messages (DLL interface)
+struct T_STWCAN_ClassicMsg_RX
 {
    uint32_t u32_ID;        ///< CAN message ID
    uint8_t u8_XTD;         ///< 0 -> 11bit ID; 1 -> 29bit ID
@@ -51,8 +79,8 @@ struct T_STWCAN_Msg_RX
    uint64_t u64_TimeStamp; ///< message reception time in micro-seconds since system start; 0 -> not available
 };
 
-///11bit or 29bit CAN message structure for sending messages
-struct T_STWCAN_Msg_TX
+///11bit or 29bit classic CAN message structure for sending messages (DLL interface)
+struct T_STWCAN_ClassicMsg_TX
 {
    uint32_t u32_ID;     ///< CAN message ID
    uint8_t u8_XTD;      ///< 0 -> 11bit ID; 1 -> 29bit ID
@@ -23,7 +23,10 @@
 #include <net/if.h>
 #include <linux/can.h>
 #include <linux/can/raw.h>
+#include <linux/errqueue.h>
+#include <linux/net_tstamp.h>
 #include <poll.h>
+#include <time.h>
 
 #include "stwerrors.hpp"
 #include "stwtypes.hpp"
@@ -39,20 +42,109 @@ using namespace stw::can;
 using namespace stw::tgl;
 
 /* -- Defines ------------------------------------------------------------------------------------------------------- */
+//space for one SCM_TIMESTAMPING control message per received frame
+#define CAN_CMSG_BUFFER_SIZE (CMSG_SPACE(sizeof(struct scm_timestamping)))
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
 /* -- Global Variables ---------------------------------------------------------------------------------------------- */
 
 /* -- Function Prototypes ------------------------------------------------------------------------------------------- */
+static int32_t m_FillFrame(const T_STWCAN_Msg_TX & orc_Message, const bool oq_FdAvailable,
+                           struct canfd_frame & orc_Frame, size_t & orc_FrameSize);
+static uint64_t m_TimeSpecToUs(const struct timespec & orc_Time);
 
 /* -- Implementation ------------------------------------------------------------------------------------------------ */
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Convert STW CAN message to SocketCAN frame
+
+   Classic CAN messages are placed in the can_frame compatible part of the canfd_frame.
+   CAN FD messages are sent with bit rate switching.
+   Unused data bytes are set to zero, so CAN FD frames with a length that can not be represented by a CAN FD DLC are
+   padded with zeroes by the CAN driver.
+
+   \param[in]   orc_Message      message to convert
+   \param[in]   oq_FdAvailable   true: socket is configured for CAN FD frames
+   \param[out]  orc_Frame        SocketCAN frame
+   \param[out]  orc_FrameSize    number of bytes to send (CAN_MTU or CANFD_MTU)
+
+   \return
+   C_NO_ERR   frame filled
+   C_RANGE    invalid length; or CAN FD message but socket not configured for CAN FD
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static int32_t m_FillFrame(const T_STWCAN_Msg_TX & orc_Message, const bool oq_FdAvailable,
+                           struct canfd_frame & orc_Frame, size_t & orc_FrameSize)
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   (void)memset(&orc_Frame, 0, sizeof(orc_Frame));
+   orc_Frame.can_id =  CAN_ERR_MASK & orc_Message.u32_ID;
+   if (orc_Message.u8_XTD != 0)
+   {
+      orc_Frame.can_id |= CAN_EFF_FLAG;
+   }
+   if (orc_Message.u8_FDF != 0)
+   {
+      if ((oq_FdAvailable == false) || (orc_Message.u8_DLC > STWCAN_FD_MAX_DLC) || (orc_Message.u8_RTR != 0))
+      {
+         s32_Return = C_RANGE;
+      }
+      else
+      {
+         orc_Frame.flags = CANFD_BRS;
+#ifdef CANFD_FDF
+         orc_Frame.flags |= CANFD_FDF;
+#endif
+         orc_FrameSize = CANFD_MTU;
+      }
+   }
+   else
+   {
+      if (orc_Message.u8_DLC > STWCAN_CLASSIC_MAX_DLC)
+      {
+         s32_Return = C_RANGE;
+      }
+      else
+      {
+         if (orc_Message.u8_RTR != 0)
+         {
+            orc_Frame.can_id |= CAN_RTR_FLAG;
+         }
+         orc_FrameSize = CAN_MTU;
+      }
+   }
+   if (s32_Return == C_NO_ERR)
+   {
+      //classic CAN: data length code; CAN FD: payload length
+      orc_Frame.len = orc_Message.u8_DLC;
+      (void)memcpy(&orc_Frame.data[0], &orc_Message.au8_Data[0], orc_Message.u8_DLC);
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Convert timespec to micro seconds
+
+   \param[in]   orc_Time   time to convert
+
+   \return
+   time in micro seconds
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static uint64_t m_TimeSpecToUs(const struct timespec & orc_Time)
+{
+   return ((uint64_t)orc_Time.tv_sec * 1000000) + ((orc_Time.tv_nsec + 500) / 1000);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_Can::m_InitClass(const uint8_t ou8_CommChannel)
 {
    ms32_Socket = -1;
+   me_TimeStampMode = eTIME_STAMP_SYSTEM;
+   mq_FdModeRequested = false;
    ms32_RxTimeout = 0;
    mu32_RXID = CAN_RX_ID_INVALID;
    mc_CanIfName.PrintFormatted("can%u", (unsigned int)ou8_CommChannel);
@@ -95,6 +187,8 @@ int32_t C_Can::CAN_Exit(void)
    {
       // close previously initialized socket
       (void) close(ms32_Socket);
+      ms32_Socket = -1;
+      mq_FDAvailable = false;
    }
    else
    {
@@ -202,6 +296,13 @@ int32_t C_Can::CAN_Init(const C_SclString & orc_InterfaceName, const int32_t os3
             }
             ms32_RxTimeout = os32_RxTimeout;
             mc_CanIfName = orc_InterfaceName;
+            if (ms32_Socket >= 0)
+            {
+               //if the kernel does not support the requested time stamping we fall back to system time stamps
+               (void)m_ConfigureTimeStamping();
+               //if the interface is not configured for CAN FD we fall back to classic CAN
+               (void)m_ConfigureFdMode();
+            }
             // TODO: Use SetCommChannel to set cahnnel nmber in CanBase class
          }
          else
@@ -250,59 +351,169 @@ int32_t C_Can::CAN_Send_Msg(const T_STWCAN_Msg_TX & orc_Message)
 {
    int32_t s32_Error;
    int32_t s32_Ret;
+   struct canfd_frame t_Frame;
+   size_t un_FrameSize = CAN_MTU;
 
    if (this->ms32_Socket >= 0)
    {
-      struct pollfd t_PollFd;
-      struct can_frame t_Frame;
+      s32_Error = m_FillFrame(orc_Message, mq_FDAvailable, t_Frame, un_FrameSize);
+   }
+   else
+   {
+      s32_Error = C_CONFIG;
+   }
 
-      // prepare CAN frame
-      t_Frame.can_id =  CAN_ERR_MASK & orc_Message.u32_ID;
-      if (orc_Message.u8_XTD != 0)
+   if (s32_Error == C_NO_ERR)
+   {
+      // try to send right away; only wait for the socket if the TX queue is full
+      s32_Ret = send(this->ms32_Socket, &t_Frame, un_FrameSize, MSG_DONTWAIT);
+      if (s32_Ret == static_cast<int32_t>(un_FrameSize))
       {
-         t_Frame.can_id |= CAN_EFF_FLAG;
+         s32_Error = C_NO_ERR;
       }
-      if (orc_Message.u8_RTR != 0)
+      else if ((s32_Ret < 0) && ((errno == EAGAIN) || (errno == ENOBUFS) || (errno == EINTR)))
       {
-         t_Frame.can_id |= CAN_RTR_FLAG;
+         struct pollfd t_PollFd;
+
+         // check if socket is ready (sleep max. 50ms)
+         t_PollFd.fd = this->ms32_Socket;
+         t_PollFd.events = POLLOUT;
+         s32_Ret = poll(&t_PollFd, 1, 50);
+         if (s32_Ret > 0)
+         {
+            if ((t_PollFd.revents & POLLOUT) != 0)
+            {
+               s32_Ret = write(this->ms32_Socket, &t_Frame, un_FrameSize);
+               s32_Error = (s32_Ret == static_cast<int32_t>(un_FrameSize)) ? C_NO_ERR : C_COM;
+            }
+            else
+            {
+               // Unexpected error, should never happen
+               s32_Error = C_COM;
+            }
+         }
+         else if (s32_Ret == 0)
+         {
+            // timeout
+            s32_Error = C_BUSY;
+         }
+         else
+         {
+            s32_Error = ((errno == EAGAIN) || (errno == EINTR)) ? C_BUSY : C_COM;
+         }
       }
-      t_Frame.can_dlc = orc_Message.u8_DLC;
-      for (int i = 0; i < 8; ++i)
+      else
       {
-         t_Frame.data[i] = orc_Message.au8_Data[i];
+         s32_Error = C_COM;
       }
+   }
+   return s32_Error;
+}
 
-      // check if socket is ready (sleep max. 50ms)
-      t_PollFd.fd = this->ms32_Socket;
-      t_PollFd.events = POLLOUT;
-      s32_Ret = poll(&t_PollFd, 1, 50);
-      if (s32_Ret > 0)
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Send multiple CAN messages
+
+   Send messages in batches of up to mu32_CAN_DISPATCH_BATCH_SIZE messages with one call to sendmmsg.
+   Messages are sent in the order they are passed.
+   If the TX queue of the interface is full the function waits for a maximum of 50ms for free space.
+
+   \param[in]   opc_Messages       messages to send
+   \param[in]   ou32_NumMessages   number of messages in opc_Messages
+   \param[out]  oru32_NumSent      number of messages that were sent
+
+   \return
+   C_NO_ERR   all messages sent
+   C_BUSY     TX queue still full after waiting; oru32_NumSent messages were sent
+   C_COM      error sending messages; oru32_NumSent messages were sent
+   C_RANGE    invalid message (see CAN_Send_Msg); oru32_NumSent messages before the invalid one were sent
+   C_CONFIG   interface not initialized
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_Can::CAN_Send_Msgs(const T_STWCAN_Msg_TX * const opc_Messages, const uint32_t ou32_NumMessages,
+                             uint32_t & oru32_NumSent)
+{
+   int32_t s32_Error = C_NO_ERR;
+
+   oru32_NumSent = 0U;
+   if (this->ms32_Socket < 0)
+   {
+      s32_Error = C_CONFIG;
+   }
+
+   while ((s32_Error == C_NO_ERR) && (oru32_NumSent < ou32_NumMessages))
+   {
+      struct canfd_frame at_Frames[mu32_CAN_DISPATCH_BATCH_SIZE];
+      struct iovec at_Iov[mu32_CAN_DISPATCH_BATCH_SIZE];
+      struct mmsghdr at_Msgs[mu32_CAN_DISPATCH_BATCH_SIZE];
+      uint32_t u32_NumBatch = ou32_NumMessages - oru32_NumSent;
+      int32_t s32_Ret;
+
+      if (u32_NumBatch > mu32_CAN_DISPATCH_BATCH_SIZE)
+      {
+         u32_NumBatch = mu32_CAN_DISPATCH_BATCH_SIZE;
+      }
+
+      (void)memset(&at_Msgs[0], 0, sizeof(at_Msgs));
+      for (uint32_t u32_Msg = 0U; u32_Msg < u32_NumBatch; u32_Msg++)
+      {
+         size_t un_FrameSize = CAN_MTU;
+         if (m_FillFrame(opc_Messages[oru32_NumSent + u32_Msg], mq_FDAvailable, at_Frames[u32_Msg],
+                         un_FrameSize) != C_NO_ERR)
+         {
+            //send the valid messages before the invalid one first
+            u32_NumBatch = u32_Msg;
+            break;
+         }
+         at_Iov[u32_Msg].iov_base = &at_Frames[u32_Msg];
+         at_Iov[u32_Msg].iov_len = un_FrameSize;
+         at_Msgs[u32_Msg].msg_hdr.msg_iov = &at_Iov[u32_Msg];
+         at_Msgs[u32_Msg].msg_hdr.msg_iovlen = 1;
+      }
+
+      if (u32_NumBatch == 0U)
+      {
+         s32_Error = C_RANGE;
+         s32_Ret = -1;
+      }
+      else
       {
-         if ((t_PollFd.revents & POLLOUT) != 0)
+         s32_Ret = sendmmsg(this->ms32_Socket, &at_Msgs[0], u32_NumBatch, MSG_DONTWAIT);
+      }
+
+      if (s32_Error != C_NO_ERR)
+      {
+         //invalid message; nothing sent in this batch
+      }
+      else if (s32_Ret > 0)
+      {
+         oru32_NumSent += static_cast<uint32_t>(s32_Ret);
+      }
+      else if ((s32_Ret == 0) || (errno == EAGAIN) || (errno == ENOBUFS) || (errno == EINTR))
+      {
+         struct pollfd t_PollFd;
+
+         // TX queue full: wait for free space (sleep max. 50ms)
+         t_PollFd.fd = this->ms32_Socket;
+         t_PollFd.events = POLLOUT;
+         s32_Ret = poll(&t_PollFd, 1, 50);
+         if (s32_Ret == 0)
+         {
+            s32_Error = C_BUSY;
+         }
+         else if (s32_Ret < 0)
          {
-            s32_Ret = write(this->ms32_Socket, &t_Frame, sizeof(t_Frame));
-            s32_Error = (s32_Ret ==  sizeof(t_Frame)) ? C_NO_ERR : C_COM;
+            s32_Error = ((errno == EAGAIN) || (errno == EINTR)) ? C_BUSY : C_COM;
          }
          else
          {
-            // Unexpected error, should never happen
-            s32_Error = C_COM;
+            //space available: try again
          }
       }
-      else if (s32_Ret == 0)
-      {
-         // timeout
-         s32_Error = C_BUSY;
-      }
       else
       {
-         s32_Error = ((errno == EAGAIN) || (errno == EINTR)) ? C_BUSY : C_COM;
+         s32_Error = C_COM;
       }
    }
-   else
-   {
-      s32_Error = C_CONFIG;
-   }
    return s32_Error;
 }
 
@@ -314,49 +525,260 @@ int32_t C_Can::m_CAN_Read_Msg(T_STWCAN_Msg_RX & orc_Message)
 }
 
 //----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read a batch of incoming CAN messages
 
-int32_t C_Can::CAN_Read_Msg_Timeout(const uint32_t ou32_MaxWaitTimeMS, T_STWCAN_Msg_RX & orc_Message)
+   Reads all messages available at the socket (up to ou32_MaxMessages) with one call to recvmmsg.
+   Waits for the first message according to the RX timeout configured with CAN_Init.
+
+   \param[out]  opc_Messages      buffer for read messages (at least ou32_MaxMessages entries)
+   \param[in]   ou32_MaxMessages  maximum number of messages to read
+   \param[out]  oru32_NumRead     number of messages placed in opc_Messages
+
+   \return
+   C_NO_ERR   buffer was filled completely; more messages might be available
+   C_NOACT    no more messages available (oru32_NumRead messages were read nonetheless)
+   C_COM      error reading from socket
+   C_CONFIG   interface not initialized
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_Can::m_CAN_Read_Msgs(T_STWCAN_Msg_RX * const opc_Messages, const uint32_t ou32_MaxMessages,
+                               uint32_t & oru32_NumRead)
+{
+   return m_ReadMessages(ms32_RxTimeout, opc_Messages, ou32_MaxMessages, oru32_NumRead);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wait for incoming CAN messages
+
+   Sleep on the socket until a message was received or the timeout expired.
+   Does not read the message. Independent of the RX timeout configured with CAN_Init.
+
+   \param[in]  ou32_TimeoutMs   maximum time to wait in milliseconds
+
+   \return
+   C_NO_ERR   message(s) available
+   C_TIMEOUT  no message received within timeout
+   C_COM      error waiting on socket
+   C_CONFIG   interface not initialized
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_Can::m_CAN_WaitForRx(const uint32_t ou32_TimeoutMs)
 {
    int32_t s32_Error;
-   int32_t s32_Ret;
 
-   if (this->ms32_Socket >= 0)
+   if (this->ms32_Socket < 0)
+   {
+      s32_Error = C_CONFIG;
+   }
+   else
+   {
+      struct pollfd t_PollFd;
+      int32_t s32_Ret;
+
+      t_PollFd.fd = this->ms32_Socket;
+      t_PollFd.events = POLLIN;
+      s32_Ret = poll(&t_PollFd, 1, static_cast<int32_t>(ou32_TimeoutMs));
+      if (s32_Ret > 0)
+      {
+         s32_Error = C_NO_ERR;
+      }
+      else if (s32_Ret == 0)
+      {
+         s32_Error = C_TIMEOUT;
+      }
+      else
+      {
+         s32_Error = ((errno == EAGAIN) || (errno == EINTR)) ? C_TIMEOUT : C_COM;
+      }
+   }
+   return s32_Error;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+int32_t C_Can::CAN_Read_Msg_Timeout(const uint32_t ou32_MaxWaitTimeMS, T_STWCAN_Msg_RX & orc_Message)
+{
+   uint32_t u32_NumRead;
+   int32_t s32_Error = m_ReadMessages(static_cast<int32_t>(ou32_MaxWaitTimeMS), &orc_Message, 1U, u32_NumRead);
+
+   if (u32_NumRead == 1U)
+   {
+      s32_Error = C_NO_ERR;
+   }
+   else if (s32_Error == C_NO_ERR)
+   {
+      s32_Error = C_COM; // a frame with unexpected size was received
+   }
+   else
+   {
+      //keep error
+   }
+   return s32_Error;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read incoming CAN messages from socket
+
+   Waits for incoming messages for a maximum of os32_TimeoutMs.
+   Then reads all available messages (up to ou32_MaxMessages) with one call to recvmmsg.
+
+   Time stamps are taken according to the configured time stamp mode.
+   If the kernel did not provide a time stamp for a message the system time is used.
+
+   \param[in]   os32_TimeoutMs    -1: block until message received; 0: return immediately; >0: timeout in ms
+   \param[out]  opc_Messages      buffer for read messages (at least ou32_MaxMessages entries)
+   \param[in]   ou32_MaxMessages  maximum number of messages to read
+   \param[out]  oru32_NumRead     number of messages placed in opc_Messages
+
+   \return
+   C_NO_ERR   buffer was filled completely; more messages might be available
+   C_NOACT    no more messages available (oru32_NumRead messages were read nonetheless)
+   C_COM      error reading from socket
+   C_CONFIG   interface not initialized
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_Can::m_ReadMessages(const int32_t os32_TimeoutMs, T_STWCAN_Msg_RX * const opc_Messages,
+                              const uint32_t ou32_MaxMessages, uint32_t & oru32_NumRead) const
+{
+   int32_t s32_Error = C_NO_ERR;
+   int32_t s32_Ret = 1;
+
+   oru32_NumRead = 0U;
+   if (this->ms32_Socket < 0)
    {
+      s32_Error = C_CONFIG;
+   }
+   else if (os32_TimeoutMs != 0)
+   {
+      // wait for first message; with a timeout of zero we can save the poll() and go to recvmmsg directly
       struct pollfd t_PollFd;
 
       t_PollFd.fd = this->ms32_Socket;
       t_PollFd.events = POLLIN;
-      s32_Ret = poll(&t_PollFd, 1, ou32_MaxWaitTimeMS);
+      s32_Ret = poll(&t_PollFd, 1, os32_TimeoutMs);
       if (s32_Ret > 0)
       {
-         s32_Error = C_COM; // indicates that an unexpected error occurred, should never happen
-         if ((t_PollFd.revents & POLLIN) != 0)
+         if ((t_PollFd.revents & POLLIN) == 0)
          {
-            struct can_frame t_Frame;
+            s32_Error = C_COM; // indicates that an unexpected error occurred, should never happen
+         }
+      }
+      else if (s32_Ret == 0)
+      {
+         // timeout
+         s32_Error = C_NOACT;
+      }
+      else
+      {
+         s32_Error = ((errno == EAGAIN) || (errno == EINTR)) ? C_NOACT : C_COM;
+      }
+   }
+   else
+   {
+      //no waiting requested
+   }
 
-            s32_Ret = read(this->ms32_Socket, &t_Frame, sizeof(t_Frame));
-            if (s32_Ret == sizeof(t_Frame))
+   if (s32_Error == C_NO_ERR)
+   {
+      struct canfd_frame at_Frames[mu32_CAN_DISPATCH_BATCH_SIZE];
+      struct iovec at_Iov[mu32_CAN_DISPATCH_BATCH_SIZE];
+      struct mmsghdr at_Msgs[mu32_CAN_DISPATCH_BATCH_SIZE];
+      uint8_t au8_Control[mu32_CAN_DISPATCH_BATCH_SIZE][CAN_CMSG_BUFFER_SIZE];
+      const bool q_UseKernelTime = (me_TimeStampMode != eTIME_STAMP_SYSTEM);
+      const uint32_t u32_MaxBatch = (ou32_MaxMessages > mu32_CAN_DISPATCH_BATCH_SIZE) ?
+                                    mu32_CAN_DISPATCH_BATCH_SIZE : ou32_MaxMessages;
+
+      (void)memset(&at_Msgs[0], 0, sizeof(at_Msgs));
+      for (uint32_t u32_Msg = 0U; u32_Msg < u32_MaxBatch; u32_Msg++)
+      {
+         at_Iov[u32_Msg].iov_base = &at_Frames[u32_Msg];
+         at_Iov[u32_Msg].iov_len = sizeof(struct canfd_frame);
+         at_Msgs[u32_Msg].msg_hdr.msg_iov = &at_Iov[u32_Msg];
+         at_Msgs[u32_Msg].msg_hdr.msg_iovlen = 1;
+         if (q_UseKernelTime == true)
+         {
+            at_Msgs[u32_Msg].msg_hdr.msg_control = &au8_Control[u32_Msg][0];
+            at_Msgs[u32_Msg].msg_hdr.msg_controllen = CAN_CMSG_BUFFER_SIZE;
+         }
+      }
+
+      s32_Ret = recvmmsg(this->ms32_Socket, &at_Msgs[0], u32_MaxBatch, MSG_DONTWAIT, NULL);
+      if (s32_Ret > 0)
+      {
+         // one system time for the whole batch; better than ioctl(SIOCGSTAMP) since this is synchronous to
+         // system time
+         const uint64_t u64_Now = TglGetTickCountUs();
+         uint64_t u64_RealTimeOffset = 0U;
+
+         if (q_UseKernelTime == true)
+         {
+            // kernel software time stamps are based on CLOCK_REALTIME; we report CLOCK_MONOTONIC based times
+            struct timespec t_RealTime;
+            (void)clock_gettime(CLOCK_REALTIME, &t_RealTime);
+            u64_RealTimeOffset = m_TimeSpecToUs(t_RealTime) - u64_Now;
+         }
+
+         for (uint32_t u32_Msg = 0U; u32_Msg < static_cast<uint32_t>(s32_Ret); u32_Msg++)
+         {
+            const struct canfd_frame & rc_Frame = at_Frames[u32_Msg];
+            T_STWCAN_Msg_RX & rc_Message = opc_Messages[oru32_NumRead];
+            const bool q_IsFdFrame = (at_Msgs[u32_Msg].msg_len == CANFD_MTU);
+
+            //ignore incomplete frames
+            if ((at_Msgs[u32_Msg].msg_len == CAN_MTU) || (q_IsFdFrame == true))
             {
-               // new message received
-               orc_Message.u64_TimeStamp = TglGetTickCountUs();                    // better than ioctl(SIOCGSTAMP)
-                                                                                    // since
-                                                                                    // this is synchronous to system
-                                                                                    // time
-               orc_Message.u32_ID = t_Frame.can_id & CAN_ERR_MASK;                  // get received ID
-               orc_Message.u8_XTD = ((t_Frame.can_id & CAN_EFF_FLAG) == 0) ? 0 : 1; // get extended flag
-               orc_Message.u8_RTR = ((t_Frame.can_id & CAN_RTR_FLAG) == 0) ? 0 : 1; // get RTR flag
-               orc_Message.u8_DLC = t_Frame.can_dlc;                                // get data length code
-               for (int i = 0; i < 8; ++i)
+               rc_Message.u64_TimeStamp = u64_Now;
+               if (q_UseKernelTime == true)
+               {
+                  struct cmsghdr * pc_Cmsg;
+                  for (pc_Cmsg = CMSG_FIRSTHDR(&at_Msgs[u32_Msg].msg_hdr); pc_Cmsg != NULL;
+                       pc_Cmsg = CMSG_NXTHDR(&at_Msgs[u32_Msg].msg_hdr, pc_Cmsg))
+                  {
+                     if ((pc_Cmsg->cmsg_level == SOL_SOCKET) && (pc_Cmsg->cmsg_type == SO_TIMESTAMPING))
+                     {
+                        struct scm_timestamping t_Stamps;
+                        (void)memcpy(&t_Stamps, CMSG_DATA(pc_Cmsg), sizeof(t_Stamps));
+                        //ts[2]: raw hardware time stamp; ts[0]: software time stamp
+                        if ((me_TimeStampMode == eTIME_STAMP_HARDWARE) &&
+                            ((t_Stamps.ts[2].tv_sec != 0) || (t_Stamps.ts[2].tv_nsec != 0)))
+                        {
+                           rc_Message.u64_TimeStamp = m_TimeSpecToUs(t_Stamps.ts[2]);
+                        }
+                        else if ((t_Stamps.ts[0].tv_sec != 0) || (t_Stamps.ts[0].tv_nsec != 0))
+                        {
+                           rc_Message.u64_TimeStamp = m_TimeSpecToUs(t_Stamps.ts[0]) - u64_RealTimeOffset;
+                        }
+                        else
+                        {
+                           //no time stamp: keep system time
+                        }
+                     }
+                  }
+               }
+               rc_Message.u32_ID = rc_Frame.can_id & CAN_ERR_MASK;                  // get received ID
+               rc_Message.u8_XTD = ((rc_Frame.can_id & CAN_EFF_FLAG) == 0) ? 0 : 1; // get extended flag
+               rc_Message.u8_RTR = ((rc_Frame.can_id & CAN_RTR_FLAG) == 0) ? 0 : 1; // get RTR flag
+               if (q_IsFdFrame == true)
                {
-                  orc_Message.au8_Data[i] = t_Frame.data[i];
+                  rc_Message.u8_FDF = 1U;
+                  rc_Message.u8_DLC = (rc_Frame.len > STWCAN_FD_MAX_DLC) ? STWCAN_FD_MAX_DLC : rc_Frame.len;
+                  (void)memcpy(&rc_Message.au8_Data[0], &rc_Frame.data[0], rc_Message.u8_DLC);
                }
-               s32_Error = C_NO_ERR;
+               else
+               {
+                  rc_Message.u8_FDF = 0U;
+                  rc_Message.u8_DLC = rc_Frame.len; // get data length code
+                  (void)memcpy(&rc_Message.au8_Data[0], &rc_Frame.data[0], STWCAN_CLASSIC_MAX_DLC);
+               }
+               oru32_NumRead++;
             }
          }
+
+         // more messages might be waiting if we filled the buffer
+         s32_Error = (static_cast<uint32_t>(s32_Ret) == u32_MaxBatch) ? C_NO_ERR : C_NOACT;
       }
       else if (s32_Ret == 0)
       {
-         // timeout
          s32_Error = C_NOACT;
       }
       else
@@ -364,11 +786,44 @@ int32_t C_Can::CAN_Read_Msg_Timeout(const uint32_t ou32_MaxWaitTimeMS, T_STWCAN_
          s32_Error = ((errno == EAGAIN) || (errno == EINTR)) ? C_NOACT : C_COM;
       }
    }
-   else
+   return s32_Error;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Configure kernel time stamping on the socket according to the configured time stamp mode
+
+   \return
+   C_NO_ERR   configured (or socket not yet open; will be configured by CAN_Init)
+   C_NOACT    kernel rejected the configuration; system time stamps will be used
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_Can::m_ConfigureTimeStamping(void) const
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   if (this->ms32_Socket >= 0)
    {
-      s32_Error = C_CONFIG;
+      int s32_Flags = 0;
+
+      switch (me_TimeStampMode)
+      {
+      case eTIME_STAMP_HARDWARE:
+         s32_Flags = SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE |
+                     SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+         break;
+      case eTIME_STAMP_KERNEL:
+         s32_Flags = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+         break;
+      case eTIME_STAMP_SYSTEM:
+      default:
+         break;
+      }
+      if (setsockopt(this->ms32_Socket, SOL_SOCKET, SO_TIMESTAMPING, &s32_Flags, sizeof(s32_Flags)) != 0)
+      {
+         s32_Return = C_NOACT;
+      }
    }
-   return s32_Error;
+   return s32_Return;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -392,3 +847,115 @@ uint32_t C_Can::GetLimitRXID(void) const
 {
    return mu32_RXID;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set source of reception time stamps
+
+   eTIME_STAMP_SYSTEM:   system time when the message was read from the socket (same base as TglGetTickCountUs)
+   eTIME_STAMP_KERNEL:   time the kernel received the message; converted to the base of TglGetTickCountUs;
+                         not affected by scheduling latency of the reading thread
+   eTIME_STAMP_HARDWARE: time stamp provided by the CAN controller (time base of the controller);
+                         falls back to the kernel time stamp for messages without hardware time stamp
+
+   Can be called before or after CAN_Init.
+
+   \param[in]   oe_Mode   time stamp source to use
+
+   \return
+   C_NO_ERR   mode set
+   C_NOACT    kernel rejected the configuration; system time stamps will be used
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_Can::SetTimeStampMode(const E_TimeStampMode oe_Mode)
+{
+   me_TimeStampMode = oe_Mode;
+   return m_ConfigureTimeStamping();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_Can::E_TimeStampMode C_Can::GetTimeStampMode(void) const
+{
+   return me_TimeStampMode;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Enable or disable CAN FD
+
+   With CAN FD enabled messages with u8_FDF set and up to 64 data bytes can be sent and received.
+   CAN FD frames are sent with bit rate switching.
+   The bit rates of the interface must be configured outside the application (e.g. "ip link set can0 type can
+   bitrate 500000 dbitrate 2000000 fd on"; for virtual interfaces "ip link set vcan0 mtu 72").
+
+   Can be called before or after CAN_Init.
+   GetFDAvailable reports whether CAN FD could actually be enabled on the interface.
+
+   \param[in]   oq_Enable   true: use CAN FD if the interface supports it; false: classic CAN only
+
+   \return
+   C_NO_ERR   mode set
+   C_NOACT    interface is not configured for CAN FD or kernel rejected the configuration; classic CAN will be used
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_Can::SetFdMode(const bool oq_Enable)
+{
+   mq_FdModeRequested = oq_Enable;
+   return m_ConfigureFdMode();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+bool C_Can::GetFdMode(void) const
+{
+   return mq_FdModeRequested;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Configure reception and transmission of CAN FD frames on the socket according to the configured mode
+
+   \return
+   C_NO_ERR   configured (or socket not yet open; will be configured by CAN_Init)
+   C_NOACT    interface is not configured for CAN FD or kernel rejected the configuration; classic CAN will be used
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_Can::m_ConfigureFdMode(void)
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   mq_FDAvailable = false;
+   if (this->ms32_Socket >= 0)
+   {
+      int s32_Enable = 0;
+
+      if (mq_FdModeRequested == true)
+      {
+         struct ifreq t_Ifr;
+
+         //the interface only supports CAN FD if its MTU was set to CANFD_MTU
+         (void)memset(&t_Ifr, 0, sizeof(t_Ifr));
+         (void)strncpy(t_Ifr.ifr_name, mc_CanIfName.c_str(), sizeof(t_Ifr.ifr_name) - 1U);
+         if ((ioctl(this->ms32_Socket, SIOCGIFMTU, &t_Ifr) >= 0) && (t_Ifr.ifr_mtu == CANFD_MTU))
+         {
+            s32_Enable = 1;
+         }
+         else
+         {
+            s32_Return = C_NOACT;
+         }
+      }
+
+      if (setsockopt(this->ms32_Socket, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &s32_Enable, sizeof(s32_Enable)) == 0)
+      {
+         mq_FDAvailable = (s32_Enable == 1);
+      }
+      else if (s32_Enable == 1)
+      {
+         s32_Return = C_NOACT;
+      }
+      else
+      {
+         //classic CAN is the default; nothing to report
+      }
+   }
+   return s32_Return;
+}
@@ -23,6 +23,7 @@
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "stwtypes.hpp"
+#include "stwerrors.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw
@@ -276,6 +277,34 @@ public:
                                  const uint8_t ou8_ServerBusIdentifier, const uint8_t ou8_ServerNodeIdentifier,
                                  std::vector<uint8_t> & orc_Data) = 0;
 
+   //-----------------------------------------------------------------------------
+   /*!
+      \brief   Wait for incoming data on TCP socket
+
+      Put the calling thread to sleep until data is available on the TCP connection or the timeout expired.
+      Allows clients to wait for responses without polling ReadTcp() in a loop.
+
+      Default implementation: waiting is not supported by the implementation
+
+      \param[in]  ou32_Handle      handle obtained by InitTcp()
+      \param[in]  ou32_TimeoutMs   maximum time to wait in milliseconds
+
+      \return
+      C_NO_ERR   data available
+      C_TIMEOUT  no data received within timeout
+      C_NOACT    waiting not supported by implementation
+      C_CONFIG   required socket not initialized
+      C_RANGE    invalid handle
+   */
+   //-----------------------------------------------------------------------------
+   //lint -e{9175}  //intentionally no functionality in default implementation
+   virtual int32_t WaitForTcpData(const uint32_t ou32_Handle, const uint32_t ou32_TimeoutMs)
+   {
+      (void)ou32_Handle;
+      (void)ou32_TimeoutMs;
+      return stw::errors::C_NOACT;
+   }
+
    //-----------------------------------------------------------------------------
    /*!
       \brief   Send package on UDP socket
@@ -14,6 +14,8 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <unistd.h>
 #include <time.h>
+#include <cerrno>
+#include <atomic>
 #include "stwtypes.hpp"
 #include "TglTime.hpp"
 
@@ -22,12 +24,16 @@
 using namespace stw::tgl;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const uint32_t mu32_SPIN_TAIL_MIN_US = 10U;   ///< minimum time to actively wait at the end of a delay
+static const uint32_t mu32_SPIN_TAIL_MAX_US = 1000U; ///< maximum time to actively wait at the end of a delay
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
 /* -- Global Variables ---------------------------------------------------------------------------------------------- */
 
 /* -- Module Global Variables --------------------------------------------------------------------------------------- */
+///estimated wakeup latency of clock_nanosleep; this last part of a delay is waited actively
+static std::atomic<uint32_t> mu32_SpinTailUs(50U);
 
 /* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
 
@@ -77,9 +83,65 @@ void stw::tgl::TglGetDateTimeNow(C_TglDateTime & orc_DateTime)
 //----------------------------------------------------------------------------------------------------------------------
 void stw::tgl::TglDelayUs(const uint32_t ou32_NumberUs)
 {
-   const uint64_t u64_StopTime = TglGetTickCountUs() + ou32_NumberUs;
+   TglDelayUntilUs(TglGetTickCountUs() + ou32_NumberUs);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Delays until the given point in time is reached.
+
+   Sleeps with clock_nanosleep until shortly before the deadline and actively waits only for the remaining time.
+   The length of the actively waited part follows the measured wakeup latency of the sleep.
+   So the calling thread does not occupy a CPU core for the major part of the delay.
+
+   Pass the previous deadline plus the desired interval to send with a fixed period that does not
+   drift by the processing time between the delays.
+
+   \param[in]  ou64_DeadlineUs    Point in time to wait for (based on TglGetTickCountUs)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void stw::tgl::TglDelayUntilUs(const uint64_t ou64_DeadlineUs)
+{
+   const uint32_t u32_SpinTailUs = mu32_SpinTailUs.load();
+   uint64_t u64_Now = TglGetTickCountUs();
+
+   if ((u64_Now + u32_SpinTailUs) < ou64_DeadlineUs)
+   {
+      const uint64_t u64_WakeupTime = ou64_DeadlineUs - u32_SpinTailUs;
+      struct timespec t_WakeupTime;
+      uint32_t u32_Latency;
+
+      t_WakeupTime.tv_sec = static_cast<time_t>(u64_WakeupTime / 1000000U);
+      t_WakeupTime.tv_nsec = static_cast<long>((u64_WakeupTime % 1000000U) * 1000U); //lint !e970 //type of timespec
+      while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &t_WakeupTime, NULL) == EINTR)
+      {
+         //interrupted by signal: continue sleeping up to the same point in time
+      }
+
+      //adapt active waiting part to the measured wakeup latency (smoothed; settles at twice the latency)
+      //single outliers (e.g. caused by preemption) are limited so they do not make the active part grow too much
+      u64_Now = TglGetTickCountUs();
+      u32_Latency = (u64_Now > u64_WakeupTime) ? static_cast<uint32_t>(u64_Now - u64_WakeupTime) : 0U;
+      if (u32_Latency > (u32_SpinTailUs * 2U))
+      {
+         u32_Latency = u32_SpinTailUs * 2U;
+      }
+      u32_Latency = ((u32_SpinTailUs * 7U) + (u32_Latency * 2U)) / 8U;
+      if (u32_Latency < mu32_SPIN_TAIL_MIN_US)
+      {
+         u32_Latency = mu32_SPIN_TAIL_MIN_US;
+      }
+      else if (u32_Latency > mu32_SPIN_TAIL_MAX_US)
+      {
+         u32_Latency = mu32_SPIN_TAIL_MAX_US;
+      }
+      else
+      {
+         //nothing to do
+      }
+      mu32_SpinTailUs.store(u32_Latency);
+   }
 
-   while (TglGetTickCountUs() < u64_StopTime)
+   while (TglGetTickCountUs() < ou64_DeadlineUs)
    {
    }
 }
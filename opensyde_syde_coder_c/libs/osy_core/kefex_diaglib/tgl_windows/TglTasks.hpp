@@ -44,6 +44,63 @@ public:
    void Release(void);
 };
 
+//----------------------------------------------------------------------------------------------------------------------
+///Implements an event a thread can wait for (automatically reset when a waiting thread is released)
+class C_TglEvent
+{
+protected:
+   HANDLE mpv_Event; ///< synchronization object
+
+private:
+   //this class can not be copied:
+   C_TglEvent(const C_TglEvent & orc_Source);
+   C_TglEvent & operator = (const C_TglEvent & orc_Source);
+
+public:
+   C_TglEvent(void);
+   virtual ~C_TglEvent(void);
+
+   void Signal(void);
+   bool Wait(const uint32_t ou32_TimeoutMs);
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+///Implements a thread executing one function
+class C_TglThread
+{
+public:
+   ///function executed by the thread
+   typedef void (* PR_ThreadFunction)(void * const opv_Instance);
+
+protected:
+   HANDLE mpv_Thread;              ///< thread handle
+   PR_ThreadFunction mpr_Function; ///< function to execute
+   void * mpv_Instance;            ///< argument for mpr_Function
+   bool mq_Started;                ///< true: thread was started and not waited for yet
+
+   static DWORD WINAPI mh_ThreadFunction(LPVOID const opv_Thread);
+
+private:
+   //this class can not be copied:
+   C_TglThread(const C_TglThread & orc_Source);
+   C_TglThread & operator = (const C_TglThread & orc_Source);
+
+public:
+   C_TglThread(void);
+   virtual ~C_TglThread(void);
+
+   bool Start(const PR_ThreadFunction opr_Function, void * const opv_Instance);
+   void WaitForFinished(void);
+   bool IsStarted(void) const;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+///function executing one item of TglParallelFor()
+typedef void (* PR_TglParallelForFunction)(void * const opv_Instance, const uint32_t ou32_Index);
+
+void TglParallelFor(const uint32_t ou32_NumItems, const PR_TglParallelForFunction opr_Function,
+                    void * const opv_Instance);
+
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
 }
 }
@@ -24,6 +24,8 @@
 using namespace stw::tgl;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
+///worst case resolution of Sleep() with the default system timer; this last part of a delay is waited actively
+static const uint32_t mu32_SLEEP_RESOLUTION_US = 16000U;
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
@@ -59,9 +61,10 @@ void stw::tgl::TglGetDateTimeNow(C_TglDateTime & orc_DateTime)
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-/*! \brief   Actively wait for a period of time
+/*! \brief   Wait for a period of time
 
-   Actively blocks for the given number of microseconds.
+   Blocks for the given number of microseconds (see TglDelayUntilUs()):
+   sleeps for most of the delay and only actively waits for the remaining part below the Sleep() resolution.
    Depending on the underlying system very short delays might not be possible
      and are rounded up to the smallest possible delay.
    Thus for example 10 calls of TGL_DelayUs(1) can cause a longer delay than 1 call of TGL_DelayUs(10).
@@ -71,9 +74,31 @@ void stw::tgl::TglGetDateTimeNow(C_TglDateTime & orc_DateTime)
 //----------------------------------------------------------------------------------------------------------------------
 void stw::tgl::TglDelayUs(const uint32_t ou32_NumberUs)
 {
-   const uint64_t u64_StopTime = TglGetTickCountUs() + ou32_NumberUs;
+   TglDelayUntilUs(TglGetTickCountUs() + ou32_NumberUs);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wait until a point in time is reached
+
+   Passes on thread control with Sleep() for the part of the delay that is safely before the deadline
+   and actively waits for the remaining time.
+
+   Pass the previous deadline plus the desired interval to send with a fixed period that does not
+   drift by the processing time between the delays.
+
+   \param[in]   ou64_DeadlineUs           point in time to wait for (based on TglGetTickCountUs)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void stw::tgl::TglDelayUntilUs(const uint64_t ou64_DeadlineUs)
+{
+   const uint64_t u64_Now = TglGetTickCountUs();
+
+   if ((u64_Now + mu32_SLEEP_RESOLUTION_US) < ou64_DeadlineUs)
+   {
+      Sleep(static_cast<DWORD>((ou64_DeadlineUs - u64_Now - mu32_SLEEP_RESOLUTION_US) / 1000U));
+   }
 
-   while (TglGetTickCountUs() < u64_StopTime)
+   while (TglGetTickCountUs() < ou64_DeadlineUs)
    {
    }
 }
@@ -6,10 +6,14 @@
    Data class for any supported data type
 
    All SetValue* and GetValue* functions are synchronized and thread safe.
+   They share a small fixed set of locks selected by the address of the instance (lock striping),
+   so no synchronization object is created with each instance or copy.
    All other functions (SetArray for example) are not thread safe and shall not be used
    if more than one thread are accessing to the instance.
+   This includes copying: array data is shared between copies until the first write access (copy-on-write),
+   so an instance must not be copied while another thread writes to it.
 
-   The data is held in a std::vector of uint8.
+   The data is held in a C_OscNodeDataPoolContentBuffer of uint8.
    The getter and setter functions place the data into that vector in native endianness.
    This is not a problem as the RAM data is not shared with other systems.
 
@@ -30,6 +34,7 @@
 #include "C_SclChecksums.hpp"
 #include "C_OscUtils.hpp"
 #include "TglUtils.hpp"
+#include "TglTasks.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 
@@ -39,6 +44,7 @@ using namespace stw::scl;
 using namespace stw::opensyde_core;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const uint32_t mu32_NUM_LOCKS = 64U; ///< number of locks shared by all instances (power of two)
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
@@ -47,17 +53,224 @@ using namespace stw::opensyde_core;
 /* -- Module Global Variables --------------------------------------------------------------------------------------- */
 
 /* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+static C_TglCriticalSection & m_GetLock(const void * const opv_Instance);
 
 /* -- Implementation ------------------------------------------------------------------------------------------------ */
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get lock protecting the value of an instance
+
+   Instances are spread over the locks by their address.
+   Unrelated instances may share a lock; the protected sections are short so this rarely causes waiting.
+   The locks are created on first use.
+
+   \param[in]  opv_Instance   Instance to get the lock for
+
+   \return
+   lock to use for instance
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static C_TglCriticalSection & m_GetLock(const void * const opv_Instance)
+{
+   static C_TglCriticalSection hac_Locks[mu32_NUM_LOCKS];
+   //skip low bits: they are the same for all instances due to alignment
+   const uintptr_t x_Address = reinterpret_cast<uintptr_t>(opv_Instance); //lint !e923 //address only used as hash
+
+   return hac_Locks[static_cast<uint32_t>(x_Address >> 4U) & (mu32_NUM_LOCKS - 1U)];
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+
+   Empty storage.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscNodeDataPoolContentBuffer::C_OscNodeDataPoolContentBuffer(void) :
+   mu32_Size(0U)
+{
+   (void)std::memset(&this->mau8_Inline[0], 0, sizeof(this->mau8_Inline));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Copy constructor
+
+   Inline data is copied; a buffer is shared with the source until one of them is written to.
+
+   \param[in]  orc_Source  Reference to source
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscNodeDataPoolContentBuffer::C_OscNodeDataPoolContentBuffer(const C_OscNodeDataPoolContentBuffer & orc_Source) :
+   mu32_Size(orc_Source.mu32_Size),
+   mc_Shared(orc_Source.mc_Shared)
+{
+   (void)std::memcpy(&this->mau8_Inline[0], &orc_Source.mau8_Inline[0], sizeof(this->mau8_Inline));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Copy operator
+
+   \param[in]  orc_Source  Reference to source
+
+   \return
+   reference to new instance
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscNodeDataPoolContentBuffer & C_OscNodeDataPoolContentBuffer::operator =(
+   const C_OscNodeDataPoolContentBuffer & orc_Source)
+{
+   if (this != &orc_Source)
+   {
+      this->mu32_Size = orc_Source.mu32_Size;
+      (void)std::memcpy(&this->mau8_Inline[0], &orc_Source.mau8_Inline[0], sizeof(this->mau8_Inline));
+      this->mc_Shared = orc_Source.mc_Shared;
+   }
+   return (*this);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of bytes
+
+   \return
+   number of bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscNodeDataPoolContentBuffer::size(void) const
+{
+   return this->mu32_Size;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Change number of bytes
+
+   Same as std::vector::resize: existing bytes are kept; added bytes are set to ou8_Value.
+
+   \param[in]  ou32_Size   new number of bytes
+   \param[in]  ou8_Value   value of added bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeDataPoolContentBuffer::resize(const uint32_t ou32_Size, const uint8_t ou8_Value)
+{
+   if (ou32_Size != this->mu32_Size)
+   {
+      if (ou32_Size <= mhu32_INLINE_SIZE)
+      {
+         if (this->mu32_Size > mhu32_INLINE_SIZE)
+         {
+            //move kept bytes from buffer to inline storage
+            (void)std::memcpy(&this->mau8_Inline[0], &(*this->mc_Shared)[0], ou32_Size);
+            this->mc_Shared.reset();
+         }
+         else if (ou32_Size > this->mu32_Size)
+         {
+            (void)std::memset(&this->mau8_Inline[this->mu32_Size], ou8_Value, ou32_Size - this->mu32_Size);
+         }
+         else
+         {
+            //shrink inline: nothing to do
+         }
+      }
+      else
+      {
+         if (this->mu32_Size <= mhu32_INLINE_SIZE)
+         {
+            //move kept bytes from inline storage to new buffer
+            this->mc_Shared.reset(new std::vector<uint8_t>(&this->mau8_Inline[0],
+                                                           &this->mau8_Inline[this->mu32_Size]));
+         }
+         else if (this->mc_Shared.use_count() > 1)
+         {
+            //shared: resize a copy
+            this->mc_Shared.reset(new std::vector<uint8_t>(*this->mc_Shared));
+         }
+         else
+         {
+            //buffer owned exclusively: resize in place
+         }
+         this->mc_Shared->resize(ou32_Size, ou8_Value);
+      }
+      this->mu32_Size = ou32_Size;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read access to one byte
+
+   Like std::vector the index is not checked.
+
+   \param[in]  ou32_Index  byte index
+
+   \return
+   reference to byte
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const uint8_t & C_OscNodeDataPoolContentBuffer::operator [](const uint32_t ou32_Index) const
+{
+   const uint8_t * pu8_Data;
+
+   if (this->mu32_Size <= mhu32_INLINE_SIZE)
+   {
+      pu8_Data = &this->mau8_Inline[0];
+   }
+   else
+   {
+      pu8_Data = &(*this->mc_Shared)[0];
+   }
+   return pu8_Data[ou32_Index];
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write access to one byte
+
+   Like std::vector the index is not checked.
+   A buffer shared with other instances is copied first.
+
+   \param[in]  ou32_Index  byte index
+
+   \return
+   reference to byte
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint8_t & C_OscNodeDataPoolContentBuffer::operator [](const uint32_t ou32_Index)
+{
+   return this->m_GetWritableData()[ou32_Index];
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get pointer to data for writing
+
+   A buffer shared with other instances is copied first.
+   use_count() is only reliable here because this instance is not copied concurrently (see file description).
+
+   \return
+   pointer to first byte
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint8_t * C_OscNodeDataPoolContentBuffer::m_GetWritableData(void)
+{
+   uint8_t * pu8_Data;
+
+   if (this->mu32_Size <= mhu32_INLINE_SIZE)
+   {
+      pu8_Data = &this->mau8_Inline[0];
+   }
+   else
+   {
+      if (this->mc_Shared.use_count() > 1)
+      {
+         this->mc_Shared.reset(new std::vector<uint8_t>(*this->mc_Shared));
+      }
+      pu8_Data = &(*this->mc_Shared)[0];
+   }
+   return pu8_Data;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Default constructor
 */
 //----------------------------------------------------------------------------------------------------------------------
 C_OscNodeDataPoolContent::C_OscNodeDataPoolContent(void) :
    me_Type(eUINT8),
-   mq_Array(false),
-   mc_CriticalSection()
+   mq_Array(false)
 {
    mc_Data.resize(1, 0U); //matching uint8 type
 }
@@ -71,8 +284,7 @@ C_OscNodeDataPoolContent::C_OscNodeDataPoolContent(void) :
 C_OscNodeDataPoolContent::C_OscNodeDataPoolContent(const C_OscNodeDataPoolContent & orc_Source) :
    me_Type(orc_Source.me_Type),
    mq_Array(orc_Source.mq_Array),
-   mc_Data(orc_Source.mc_Data),
-   mc_CriticalSection()
+   mc_Data(orc_Source.mc_Data)
 {
 }
 
@@ -226,10 +438,10 @@ template <typename T> void C_OscNodeDataPoolContent::m_SetValue(const T & orc_Va
    {
       if (this->me_Type == oe_Type)
       {
-         this->mc_CriticalSection.Acquire();
+         m_GetLock(this).Acquire();
          //lint -e{9110} //we do not really use the bit representation; mc_Data is just our "BLOB" storage
          (void)std::memcpy(&this->mc_Data[0], &orc_Value, sizeof(orc_Value));
-         this->mc_CriticalSection.Release();
+         m_GetLock(this).Release();
       }
       else
       {
@@ -259,10 +471,10 @@ template <typename T> void C_OscNodeDataPoolContent::m_GetValue(const E_Type oe_
    {
       if (this->me_Type == oe_Type)
       {
-         this->mc_CriticalSection.Acquire();
+         m_GetLock(this).Acquire();
          //lint -e{9110} //we do not really use the bit representation; mc_Data is just our "BLOB" storage
          (void)std::memcpy(&orc_Value, &this->mc_Data[0], sizeof(orc_Value));
-         this->mc_CriticalSection.Release();
+         m_GetLock(this).Release();
       }
       else
       {
@@ -673,11 +885,11 @@ template <typename T> void C_OscNodeDataPoolContent::m_SetValueArray(const T & o
    {
       if (this->me_Type == oe_Type)
       {
-         this->mc_CriticalSection.Acquire();
+         m_GetLock(this).Acquire();
          mc_Data.resize(orc_Value.size() * sizeof(orc_Value[0]));
          //lint -e{9110} //we do not really use the bit representation; mc_Data is just our "BLOB" storage
          (void)std::memcpy(&this->mc_Data[0], &orc_Value[0], this->mc_Data.size());
-         this->mc_CriticalSection.Release();
+         m_GetLock(this).Release();
       }
       else
       {
@@ -714,11 +926,11 @@ template <typename T> void C_OscNodeDataPoolContent::m_SetValueArrayElement(cons
       {
          if (this->GetArraySize() > ou32_Index)
          {
-            this->mc_CriticalSection.Acquire();
+            m_GetLock(this).Acquire();
             //lint -e{9110} //we do not really use the bit representation; mc_Data is just our "BLOB" storage
             //lint -e{9114} //range of parameter is safe for sizeof result to fit in
             (void)std::memcpy(&this->mc_Data[ou32_Index * (sizeof(orc_Value))], &orc_Value, sizeof(orc_Value));
-            this->mc_CriticalSection.Release();
+            m_GetLock(this).Release();
          }
          else
          {
@@ -752,11 +964,11 @@ template <typename T> void C_OscNodeDataPoolContent::m_GetValueArray(const E_Typ
    {
       if (this->me_Type == oe_Type)
       {
-         this->mc_CriticalSection.Acquire();
+         m_GetLock(this).Acquire();
          orc_Result.resize(this->mc_Data.size() / sizeof(orc_Result[0]));
          //lint -e{9110} //we do not really use the bit representation; mc_Data is just our "BLOB" storage
          (void)std::memcpy(&orc_Result[0], &this->mc_Data[0], this->mc_Data.size());
-         this->mc_CriticalSection.Release();
+         m_GetLock(this).Release();
       }
       else
       {
@@ -793,11 +1005,11 @@ template <typename T> void C_OscNodeDataPoolContent::m_GetValueArrayElement(cons
       {
          if (this->GetArraySize() > ou32_Index)
          {
-            this->mc_CriticalSection.Acquire();
+            m_GetLock(this).Acquire();
             //lint -e{9110} //we do not really use the bit representation; mc_Data is just our "BLOB" storage
             //lint -e{9114} //range of parameter is safe for sizeof result to fit in
             (void)std::memcpy(&orc_Result, &this->mc_Data[ou32_Index * sizeof(orc_Result)], sizeof(orc_Result));
-            this->mc_CriticalSection.Release();
+            m_GetLock(this).Release();
          }
          else
          {
@@ -59,6 +59,21 @@ C_OscProtocolDriverOsy::C_ListOfFeatures::C_ListOfFeatures(void)
    q_SupportsDebuggerOn = false;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set up class
+
+   Initializes class elements
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscProtocolDriverOsy::C_AsyncRequest::C_AsyncRequest(void) :
+   pr_OnFinished(NULL),
+   pv_Instance(NULL),
+   u32_RequestId(0U),
+   s32_Result(C_NO_ERR),
+   u8_NrCode(0U)
+{
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Set up class
 
@@ -66,13 +81,22 @@ C_OscProtocolDriverOsy::C_ListOfFeatures::C_ListOfFeatures(void)
 */
 //----------------------------------------------------------------------------------------------------------------------
 C_OscProtocolDriverOsy::C_OscProtocolDriverOsy(void) :
+   mq_SyncPollActive(false),
+   mu8_SyncPollServiceId(0U),
+   mq_SyncResponseReceived(false),
    mpr_OnOsyTunnelCanMessageReceived(NULL),
    mpv_OnAsyncTunnelCanMessageInstance(NULL),
    mpr_OnOsyWaitTime(NULL),
    mpv_OnOsyWaitTimeInstance(NULL),
    mpc_TransportProtocol(NULL),
    mu32_TimeoutPollingMs(hu32_DEFAULT_TIMEOUT),
-   mu16_MaxServiceSize(C_OscProtocolDriverOsyTpBase::hu16_OSY_MAXIMUM_SERVICE_SIZE)
+   mu16_MaxServiceSize(C_OscProtocolDriverOsyTpBase::hu16_OSY_MAXIMUM_SERVICE_SIZE),
+   mq_AsyncRequestInFlight(false),
+   mu32_AsyncRequestStartTimeMs(0U),
+   mu32_NextAsyncRequestId(0U),
+   mq_AsyncRequestSentBeforeSyncRequest(false),
+   mq_AsyncDiscardActive(false),
+   mu32_AsyncDiscardStartTimeMs(0U)
 {
 }
 
@@ -308,49 +332,54 @@ int32_t C_OscProtocolDriverOsy::m_Cycle(const bool oq_CheckForSpecificServiceId,
 
             if (s32_Return == C_NO_ERR)
             {
-               //Check error response first
-               // The SID must match and the length must be minimum 3
-               // It might be a negative response with more information than UDS specified
-               if ((c_Service.c_Data.size() >= 3U) && (c_Service.c_Data[0] == mhu8_OSY_NR_SI))
+               //responses to the async request in flight are checked first
+               if (this->m_HandleAsyncRequestResponse(c_Service, oq_CheckForSpecificServiceId,
+                                                      ou8_ExpectedServiceId) == false)
                {
-                  //... to our request ?
-                  if ((oq_CheckForSpecificServiceId == true) && (c_Service.c_Data[1] == ou8_ExpectedServiceId))
+                  //Check error response first
+                  // The SID must match and the length must be minimum 3
+                  // It might be a negative response with more information than UDS specified
+                  if ((c_Service.c_Data.size() >= 3U) && (c_Service.c_Data[0] == mhu8_OSY_NR_SI))
                   {
-                     //yes. report to caller
-                     q_ExpectedServiceReceived = true;
-                     if (opc_ReceivedService != NULL)
+                     //... to our request ?
+                     if ((oq_CheckForSpecificServiceId == true) && (c_Service.c_Data[1] == ou8_ExpectedServiceId))
+                     {
+                        //yes. report to caller
+                        q_ExpectedServiceReceived = true;
+                        if (opc_ReceivedService != NULL)
+                        {
+                           (*opc_ReceivedService) = c_Service;
+                        }
+                     }
+                     else
                      {
-                        (*opc_ReceivedService) = c_Service;
+                        //trigger async virtual functions for all received async responses
+                        this->m_HandleAsyncResponse(c_Service);
                      }
                   }
+                  //check for specific response ?
                   else
                   {
-                     //trigger async virtual functions for all received async responses
-                     this->m_HandleAsyncResponse(c_Service);
-                  }
-               }
-               //check for specific response ?
-               else
-               {
-                  if ((oq_CheckForSpecificServiceId == true) && (c_Service.c_Data.size() >= 1) &&
-                      (c_Service.c_Data[0] == (ou8_ExpectedServiceId | 0x40U)))
-                  {
-                     q_ExpectedServiceReceived = true;
-                     if (opc_ReceivedService != NULL)
+                     if ((oq_CheckForSpecificServiceId == true) && (c_Service.c_Data.size() >= 1) &&
+                         (c_Service.c_Data[0] == (ou8_ExpectedServiceId | 0x40U)))
+                     {
+                        q_ExpectedServiceReceived = true;
+                        if (opc_ReceivedService != NULL)
+                        {
+                           (*opc_ReceivedService) = c_Service;
+                        }
+                     }
+                     else
                      {
-                        (*opc_ReceivedService) = c_Service;
+                        //trigger async virtual functions for all received async responses
+                        this->m_HandleAsyncResponse(c_Service);
                      }
                   }
-                  else
+                  if (q_ExpectedServiceReceived == true)
                   {
-                     //trigger async virtual functions for all received async responses
-                     this->m_HandleAsyncResponse(c_Service);
+                     break; //finished here
                   }
                }
-               if (q_ExpectedServiceReceived == true)
-               {
-                  break; //finished here
-               }
             }
          }
          if ((oq_CheckForSpecificServiceId == true) && (q_ExpectedServiceReceived == false))
@@ -408,14 +437,28 @@ int32_t C_OscProtocolDriverOsy::m_PollForSpecificServiceResponse(const uint8_t o
    tgl_assert(orc_Service.c_Data.size() <= 0xFFFFU);
 
    //lock access to "polling"
-   //If another thread checking for async responses kicks in (calling ::Cycle) is could otherwise
-   // snatch away the response we want to get.
+   //The lock is released while waiting for the transport protocol. If another thread checking for async responses
+   // kicks in (calling ::Cycle) it hands over the response we want to get instead of treating it as event-driven.
    mc_LockReception.Acquire();
+   mq_SyncPollActive = true;
+   mu8_SyncPollServiceId = ou8_ExpectedServiceId;
+   mq_SyncResponseReceived = false;
 
-   while ((stw::tgl::TglGetTickCount() < (u32_StartTime + mu32_TimeoutPollingMs)) && (q_Finished == false))
+   while (((stw::tgl::TglGetTickCount() < (u32_StartTime + mu32_TimeoutPollingMs)) ||
+           (mq_SyncResponseReceived == true)) && (q_Finished == false))
    {
-      //trigger handling of Rx and Tx communication
-      s32_Return = this->m_Cycle(true, ou8_ExpectedServiceId, &orc_Service);
+      if (mq_SyncResponseReceived == true)
+      {
+         //received by another thread while we were waiting
+         orc_Service = mc_SyncResponse;
+         mq_SyncResponseReceived = false;
+         s32_Return = C_NO_ERR;
+      }
+      else
+      {
+         //trigger handling of Rx and Tx communication
+         s32_Return = this->m_Cycle(true, ou8_ExpectedServiceId, &orc_Service);
+      }
       if (s32_Return == C_NO_ERR)
       {
          u16_RxSize = static_cast<uint16_t>(orc_Service.c_Data.size());
@@ -550,9 +593,17 @@ int32_t C_OscProtocolDriverOsy::m_PollForSpecificServiceResponse(const uint8_t o
 
       if (q_Finished == false)
       {
-         stw::tgl::TglSleep(0U); //rescind CPU time to other threads ...
+         //sleep until something comes in; this also rescinds CPU time to other threads ...
+         const uint32_t u32_Now = stw::tgl::TglGetTickCount();
+         const uint32_t u32_End = u32_StartTime + mu32_TimeoutPollingMs;
+         //do not block other threads handling asynchronous requests while waiting
+         mc_LockReception.Release();
+         this->m_WaitForTransport((u32_Now < u32_End) ? (u32_End - u32_Now) : 0U);
+         mc_LockReception.Acquire();
       }
    }
+   mq_SyncPollActive = false;
+   mq_SyncResponseReceived = false;
    mc_LockReception.Release();
 
    if (s32_Return == C_COM)
@@ -2198,6 +2249,7 @@ int32_t C_OscProtocolDriverOsy::OsyReadDataPoolData(const uint8_t ou8_DataPoolIn
          }
          else
          {
+            this->m_NoteSyncDataPoolRequestSent();
             s32_Return = m_PollForSpecificServiceResponse(mhu8_OSY_SI_READ_DATA_POOL_DATA_BY_ID, 4U, c_Response,
                                                           u8_NrErrorCode, false);
             switch (s32_Return)
@@ -2305,6 +2357,7 @@ int32_t C_OscProtocolDriverOsy::OsyWriteDataPoolData(const uint8_t ou8_DataPoolI
          }
          else
          {
+            this->m_NoteSyncDataPoolRequestSent();
             s32_Return = m_PollForSpecificServiceResponse(mhu8_OSY_SI_WRITE_DATA_POOL_DATA_BY_ID, 4U, c_Response,
                                                           u8_NrErrorCode, true);
             switch (s32_Return)
@@ -2341,6 +2394,129 @@ int32_t C_OscProtocolDriverOsy::OsyWriteDataPoolData(const uint8_t ou8_DataPoolI
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   ReadDataPoolDataByIdentifier service implementation (asynchronous)
+
+   Queue request and return immediately.
+   The request is sent and its response handled by HandleAsyncRequests() resp. Cycle().
+   The result is reported via opr_OnFinished with:
+   C_NO_ERR   positive response received; read data passed as orc_ReadData
+   C_TIMEOUT  expected response not received within timeout
+   C_WARN     error response (negative response code passed as ou8_NrCode)
+   C_NOACT    request was cancelled with CancelAsyncRequests()
+
+   \param[in]  ou8_DataPoolIndex  index of data pool to read from (0..31)
+   \param[in]  ou16_ListIndex     list index to read from (0..127)
+   \param[in]  ou16_ElementIndex  element index to read (0..2047)
+   \param[in]  opr_OnFinished     function to report the result to (may be NULL)
+   \param[in]  opv_Instance       instance pointer to pass to opr_OnFinished
+   \param[out] opu32_RequestId    if != NULL: ID of request as reported to opr_OnFinished
+
+   \return
+   C_NO_ERR   request queued
+   C_RANGE    data pool, list or element index out of range
+   C_CONFIG   no transport protocol installed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscProtocolDriverOsy::OsyReadDataPoolDataAsync(const uint8_t ou8_DataPoolIndex, const uint16_t ou16_ListIndex,
+                                                         const uint16_t ou16_ElementIndex,
+                                                         const PR_OsyServiceFinished opr_OnFinished,
+                                                         void * const opv_Instance, uint32_t * const opu32_RequestId)
+{
+   int32_t s32_Return;
+
+   if (mpc_TransportProtocol == NULL)
+   {
+      s32_Return = C_CONFIG;
+   }
+   else
+   {
+      uint8_t au8_Identifier[3];
+      s32_Return = m_PackDataPoolIdentifier(ou8_DataPoolIndex, ou16_ListIndex, ou16_ElementIndex, au8_Identifier);
+      if (s32_Return != C_NO_ERR)
+      {
+         s32_Return = C_RANGE;
+      }
+      else
+      {
+         C_OscProtocolDriverOsyService c_Request;
+         c_Request.c_Data.resize(4);
+         c_Request.c_Data[0] = mhu8_OSY_SI_READ_DATA_POOL_DATA_BY_ID;
+         c_Request.c_Data[1] = au8_Identifier[0];
+         c_Request.c_Data[2] = au8_Identifier[1];
+         c_Request.c_Data[3] = au8_Identifier[2];
+         s32_Return = m_AddAsyncRequest(c_Request, opr_OnFinished, opv_Instance, opu32_RequestId);
+      }
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   WriteDataPoolDataByIdentifier service implementation (asynchronous)
+
+   Queue request and return immediately.
+   The request is sent and its response handled by HandleAsyncRequests() resp. Cycle().
+   The result is reported via opr_OnFinished with:
+   C_NO_ERR   positive response received
+   C_TIMEOUT  expected response not received within timeout
+   C_WARN     error response (negative response code passed as ou8_NrCode)
+   C_RD_WR    unexpected content in response (here: wrong length)
+   C_NOACT    request was cancelled with CancelAsyncRequests()
+
+   \param[in]  ou8_DataPoolIndex  index of data pool to write to (0..31)
+   \param[in]  ou16_ListIndex     list index to write to (0..127)
+   \param[in]  ou16_ElementIndex  element index to write (0..2047)
+   \param[in]  orc_DataToWrite    data to write
+   \param[in]  opr_OnFinished     function to report the result to (may be NULL)
+   \param[in]  opv_Instance       instance pointer to pass to opr_OnFinished
+   \param[out] opu32_RequestId    if != NULL: ID of request as reported to opr_OnFinished
+
+   \return
+   C_NO_ERR   request queued
+   C_RANGE    data pool, list or element index out of range; length of data zero
+   C_CONFIG   no transport protocol installed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscProtocolDriverOsy::OsyWriteDataPoolDataAsync(const uint8_t ou8_DataPoolIndex,
+                                                          const uint16_t ou16_ListIndex,
+                                                          const uint16_t ou16_ElementIndex,
+                                                          const std::vector<uint8_t> & orc_DataToWrite,
+                                                          const PR_OsyServiceFinished opr_OnFinished,
+                                                          void * const opv_Instance, uint32_t * const opu32_RequestId)
+{
+   int32_t s32_Return;
+
+   if (mpc_TransportProtocol == NULL)
+   {
+      s32_Return = C_CONFIG;
+   }
+   else if (orc_DataToWrite.size() == 0)
+   {
+      s32_Return = C_RANGE;
+   }
+   else
+   {
+      uint8_t au8_Identifier[3];
+      s32_Return = m_PackDataPoolIdentifier(ou8_DataPoolIndex, ou16_ListIndex, ou16_ElementIndex, au8_Identifier);
+      if (s32_Return != C_NO_ERR)
+      {
+         s32_Return = C_RANGE;
+      }
+      else
+      {
+         C_OscProtocolDriverOsyService c_Request;
+         c_Request.c_Data.resize(4 + orc_DataToWrite.size());
+         c_Request.c_Data[0] = mhu8_OSY_SI_WRITE_DATA_POOL_DATA_BY_ID;
+         c_Request.c_Data[1] = au8_Identifier[0];
+         c_Request.c_Data[2] = au8_Identifier[1];
+         c_Request.c_Data[3] = au8_Identifier[2];
+         (void)std::memcpy(&c_Request.c_Data[4], &orc_DataToWrite[0], orc_DataToWrite.size());
+         s32_Return = m_AddAsyncRequest(c_Request, opr_OnFinished, opv_Instance, opu32_RequestId);
+      }
+   }
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   WriteDataPoolEventDataRate service request implementation
 
@@ -3155,7 +3331,7 @@ int32_t C_OscProtocolDriverOsy::OsySendCanMessage(const uint8_t ou8_ChannelIndex
    if ((orc_CanMessage.u8_RTR != 0U) || (orc_CanMessage.u8_XTD > 1U) ||
        ((orc_CanMessage.u8_XTD == 0U) && (orc_CanMessage.u32_ID > 0x7FFU)) ||
        ((orc_CanMessage.u8_XTD == 1U) && (orc_CanMessage.u32_ID > 0x3FFFFFFFU)) ||
-       (orc_CanMessage.u8_DLC > 8U))
+       (orc_CanMessage.u8_DLC > 8U) || (orc_CanMessage.u8_FDF != 0U))
    {
       s32_Return = C_RANGE;
    }
@@ -3473,7 +3649,9 @@ void C_OscProtocolDriverOsy::ClearDataPoolMapping(void)
    * Invoke virtual functions to report all incoming event driven responses.
      If a non event-driven response is received the function will return,
      otherwise it will continue to read all incoming responses from the Rx queue.
+   * Handle queued asynchronous requests (see HandleAsyncRequests())
    * Relinquish exclusive access to reception handling
+   * Report finished asynchronous requests
 
    If reception is already in progress the function will return with no action.
 
@@ -3491,7 +3669,7 @@ int32_t C_OscProtocolDriverOsy::Cycle(void)
 
    if (q_LockClaimed == true)
    {
-      s32_Return = this->m_Cycle();
+      s32_Return = this->m_CycleAsyncRequests();
       if ((s32_Return != C_CONFIG) && (s32_Return != C_COM))
       {
          // Only C_CONFIG is relevant for an extern call
@@ -3499,10 +3677,541 @@ int32_t C_OscProtocolDriverOsy::Cycle(void)
       }
       mc_LockReception.Release();
    }
+   this->m_ReportFinishedAsyncRequests();
 
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Handle queued asynchronous requests
+
+   Send queued asynchronous requests and handle their responses until
+   - all requests are finished or
+   - ou32_MaxWaitTimeMs has passed
+
+   Inbetween the calling thread is put to sleep on the transport protocol.
+   Results are reported via the callback functions passed when queuing the requests.
+   The callbacks are invoked from within this function without holding any locks.
+   So they may queue new asynchronous requests or call other services.
+
+   Event-driven responses are reported as with Cycle().
+
+   \param[in]  ou32_MaxWaitTimeMs   maximum time to wait for requests to finish (0: only cycle once)
+
+   \return
+   C_NO_ERR   no more requests pending
+   C_BUSY     there are still requests pending
+   C_CONFIG   no transport protocol installed
+   C_COM      communication driver reported error
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscProtocolDriverOsy::HandleAsyncRequests(const uint32_t ou32_MaxWaitTimeMs)
+{
+   int32_t s32_Return = C_NO_ERR;
+   const uint32_t u32_StartTime = stw::tgl::TglGetTickCount();
+   bool q_Continue = true;
+
+   while (q_Continue == true)
+   {
+      mc_LockReception.Acquire();
+      s32_Return = this->m_CycleAsyncRequests();
+      mc_LockReception.Release();
+      this->m_ReportFinishedAsyncRequests();
+
+      if ((s32_Return == C_CONFIG) || (s32_Return == C_COM))
+      {
+         q_Continue = false;
+      }
+      else
+      {
+         s32_Return = C_NO_ERR;
+         if (this->GetNumPendingAsyncRequests() == 0U)
+         {
+            q_Continue = false;
+         }
+         else
+         {
+            const uint32_t u32_Elapsed = stw::tgl::TglGetTickCount() - u32_StartTime;
+            if (u32_Elapsed >= ou32_MaxWaitTimeMs)
+            {
+               s32_Return = C_BUSY;
+               q_Continue = false;
+            }
+            else
+            {
+               this->m_WaitForTransport(ou32_MaxWaitTimeMs - u32_Elapsed);
+            }
+         }
+      }
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Handle queued asynchronous requests of multiple drivers
+
+   Drive the asynchronous requests of multiple drivers (e.g. one per node) from one thread.
+   As each server handles its requests sequentially, this keeps one request per node in flight at any time.
+
+   Waits on the transport protocol of the first driver that still has pending requests.
+   If the drivers do not share the same transport (e.g. IP connections) the latency for the other drivers
+    is limited by the transport wait slice.
+
+   \param[in]  orc_Drivers          drivers to handle (NULL entries are skipped)
+   \param[in]  ou32_MaxWaitTimeMs   maximum time to wait for requests to finish (0: only cycle once)
+
+   \return
+   C_NO_ERR   no more requests pending for any driver
+   C_BUSY     there are still requests pending
+   C_CONFIG   at least one driver has no transport protocol installed
+   C_COM      at least one communication driver reported error
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscProtocolDriverOsy::h_HandleAsyncRequests(const std::vector<C_OscProtocolDriverOsy *> & orc_Drivers,
+                                                      const uint32_t ou32_MaxWaitTimeMs)
+{
+   int32_t s32_Return = C_NO_ERR;
+   const uint32_t u32_StartTime = stw::tgl::TglGetTickCount();
+   bool q_Continue = true;
+
+   while (q_Continue == true)
+   {
+      C_OscProtocolDriverOsy * pc_PendingDriver = NULL;
+
+      s32_Return = C_NO_ERR;
+      for (uint32_t u32_Driver = 0U; u32_Driver < orc_Drivers.size(); u32_Driver++)
+      {
+         C_OscProtocolDriverOsy * const pc_Driver = orc_Drivers[u32_Driver];
+         if (pc_Driver != NULL)
+         {
+            const int32_t s32_Result = pc_Driver->HandleAsyncRequests(0U);
+            if (s32_Result == C_BUSY)
+            {
+               if (pc_PendingDriver == NULL)
+               {
+                  pc_PendingDriver = pc_Driver;
+               }
+            }
+            else if (s32_Result != C_NO_ERR)
+            {
+               s32_Return = s32_Result;
+            }
+            else
+            {
+               //nothing pending for this one
+            }
+         }
+      }
+
+      if (pc_PendingDriver == NULL)
+      {
+         q_Continue = false;
+      }
+      else
+      {
+         const uint32_t u32_Elapsed = stw::tgl::TglGetTickCount() - u32_StartTime;
+         if (u32_Elapsed >= ou32_MaxWaitTimeMs)
+         {
+            if (s32_Return == C_NO_ERR)
+            {
+               s32_Return = C_BUSY;
+            }
+            q_Continue = false;
+         }
+         else
+         {
+            pc_PendingDriver->m_WaitForTransport(ou32_MaxWaitTimeMs - u32_Elapsed);
+         }
+      }
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of pending asynchronous requests
+
+   \return
+   number of queued asynchronous requests that are not finished yet (including the one in flight)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscProtocolDriverOsy::GetNumPendingAsyncRequests(void)
+{
+   uint32_t u32_NumPending;
+
+   mc_LockAsyncRequests.Acquire();
+   u32_NumPending = static_cast<uint32_t>(mc_AsyncRequests.size());
+   mc_LockAsyncRequests.Release();
+   return u32_NumPending;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Cancel all pending asynchronous requests
+
+   All pending requests are reported as finished with result C_NOACT.
+   Late responses to a request already in flight are discarded for mhu32_ASYNC_DISCARD_TIME_MS.
+   Requests added in that time are sent after it has elapsed.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscProtocolDriverOsy::CancelAsyncRequests(void)
+{
+   const std::vector<uint8_t> c_NoData;
+
+   mc_LockAsyncRequests.Acquire();
+   this->m_DiscardAsyncRequestInFlight();
+   while (mc_AsyncRequests.empty() == false)
+   {
+      this->m_FinishAsyncRequest(C_NOACT, 0U, c_NoData);
+   }
+   mc_LockAsyncRequests.Release();
+   this->m_ReportFinishedAsyncRequests();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add request to queue of asynchronous requests
+
+   \param[in]   orc_Request       request to send
+   \param[in]   opr_OnFinished    function to report the result to (may be NULL)
+   \param[in]   opv_Instance      instance pointer to pass to opr_OnFinished
+   \param[out]  opu32_RequestId   if != NULL: ID of request as reported to opr_OnFinished
+
+   \return
+   C_NO_ERR   request queued
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscProtocolDriverOsy::m_AddAsyncRequest(const C_OscProtocolDriverOsyService & orc_Request,
+                                                  const PR_OsyServiceFinished opr_OnFinished,
+                                                  void * const opv_Instance, uint32_t * const opu32_RequestId)
+{
+   C_AsyncRequest c_Request;
+
+   c_Request.c_Request = orc_Request;
+   c_Request.pr_OnFinished = opr_OnFinished;
+   c_Request.pv_Instance = opv_Instance;
+
+   mc_LockAsyncRequests.Acquire();
+   c_Request.u32_RequestId = mu32_NextAsyncRequestId;
+   mu32_NextAsyncRequestId++;
+   mc_AsyncRequests.push_back(c_Request);
+   mc_LockAsyncRequests.Release();
+
+   if (opu32_RequestId != NULL)
+   {
+      (*opu32_RequestId) = c_Request.u32_RequestId;
+   }
+   return C_NO_ERR;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Perform one cycle of asynchronous request handling
+
+   * send next request if none is in flight
+   * handle transport protocol and incoming responses (see m_Cycle())
+     If a synchronous request waits for its response (mq_SyncPollActive) that response is handed over
+     in mc_SyncResponse. Once one was handed over the Rx queue is left to the waiting thread.
+   * check for timeout of request in flight and start the next one
+
+   Caller is responsible for holding mc_LockReception.
+
+   \return
+   see m_Cycle()
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscProtocolDriverOsy::m_CycleAsyncRequests(void)
+{
+   int32_t s32_Return;
+
+   this->m_StartNextAsyncRequest();
+   if (mq_SyncPollActive == false)
+   {
+      s32_Return = this->m_Cycle();
+   }
+   else if (mq_SyncResponseReceived == false)
+   {
+      s32_Return = this->m_Cycle(true, mu8_SyncPollServiceId, &mc_SyncResponse);
+      if (s32_Return == C_NO_ERR)
+      {
+         mq_SyncResponseReceived = true;
+      }
+      else if (s32_Return == C_WARN)
+      {
+         //expected response not received (yet); all other responses were handled
+         s32_Return = C_NO_ERR;
+      }
+   }
+   else
+   {
+      s32_Return = C_NO_ERR;
+   }
+   this->m_CheckAsyncRequestTimeout();
+   this->m_StartNextAsyncRequest();
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Send next asynchronous request
+
+   If no request is in flight: put the next queued request in the transport protocol's Tx queue.
+   If that fails (e.g. Tx queue full) it will be retried with the next call.
+   While late responses to a cancelled request are discarded no request is sent.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscProtocolDriverOsy::m_StartNextAsyncRequest(void)
+{
+   mc_LockAsyncRequests.Acquire();
+   if ((mq_AsyncDiscardActive == true) &&
+       ((stw::tgl::TglGetTickCount() - mu32_AsyncDiscardStartTimeMs) > mhu32_ASYNC_DISCARD_TIME_MS))
+   {
+      mq_AsyncDiscardActive = false;
+   }
+   if ((mq_AsyncRequestInFlight == false) && (mq_AsyncDiscardActive == false) &&
+       (mc_AsyncRequests.empty() == false) && (mpc_TransportProtocol != NULL))
+   {
+      if (mpc_TransportProtocol->SendRequest(mc_AsyncRequests.front().c_Request) == C_NO_ERR)
+      {
+         mq_AsyncRequestInFlight = true;
+         mq_AsyncRequestSentBeforeSyncRequest = false;
+         mu32_AsyncRequestStartTimeMs = stw::tgl::TglGetTickCount();
+      }
+   }
+   mc_LockAsyncRequests.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check whether received service is the response to the asynchronous request in flight
+
+   Responses are matched by service ID and (for positive responses) data identifier.
+   Negative responses do not contain the data identifier. If a synchronous request with the same service ID is waiting
+    for its response the negative response is only taken if the asynchronous request was sent first
+    (the server handles requests strictly sequentially).
+   A "responsePending" negative response restarts the timeout.
+   Responses to a cancelled request are discarded while mq_AsyncDiscardActive is set.
+
+   \param[in]  orc_ReceivedService     received service
+   \param[in]  oq_SyncRequestPending   true: a synchronous request is waiting for a response to ou8_SyncServiceId
+   \param[in]  ou8_SyncServiceId       service ID the synchronous request is waiting for
+
+   \return
+   true    service was the response to the request in flight (or to the cancelled request) and has been handled
+   false   service is not related to the request in flight
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscProtocolDriverOsy::m_HandleAsyncRequestResponse(const C_OscProtocolDriverOsyService & orc_ReceivedService,
+                                                          const bool oq_SyncRequestPending,
+                                                          const uint8_t ou8_SyncServiceId)
+{
+   bool q_Handled = false;
+
+   mc_LockAsyncRequests.Acquire();
+   if ((mq_AsyncRequestInFlight == true) || (mq_AsyncDiscardActive == true))
+   {
+      //while discarding no new request is sent; so the cancelled request is the only one we can get responses for
+      const std::vector<uint8_t> & rc_Request = (mq_AsyncRequestInFlight == true) ?
+                                                mc_AsyncRequests.front().c_Request.c_Data : mc_AsyncDiscardRequest;
+      const std::vector<uint8_t> & rc_Response = orc_ReceivedService.c_Data;
+      const uint8_t u8_ServiceId = rc_Request[0];
+      const bool q_NrIsOurs = (oq_SyncRequestPending == false) || (ou8_SyncServiceId != u8_ServiceId) ||
+                              (mq_AsyncRequestSentBeforeSyncRequest == true);
+
+      if ((rc_Response.size() >= 3U) && (rc_Response[0] == mhu8_OSY_NR_SI) && (rc_Response[1] == u8_ServiceId) &&
+          (q_NrIsOurs == true))
+      {
+         q_Handled = true;
+         if (rc_Response[2] == hu8_NR_CODE_RESPONSE_PENDING)
+         {
+            if (mq_AsyncRequestInFlight == true)
+            {
+               mu32_AsyncRequestStartTimeMs = stw::tgl::TglGetTickCount();
+            }
+            else
+            {
+               //server is still working on it: keep discarding
+               mu32_AsyncDiscardStartTimeMs = stw::tgl::TglGetTickCount();
+            }
+         }
+         else if (mq_AsyncRequestInFlight == true)
+         {
+            const std::vector<uint8_t> c_NoData;
+            this->m_FinishAsyncRequest(C_WARN, rc_Response[2], c_NoData);
+         }
+         else
+         {
+            //final response to the cancelled request: nothing more to expect
+            mq_AsyncDiscardActive = false;
+         }
+      }
+      else if ((rc_Response.size() >= 4U) && (rc_Response[0] == (u8_ServiceId | 0x40U)) &&
+               (rc_Response[1] == rc_Request[1]) && (rc_Response[2] == rc_Request[2]) &&
+               (rc_Response[3] == rc_Request[3]))
+      {
+         q_Handled = true;
+         if (mq_AsyncRequestInFlight == false)
+         {
+            //late response to the cancelled request
+            mq_AsyncDiscardActive = false;
+         }
+         else if (u8_ServiceId == mhu8_OSY_SI_READ_DATA_POOL_DATA_BY_ID)
+         {
+            const std::vector<uint8_t> c_ReadData(rc_Response.begin() + 4, rc_Response.end());
+            this->m_FinishAsyncRequest(C_NO_ERR, 0U, c_ReadData);
+         }
+         else
+         {
+            //write: no payload expected
+            const std::vector<uint8_t> c_NoData;
+            this->m_FinishAsyncRequest((rc_Response.size() == 4U) ? C_NO_ERR : C_RD_WR, 0U, c_NoData);
+         }
+      }
+      else
+      {
+         //not related
+      }
+   }
+   mc_LockAsyncRequests.Release();
+   return q_Handled;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check for timeout of asynchronous request in flight
+
+   Timeout can be configured with SetTimeoutPolling()
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscProtocolDriverOsy::m_CheckAsyncRequestTimeout(void)
+{
+   mc_LockAsyncRequests.Acquire();
+   if ((mq_AsyncRequestInFlight == true) &&
+       ((stw::tgl::TglGetTickCount() - mu32_AsyncRequestStartTimeMs) > mu32_TimeoutPollingMs))
+   {
+      const std::vector<uint8_t> c_NoData;
+      this->m_DiscardAsyncRequestInFlight();
+      this->m_FinishAsyncRequest(C_TIMEOUT, 0U, c_NoData);
+   }
+   mc_LockAsyncRequests.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Start discarding late responses to the asynchronous request in flight
+
+   Remembers service ID and data identifier of the request in flight so a late response to it is not taken for
+    the response to the next request.
+   Caller is responsible for holding mc_LockAsyncRequests and for finishing the request.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscProtocolDriverOsy::m_DiscardAsyncRequestInFlight(void)
+{
+   if (mq_AsyncRequestInFlight == true)
+   {
+      const std::vector<uint8_t> & rc_Request = mc_AsyncRequests.front().c_Request.c_Data;
+      mc_AsyncDiscardRequest.assign(rc_Request.begin(), rc_Request.begin() + 4);
+      mq_AsyncDiscardActive = true;
+      mu32_AsyncDiscardStartTimeMs = stw::tgl::TglGetTickCount();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Remember order of synchronous data pool request and asynchronous request in flight
+
+   To be called after a synchronous data pool read or write request was sent.
+   Negative responses to a request in flight sent before belong to that request (see m_HandleAsyncRequestResponse()).
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscProtocolDriverOsy::m_NoteSyncDataPoolRequestSent(void)
+{
+   mc_LockAsyncRequests.Acquire();
+   mq_AsyncRequestSentBeforeSyncRequest = (mq_AsyncRequestInFlight == true) || (mq_AsyncDiscardActive == true);
+   mc_LockAsyncRequests.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Finish first pending asynchronous request
+
+   Move the first pending request to the queue of finished requests.
+   Caller is responsible for holding mc_LockAsyncRequests and for making sure there is a pending request.
+
+   \param[in]  os32_Result    result to report
+   \param[in]  ou8_NrCode     negative response code to report
+   \param[in]  orc_ReadData   read data to report
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscProtocolDriverOsy::m_FinishAsyncRequest(const int32_t os32_Result, const uint8_t ou8_NrCode,
+                                                  const std::vector<uint8_t> & orc_ReadData)
+{
+   C_AsyncRequest & rc_Request = mc_AsyncRequests.front();
+
+   rc_Request.s32_Result = os32_Result;
+   rc_Request.u8_NrCode = ou8_NrCode;
+   rc_Request.c_ReadData = orc_ReadData;
+   mc_AsyncRequestsFinished.push_back(rc_Request);
+   mc_AsyncRequests.pop_front();
+   mq_AsyncRequestInFlight = false;
+
+   if ((os32_Result != C_NO_ERR) && (os32_Result != C_NOACT))
+   {
+      m_LogServiceError((rc_Request.c_Request.c_Data[0] == mhu8_OSY_SI_READ_DATA_POOL_DATA_BY_ID) ?
+                        "ReadDataPoolDataAsync" : "WriteDataPoolDataAsync", os32_Result, ou8_NrCode);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Report finished asynchronous requests
+
+   Invoke the callbacks of all finished requests.
+   Must be called without holding mc_LockReception so the callbacks can use the services of this class.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscProtocolDriverOsy::m_ReportFinishedAsyncRequests(void)
+{
+   bool q_Finished = false;
+
+   while (q_Finished == false)
+   {
+      C_AsyncRequest c_Request;
+
+      mc_LockAsyncRequests.Acquire();
+      if (mc_AsyncRequestsFinished.empty() == true)
+      {
+         q_Finished = true;
+      }
+      else
+      {
+         c_Request = mc_AsyncRequestsFinished.front();
+         mc_AsyncRequestsFinished.pop_front();
+      }
+      mc_LockAsyncRequests.Release();
+
+      if ((q_Finished == false) && (c_Request.pr_OnFinished != NULL))
+      {
+         c_Request.pr_OnFinished(c_Request.pv_Instance, c_Request.u32_RequestId, c_Request.s32_Result,
+                                 c_Request.c_ReadData, c_Request.u8_NrCode);
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wait for incoming communication
+
+   Put the calling thread to sleep on the transport protocol until there is something to handle.
+   Waits for a maximum of mhu32_TRANSPORT_WAIT_SLICE_MS as another thread might handle the incoming communication.
+   If the transport protocol does not support waiting the CPU time is rescinded to other threads instead.
+
+   \param[in]  ou32_MaxWaitTimeMs   maximum time to wait
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscProtocolDriverOsy::m_WaitForTransport(const uint32_t ou32_MaxWaitTimeMs)
+{
+   int32_t s32_Return = C_NOACT;
+
+   if (mpc_TransportProtocol != NULL)
+   {
+      s32_Return = mpc_TransportProtocol->WaitForIncoming((ou32_MaxWaitTimeMs < mhu32_TRANSPORT_WAIT_SLICE_MS) ?
+                                                          ou32_MaxWaitTimeMs : mhu32_TRANSPORT_WAIT_SLICE_MS);
+   }
+   if ((s32_Return != C_NO_ERR) && (s32_Return != C_TIMEOUT))
+   {
+      stw::tgl::TglSleep(0U); //rescind CPU time to other threads ...
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Handle async reception of ReadDataPoolEventDriven response
 
@@ -4231,8 +4940,9 @@ int32_t C_OscProtocolDriverOsy::m_HandleAsyncOsyTunnelCanMessagesEvent(
       // 11 bit identifier range check
       if ((c_CanMessage.u8_XTD == 1U) || (c_CanMessage.u32_ID <= 0x7FFU))
       {
-         // RTR is not supported
+         // RTR and CAN FD are not supported
          c_CanMessage.u8_RTR = 0U;
+         c_CanMessage.u8_FDF = 0U;
 
          // Fill the struct
          c_CanMessage.u8_DLC = orc_ReceivedService.c_Data[5];
@@ -91,6 +91,8 @@ protected:
    int32_t m_AddToRxQueue(const C_OscProtocolDriverOsyService & orc_Service);
    int32_t m_GetFromTxQueue(C_OscProtocolDriverOsyService & orc_Service);
    int32_t m_GetFromRxQueue(C_OscProtocolDriverOsyService & orc_Service);
+   bool m_IsTxQueueEmpty(void);
+   bool m_IsRxQueueEmpty(void);
 
 public:
    ///common parameters for the different transport protocols
@@ -129,6 +131,7 @@ public:
    */
    //-----------------------------------------------------------------------------
    virtual int32_t Cycle(void) = 0;
+   virtual int32_t WaitForIncoming(const uint32_t ou32_TimeoutMs);
    virtual int32_t SetNodeIdentifiers(const C_OscProtocolDriverOsyNode & orc_ClientIdentifier,
                                       const C_OscProtocolDriverOsyNode & orc_ServerIdentifier);
    virtual void GetNodeIdentifiers(C_OscProtocolDriverOsyNode & orc_ClientIdentifier,
@@ -135,6 +135,7 @@ public:
    virtual ~C_OscProtocolDriverOsyTpIp(void);
 
    virtual int32_t Cycle(void);
+   virtual int32_t WaitForIncoming(const uint32_t ou32_TimeoutMs);
 
    //Tp-specific functions:
    int32_t SetDispatcher(C_OscIpDispatcher * const opc_Dispatcher, const uint32_t ou32_DispatcherHandle);
@@ -88,6 +88,16 @@ bool C_OscComMessageLoggerFilter::operator ==(const C_OscComMessageLoggerFilter
    return q_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscComMessageLogger::C_OsySysDefMessageRef::C_OsySysDefMessageRef(void) :
+   pc_Message(NULL),
+   pc_DataPoolList(NULL)
+{
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Default constructor
 */
@@ -104,6 +114,7 @@ C_OscComMessageLogger::C_OscComMessageLogger(void) :
 {
    // Resize the vector for all potential CAN standard ids
    this->mc_MsgCounterStandardId.resize(0x800U, 0U);
+   this->mc_OsySysDefIndexStandardId.resize(0x800U);
 
    this->mc_ProtocolHex.SetDecimalMode(false);
    this->mc_ProtocolDec.SetDecimalMode(true);
@@ -375,6 +386,7 @@ int32_t C_OscComMessageLogger::SetOsySysDefBus(const C_SclString & orc_PathSyste
           (c_ItSysDef->second.c_OsySysDef.c_Buses[ou32_BusIndex].e_Type == C_OscSystemBus::eCAN))
       {
          c_ItSysDef->second.u32_BusIndex = ou32_BusIndex;
+         this->m_UpdateOsySysDefIndex();
          s32_Return = C_NO_ERR;
       }
       else
@@ -440,6 +452,7 @@ int32_t C_OscComMessageLogger::RemoveDatabase(const C_SclString & orc_Path)
 
       // Remove the entry
       this->mc_OsySysDefs.erase(c_ItSysDef);
+      this->m_UpdateOsySysDefIndex();
 
       s32_Return = C_NO_ERR;
    }
@@ -486,6 +499,7 @@ int32_t C_OscComMessageLogger::ActivateDatabase(const C_SclString & orc_Path, co
             this->mc_ProtocolDec.RemoveOsySysDef(&(c_ItSysDef->second));
             this->mc_ProtocolHex.RemoveOsySysDef(&(c_ItSysDef->second));
          }
+         this->m_UpdateOsySysDefIndex();
       }
    }
 
@@ -917,6 +931,8 @@ void C_OscComMessageLogger::m_InsertOsySysDef(const C_SclString & orc_PathSystem
 
    this->mc_ProtocolDec.AddOsySysDef(&(c_ItNewConfig->second));
    this->mc_ProtocolHex.AddOsySysDef(&(c_ItNewConfig->second));
+
+   this->m_UpdateOsySysDefIndex();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -925,6 +941,8 @@ void C_OscComMessageLogger::m_InsertOsySysDef(const C_SclString & orc_PathSystem
    The result will be saved to mpc_OsySysDefMessage and mpc_OsySysDefDataPoolList.
    If mpc_OsySysDefMessage and mpc_OsySysDefDataPoolList is NULL, no CAN message found in any system definition.
 
+   Uses the CAN ID lookup prepared by m_UpdateOsySysDefIndex.
+
    \param[in] orc_Msg CAN message for analyzing
 
    \return
@@ -934,148 +952,183 @@ void C_OscComMessageLogger::m_InsertOsySysDef(const C_SclString & orc_PathSystem
 //----------------------------------------------------------------------------------------------------------------------
 bool C_OscComMessageLogger::m_CheckSysDef(const T_STWCAN_Msg_RX & orc_Msg)
 {
-   bool q_Return = false;
+   const C_OsySysDefMessageRef * pc_Ref = NULL;
+
+   if (orc_Msg.u8_XTD == 0U)
+   {
+      if (orc_Msg.u32_ID < this->mc_OsySysDefIndexStandardId.size())
+      {
+         pc_Ref = &this->mc_OsySysDefIndexStandardId[orc_Msg.u32_ID];
+      }
+   }
+   else
+   {
+      const std::map<uint32_t, C_OsySysDefMessageRef>::const_iterator c_ItRef =
+         this->mc_OsySysDefIndexExtendedId.find(orc_Msg.u32_ID);
+      if (c_ItRef != this->mc_OsySysDefIndexExtendedId.end())
+      {
+         pc_Ref = &c_ItRef->second;
+      }
+   }
+
+   if (pc_Ref != NULL)
+   {
+      this->mpc_OsySysDefMessage = pc_Ref->pc_Message;
+      this->mpc_OsySysDefDataPoolList = pc_Ref->pc_DataPoolList;
+   }
+   else
+   {
+      this->mpc_OsySysDefMessage = NULL;
+      this->mpc_OsySysDefDataPoolList = NULL;
+   }
+
+   return (this->mpc_OsySysDefDataPoolList != NULL);
+}
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Rebuild CAN ID lookup of all active openSYDE system definitions
+
+   Must be called whenever a system definition is added or removed, activated or deactivated or its bus is changed.
+
+   If a CAN ID is used by more than one message the first one found wins; the search order is:
+   system definitions (by path), nodes, protocols, TX messages then RX messages (CANopen only).
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLogger::m_UpdateOsySysDefIndex(void)
+{
    std::map<stw::scl::C_SclString, C_OscComMessageLoggerOsySysDefConfig>::const_iterator c_ItSysDef;
 
-   this->mpc_OsySysDefMessage = NULL;
-   this->mpc_OsySysDefDataPoolList = NULL;
+   std::fill(this->mc_OsySysDefIndexStandardId.begin(), this->mc_OsySysDefIndexStandardId.end(),
+             C_OsySysDefMessageRef());
+   this->mc_OsySysDefIndexExtendedId.clear();
 
    for (c_ItSysDef = this->mc_OsySysDefs.begin(); c_ItSysDef != this->mc_OsySysDefs.end(); ++c_ItSysDef)
    {
       // Check if the database is active
-      if (this->mc_DatabaseActiveFlags[c_ItSysDef->first] == true)
+      const std::map<stw::scl::C_SclString, bool>::const_iterator c_ItFlag =
+         this->mc_DatabaseActiveFlags.find(c_ItSysDef->first);
+      if ((c_ItFlag != this->mc_DatabaseActiveFlags.end()) && (c_ItFlag->second == true))
+      {
+         this->m_AddOsySysDefToIndex(c_ItSysDef->second);
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Add all messages of one openSYDE system definition on its configured bus to the CAN ID lookup
+
+   \param[in]  orc_SysDefConfig   System definition with configured bus
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLogger::m_AddOsySysDefToIndex(const C_OscComMessageLoggerOsySysDefConfig & orc_SysDefConfig)
+{
+   const C_OscSystemDefinition & rc_OsySysDef = orc_SysDefConfig.c_OsySysDef;
+   uint32_t u32_NodeCounter;
+
+   // Search all nodes which are connected to to the CAN bus
+   for (u32_NodeCounter = 0U; u32_NodeCounter < rc_OsySysDef.c_Nodes.size(); ++u32_NodeCounter)
+   {
+      const C_OscNode & rc_Node = rc_OsySysDef.c_Nodes[u32_NodeCounter];
+      uint32_t u32_IntfCounter;
+      bool q_IntfFound = false;
+
+      // Search an interface which is connected to the bus
+      for (u32_IntfCounter = 0U; u32_IntfCounter < rc_Node.c_Properties.c_ComInterfaces.size(); ++u32_IntfCounter)
+      {
+         if ((rc_Node.c_Properties.c_ComInterfaces[u32_IntfCounter].GetBusConnected() == true) &&
+             (rc_Node.c_Properties.c_ComInterfaces[u32_IntfCounter].u32_BusIndex == orc_SysDefConfig.u32_BusIndex))
+         {
+            // Com Interface found
+            q_IntfFound = true;
+            break;
+         }
+      }
+
+      if (q_IntfFound == true)
       {
-         const C_OscSystemDefinition & rc_OsySysDef = c_ItSysDef->second.c_OsySysDef;
-         uint32_t u32_NodeCounter;
+         // Add all messages of the node for this interface on this bus
+         uint32_t u32_ProtCounter;
 
-         // Search all nodes which are connected to to the CAN bus
-         for (u32_NodeCounter = 0U; u32_NodeCounter < rc_OsySysDef.c_Nodes.size(); ++u32_NodeCounter)
+         for (u32_ProtCounter = 0U; u32_ProtCounter < rc_Node.c_ComProtocols.size(); ++u32_ProtCounter)
          {
-            const C_OscNode & rc_Node = rc_OsySysDef.c_Nodes[u32_NodeCounter];
-            uint32_t u32_IntfCounter;
-            bool q_IntfFound = false;
+            const C_OscCanProtocol & rc_CanProt = rc_Node.c_ComProtocols[u32_ProtCounter];
 
-            // Search an interface which is connected to the bus
-            for (u32_IntfCounter = 0U; u32_IntfCounter < rc_Node.c_Properties.c_ComInterfaces.size(); ++u32_IntfCounter)
+            tgl_assert(u32_IntfCounter < rc_CanProt.c_ComMessages.size());
+            if (u32_IntfCounter < rc_CanProt.c_ComMessages.size())
             {
-               if ((rc_Node.c_Properties.c_ComInterfaces[u32_IntfCounter].GetBusConnected() == true) &&
-                   (rc_Node.c_Properties.c_ComInterfaces[u32_IntfCounter].u32_BusIndex ==
-                    c_ItSysDef->second.u32_BusIndex))
+               const std::vector<C_OscCanMessage> & rc_CanMsgContainerTx =
+                  rc_CanProt.c_ComMessages[u32_IntfCounter].c_TxMessages;
+               const C_OscNodeDataPoolList * pc_ListTx = NULL;
+               const C_OscNodeDataPoolList * pc_ListRx = NULL;
+               uint32_t u32_CanMsgCounter;
+
+               // Get the associated lists
+               tgl_assert(rc_CanProt.u32_DataPoolIndex < rc_Node.c_DataPools.size());
+               if (rc_CanProt.u32_DataPoolIndex < rc_Node.c_DataPools.size())
                {
-                  // Com Interface found
-                  q_IntfFound = true;
-                  break;
+                  pc_ListTx = C_OscCanProtocol::h_GetComListConst(rc_Node.c_DataPools[rc_CanProt.u32_DataPoolIndex],
+                                                                  u32_IntfCounter, true);
+                  pc_ListRx = C_OscCanProtocol::h_GetComListConst(rc_Node.c_DataPools[rc_CanProt.u32_DataPoolIndex],
+                                                                  u32_IntfCounter, false);
+                  tgl_assert((pc_ListTx != NULL) && (pc_ListRx != NULL));
                }
-            }
-
-            if (q_IntfFound == true)
-            {
-               // Check all messages of the node for this interface on this bus
-               uint32_t u32_ProtCounter;
 
-               for (u32_ProtCounter = 0U; u32_ProtCounter < rc_Node.c_ComProtocols.size(); ++u32_ProtCounter)
+               for (u32_CanMsgCounter = 0U; u32_CanMsgCounter < rc_CanMsgContainerTx.size(); ++u32_CanMsgCounter)
                {
-                  const C_OscCanProtocol & rc_CanProt = rc_Node.c_ComProtocols[u32_ProtCounter];
+                  this->m_AddOsySysDefMessageToIndex(rc_CanMsgContainerTx[u32_CanMsgCounter], pc_ListTx);
+               }
 
-                  tgl_assert(u32_IntfCounter < rc_CanProt.c_ComMessages.size());
-                  if (u32_IntfCounter < rc_CanProt.c_ComMessages.size())
-                  {
-                     const std::vector<C_OscCanMessage> & rc_CanMsgContainerTx =
-                        rc_CanProt.c_ComMessages[u32_IntfCounter].c_TxMessages;
-                     bool q_SearchAlsoInRxMessages = true; // flag to improve performance
-                     uint32_t u32_CanMsgCounter;
-
-                     for (u32_CanMsgCounter = 0U; u32_CanMsgCounter < rc_CanMsgContainerTx.size(); ++u32_CanMsgCounter)
-                     {
-                        const C_OscCanMessage & rc_OscMsg = rc_CanMsgContainerTx[u32_CanMsgCounter];
-
-                        // No check of dlc here, it will be checked for each signal
-                        if ((orc_Msg.u32_ID == rc_OscMsg.u32_CanId) &&
-                            ((orc_Msg.u8_XTD == 1U) == rc_OscMsg.q_IsExtended))
-                        {
-                           // Message matches
-                           this->mpc_OsySysDefMessage = &rc_OscMsg;
-                           q_SearchAlsoInRxMessages = false; // found message, no need to search in Rx messages anymore
-
-                           // Get the associated list
-                           tgl_assert(rc_CanProt.u32_DataPoolIndex < rc_Node.c_DataPools.size());
-                           if (rc_CanProt.u32_DataPoolIndex < rc_Node.c_DataPools.size())
-                           {
-                              this->mpc_OsySysDefDataPoolList =
-                                 C_OscCanProtocol::h_GetComListConst(rc_Node.c_DataPools[rc_CanProt.u32_DataPoolIndex],
-                                                                     u32_IntfCounter, true);
-                              tgl_assert(this->mpc_OsySysDefDataPoolList != NULL);
-
-                              q_Return = true;
-                           }
-
-                           break;
-                        }
-                     }
-
-                     // Only in case of CANopen protocol we want to visualize TXPDO messages (sent from server to
-                     // client, RX messages from client view) and their signals in trace because this safes us a lot
-                     // of performance.
-                     // Trigger of this feature is: https://redmine.sensor-technik.de/issues/78633
-                     if ((rc_CanProt.e_Type == C_OscCanProtocol::eCAN_OPEN) && (q_SearchAlsoInRxMessages == true))
-                     {
-                        const std::vector<C_OscCanMessage> & rc_CanMsgContainerRx =
-                           rc_CanProt.c_ComMessages[u32_IntfCounter].c_RxMessages;
-                        uint32_t u32_CanMsgCounterRx;
-
-                        for (u32_CanMsgCounterRx = 0U; u32_CanMsgCounterRx < rc_CanMsgContainerRx.size();
-                             ++u32_CanMsgCounterRx)
-                        {
-                           const C_OscCanMessage & rc_OscMsg = rc_CanMsgContainerRx[u32_CanMsgCounterRx];
-
-                           // No check of dlc here, it will be checked for each signal
-                           if ((orc_Msg.u32_ID == rc_OscMsg.u32_CanId) &&
-                               ((orc_Msg.u8_XTD == 1U) == rc_OscMsg.q_IsExtended))
-                           {
-                              // Message matches
-                              this->mpc_OsySysDefMessage = &rc_OscMsg;
-
-                              // Get the associated list
-                              tgl_assert(rc_CanProt.u32_DataPoolIndex < rc_Node.c_DataPools.size());
-                              if (rc_CanProt.u32_DataPoolIndex < rc_Node.c_DataPools.size())
-                              {
-                                 this->mpc_OsySysDefDataPoolList =
-                                    C_OscCanProtocol::h_GetComListConst(
-                                       rc_Node.c_DataPools[rc_CanProt.u32_DataPoolIndex],
-                                       u32_IntfCounter, false);
-                                 tgl_assert(this->mpc_OsySysDefDataPoolList != NULL);
-
-                                 q_Return = true;
-                              }
-
-                              break;
-                           }
-                        }
-                     }
-                  }
+               // Only in case of CANopen protocol we want to visualize TXPDO messages (sent from server to
+               // client, RX messages from client view) and their signals in trace because this safes us a lot
+               // of performance.
+               // Trigger of this feature is: https://redmine.sensor-technik.de/issues/78633
+               if (rc_CanProt.e_Type == C_OscCanProtocol::eCAN_OPEN)
+               {
+                  const std::vector<C_OscCanMessage> & rc_CanMsgContainerRx =
+                     rc_CanProt.c_ComMessages[u32_IntfCounter].c_RxMessages;
 
-                  if (this->mpc_OsySysDefMessage != NULL)
+                  for (u32_CanMsgCounter = 0U; u32_CanMsgCounter < rc_CanMsgContainerRx.size(); ++u32_CanMsgCounter)
                   {
-                     break;
+                     this->m_AddOsySysDefMessageToIndex(rc_CanMsgContainerRx[u32_CanMsgCounter], pc_ListRx);
                   }
                }
             }
-
-            if (this->mpc_OsySysDefMessage != NULL)
-            {
-               break;
-            }
-         }
-
-         if (this->mpc_OsySysDefMessage != NULL)
-         {
-            break;
          }
       }
    }
+}
 
-   return q_Return;
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Add one message to the CAN ID lookup
+
+   Messages with an ID already registered are ignored (first one wins).
+
+   \param[in]  orc_Message         Message to add
+   \param[in]  opc_DataPoolList    COMM list containing the message's signals
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLogger::m_AddOsySysDefMessageToIndex(const C_OscCanMessage & orc_Message,
+                                                         const C_OscNodeDataPoolList * const opc_DataPoolList)
+{
+   C_OsySysDefMessageRef c_Ref;
+
+   c_Ref.pc_Message = &orc_Message;
+   c_Ref.pc_DataPoolList = opc_DataPoolList;
+
+   if (orc_Message.q_IsExtended == false)
+   {
+      if ((orc_Message.u32_CanId < this->mc_OsySysDefIndexStandardId.size()) &&
+          (this->mc_OsySysDefIndexStandardId[orc_Message.u32_CanId].pc_Message == NULL))
+      {
+         this->mc_OsySysDefIndexStandardId[orc_Message.u32_CanId] = c_Ref;
+      }
+   }
+   else
+   {
+      //insert does not replace existing entries
+      this->mc_OsySysDefIndexExtendedId.insert(std::pair<uint32_t, C_OsySysDefMessageRef>(orc_Message.u32_CanId,
+                                                                                           c_Ref));
+   }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1118,16 +1171,10 @@ bool C_OscComMessageLogger::m_InterpretSysDef(C_OscComMessageLoggerData & orc_Me
 
                if (rc_Signal.q_DlcError == false)
                {
-                  try
-                  {
-                     u16_MultiplexValue = static_cast<uint16_t>(rc_Signal.c_RawValueDec.ToInt());
-                     rc_Signal.c_Name += " (Multiplexer)";
-                     q_MultiplexerFound = true;
-                     u32_MultiplexerIndex = u32_Counter;
-                  }
-                  catch (...)
-                  {
-                  }
+                  u16_MultiplexValue = static_cast<uint16_t>(rc_Signal.u64_RawValue);
+                  rc_Signal.c_Name += " (Multiplexer)";
+                  q_MultiplexerFound = true;
+                  u32_MultiplexerIndex = u32_Counter;
                }
             }
             break;
@@ -1241,6 +1288,9 @@ bool C_OscComMessageLogger::m_CheckInterpretation(stw::opensyde_core::C_OscComMe
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Interprets the received CAN signal value
 
+   Only the raw value and the scaling information are stored. The strings are rendered on demand by
+   C_OscComMessageLoggerDataSignal.
+
    \param[in,out]     orc_Signal        Signal interpretation
    \param[in]         orau8_CanDb       RAW CAN message data
    \param[in]         ou8_CanDlc        DLC of CAN message
@@ -1261,54 +1311,30 @@ void C_OscComMessageLogger::mh_InterpretCanSignalValue(C_OscComMessageLoggerData
    if (q_SignalFits == true)
    {
       uint8_t u8_RawDataCounter;
-      std::vector<uint8_t> c_SignalRawData;
-      std::string c_StringValue;
-      C_OscNodeDataPoolContent c_OscValue = orc_OscValue;
+      std::vector<uint8_t> c_SignalRawData(orc_OscValue.GetSizeByte(), 0U);
       uint64_t u64_Value = 0U;
 
-      // Get the signal as raw value in the first step
-      c_SignalRawData.resize(c_OscValue.GetSizeByte());
+      // Get the signal as raw value; the signal data is converted to little endian by h_GetSignalValue
       C_OscCanUtil::h_GetSignalValue(orau8_CanDb, orc_OscSignal, c_SignalRawData, orc_OscValue.GetType());
-      // And the interpreted value
-      c_OscValue.SetValueFromLittleEndianBlob(c_SignalRawData);
 
-      // Raw values
-      // Signal data is converted to little endian by h_GetSignalValue
       for (u8_RawDataCounter = 0U; u8_RawDataCounter < c_SignalRawData.size(); ++u8_RawDataCounter)
       {
          const uint64_t u64_ShiftValue = static_cast<uint64_t>(u8_RawDataCounter) * 8U;
          u64_Value += static_cast<uint64_t>(c_SignalRawData[u8_RawDataCounter]) << u64_ShiftValue;
       }
 
-      if ((orc_OscValue.GetType() == C_OscNodeDataPoolContent::eFLOAT32) ||
-          (orc_OscValue.GetType() == C_OscNodeDataPoolContent::eFLOAT64))
-      {
-         // In case of a float value, the raw value does not make any sense in byte form.
-         // Use the value without scaling as raw value.
-         c_OscValue.GetValueAsScaledString(1.0, 0.0, c_StringValue, 0U, true, true);
-         orc_Signal.c_RawValueDec = c_StringValue.c_str();
-         orc_Signal.c_RawValueHex = c_StringValue.c_str();
-      }
-      else
-      {
-         orc_Signal.c_RawValueDec = C_SclString::IntToStr(u64_Value);
-         orc_Signal.c_RawValueHex = C_SclString::IntToHex(static_cast<int64_t>(u64_Value), 1).UpperCase();
-      }
-
-      // Interpreted value
-      c_OscValue.GetValueAsScaledString(of64_Factor, of64_Offset, c_StringValue, 0U, true, true);
-      orc_Signal.c_Value = c_StringValue.c_str();
+      orc_Signal.u64_RawValue = u64_Value;
    }
    else
    {
       // Signal is outside of the set data bytes (DLC is not big enough)
-      orc_Signal.c_RawValueDec = "N/A";
-      orc_Signal.c_RawValueHex = "N/A";
-      orc_Signal.c_Value = "N/A";
-
+      orc_Signal.u64_RawValue = 0U;
       orc_Signal.q_DlcError = true;
    }
 
+   orc_Signal.e_ValueType = orc_OscValue.GetType();
+   orc_Signal.f64_Factor = of64_Factor;
+   orc_Signal.f64_Offset = of64_Offset;
    orc_Signal.c_OscSignal = orc_OscSignal;
 }
 
@@ -1345,14 +1371,14 @@ C_SclString C_OscComMessageLogger::m_GetProtocolStringDecHook(void) const
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Fills instance mc_HandledCanMessage of C_OscComMessageLoggerData dependent of the current message
 
+   Only the binary information is filled. The text representation is rendered on demand by the consumers.
+
    \param[in] orc_Msg Current CAN message
    \param[in] oq_IsTx Message was sent of this application itself
 */
 //----------------------------------------------------------------------------------------------------------------------
 void C_OscComMessageLogger::m_ConvertCanMessage(const T_STWCAN_Msg_RX & orc_Msg, const bool oq_IsTx)
 {
-   uint8_t u8_DbCounter;
-
    // Clear not handled data in this function
    this->mc_HandledCanMessage.c_Name = "";
    this->mc_HandledCanMessage.c_ProtocolTextHex = "";
@@ -1360,43 +1386,10 @@ void C_OscComMessageLogger::m_ConvertCanMessage(const T_STWCAN_Msg_RX & orc_Msg,
    this->mc_HandledCanMessage.c_Signals.clear();
    this->mc_HandledCanMessage.q_CanDlcError = false;
 
-   // Save the L2 message. Needed for the interpretation partly
+   // Save the L2 message. Needed for the interpretation partly and as source for the text representation
    this->mc_HandledCanMessage.c_CanMsg = orc_Msg;
-
-   // Prepare the data for the ui
-   this->mc_HandledCanMessage.c_CanIdDec = C_SclString::IntToStr(orc_Msg.u32_ID);
-   this->mc_HandledCanMessage.c_CanIdHex = C_SclString::IntToHex(orc_Msg.u32_ID, 1).UpperCase();
-   if (orc_Msg.u8_XTD > 0U)
-   {
-      // Extended Id
-      this->mc_HandledCanMessage.c_CanIdDec += "x";
-      this->mc_HandledCanMessage.c_CanIdHex += "x";
-   }
-   this->mc_HandledCanMessage.c_CanDlc = C_SclString::IntToStr(orc_Msg.u8_DLC);
    this->mc_HandledCanMessage.q_IsTx = oq_IsTx;
 
-   this->mc_HandledCanMessage.c_CanDataDec = "";
-   this->mc_HandledCanMessage.c_CanDataHex = "";
-   for (u8_DbCounter = 0U; u8_DbCounter < orc_Msg.u8_DLC; ++u8_DbCounter)
-   {
-      if (orc_Msg.au8_Data[u8_DbCounter] < 100)
-      {
-         this->mc_HandledCanMessage.c_CanDataDec += " ";
-         if (orc_Msg.au8_Data[u8_DbCounter] < 10)
-         {
-            this->mc_HandledCanMessage.c_CanDataDec += " ";
-         }
-      }
-      this->mc_HandledCanMessage.c_CanDataDec += C_SclString::IntToStr(orc_Msg.au8_Data[u8_DbCounter]);
-      this->mc_HandledCanMessage.c_CanDataHex += C_SclString::IntToHex(orc_Msg.au8_Data[u8_DbCounter], 2).UpperCase();
-
-      if (u8_DbCounter < (orc_Msg.u8_DLC - 1U))
-      {
-         this->mc_HandledCanMessage.c_CanDataDec += " ";
-         this->mc_HandledCanMessage.c_CanDataHex += " ";
-      }
-   }
-
    // It is possible that communication between a tool on the same CAN bus on the virtual side and a real
    // hardware communication partner cause a problem in the CAN message order.
    // The internal send CAN messages can be seen by other tools on the same internal network earlier than
@@ -1430,12 +1423,6 @@ void C_OscComMessageLogger::m_ConvertCanMessage(const T_STWCAN_Msg_RX & orc_Msg,
       this->mc_HandledCanMessage.u64_TimeStampRelative = 0ULL;
    }
 
-   this->mc_HandledCanMessage.c_TimeStampAbsoluteStart =
-      C_OscComMessageLoggerData::h_GetTimestampAsString(this->mc_HandledCanMessage.u64_TimeStampAbsoluteStart);
-   this->mc_HandledCanMessage.c_TimeStampAbsoluteTimeOfDay =
-      C_OscComMessageLoggerData::h_GetTimestampAsString(this->mc_HandledCanMessage.u64_TimeStampAbsoluteTimeOfDay);
-   this->mc_HandledCanMessage.c_TimeStampRelative =
-      C_OscComMessageLoggerData::h_GetTimestampAsString(this->mc_HandledCanMessage.u64_TimeStampRelative);
    // Save the timestamp for the next message to calculate the relative timestamp
    this->mu64_LastTimeStamp = orc_Msg.u64_TimeStamp;
 
@@ -1446,12 +1433,12 @@ void C_OscComMessageLogger::m_ConvertCanMessage(const T_STWCAN_Msg_RX & orc_Msg,
       {
          // Standard id
          this->mc_MsgCounterStandardId[orc_Msg.u32_ID] = this->mc_MsgCounterStandardId[orc_Msg.u32_ID] + 1U;
-         this->mc_HandledCanMessage.c_Counter = C_SclString::IntToStr(this->mc_MsgCounterStandardId[orc_Msg.u32_ID]);
+         this->mc_HandledCanMessage.u32_Counter = this->mc_MsgCounterStandardId[orc_Msg.u32_ID];
       }
       else
       {
          // Should not happen
-         this->mc_HandledCanMessage.c_Counter = "0";
+         this->mc_HandledCanMessage.u32_Counter = 0U;
       }
    }
    else
@@ -1463,12 +1450,12 @@ void C_OscComMessageLogger::m_ConvertCanMessage(const T_STWCAN_Msg_RX & orc_Msg,
       {
          // New message
          this->mc_MsgCounterExtendedId.insert(std::pair<uint32_t, uint32_t>(orc_Msg.u32_ID, 1U));
-         this->mc_HandledCanMessage.c_Counter = "1";
+         this->mc_HandledCanMessage.u32_Counter = 1U;
       }
       else
       {
          c_ItCounter->second = c_ItCounter->second + 1;
-         this->mc_HandledCanMessage.c_Counter = C_SclString::IntToStr(c_ItCounter->second);
+         this->mc_HandledCanMessage.u32_Counter = c_ItCounter->second;
       }
    }
 }
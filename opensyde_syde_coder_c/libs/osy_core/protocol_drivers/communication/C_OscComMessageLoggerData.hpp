@@ -18,6 +18,7 @@
 #include "stw_can.hpp"
 #include "C_SclString.hpp"
 #include "C_OscCanSignal.hpp"
+#include "C_OscNodeDataPoolContent.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw
@@ -35,15 +36,26 @@ public:
 
    bool operator <(const C_OscComMessageLoggerDataSignal & orc_Cmp) const;
 
+   // Text representation, rendered on demand
+   stw::scl::C_SclString GetValue(void) const;
+   stw::scl::C_SclString GetRawValueDec(void) const;
+   stw::scl::C_SclString GetRawValueHex(void) const;
+
    stw::scl::C_SclString c_Name;
-   stw::scl::C_SclString c_Value;
    stw::scl::C_SclString c_Unit;
-   stw::scl::C_SclString c_RawValueDec;
-   stw::scl::C_SclString c_RawValueHex;
    stw::scl::C_SclString c_Comment;
+   stw::scl::C_SclString c_ValueDescription; ///< Optional text replacing the interpreted value (e.g. DBC value table)
    bool q_DlcError;
 
+   uint64_t u64_RawValue; ///< Signal raw value as little endian bit pattern (also for float types)
+   C_OscNodeDataPoolContent::E_Type e_ValueType;
+   float64_t f64_Factor;
+   float64_t f64_Offset;
+
    stw::opensyde_core::C_OscCanSignal c_OscSignal;
+
+private:
+   stw::scl::C_SclString m_GetScaledValue(const float64_t of64_Factor, const float64_t of64_Offset) const;
 };
 
 class C_OscComMessageLoggerData
@@ -55,27 +67,33 @@ public:
    void SortSignals(void);
    static stw::scl::C_SclString h_GetTimestampAsString(const uint64_t ou64_TimeStamp);
 
+   // Text representation, rendered on demand
+   stw::scl::C_SclString GetTimeStampRelative(void) const;
+   stw::scl::C_SclString GetTimeStampAbsoluteStart(void) const;
+   stw::scl::C_SclString GetTimeStampAbsoluteTimeOfDay(void) const;
+   stw::scl::C_SclString GetCanIdDec(void) const;
+   stw::scl::C_SclString GetCanIdHex(void) const;
+   stw::scl::C_SclString GetCanDlc(void) const;
+   stw::scl::C_SclString GetCanDataDec(void) const;
+   stw::scl::C_SclString GetCanDataHex(void) const;
+   stw::scl::C_SclString GetCounter(void) const;
+
    uint64_t u64_TimeStampRelative;
    uint64_t u64_TimeStampAbsoluteStart;
    uint64_t u64_TimeStampAbsoluteTimeOfDay;
-   stw::scl::C_SclString c_TimeStampRelative;
-   stw::scl::C_SclString c_TimeStampAbsoluteStart;
-   stw::scl::C_SclString c_TimeStampAbsoluteTimeOfDay;
-   stw::scl::C_SclString c_CanIdDec;
-   stw::scl::C_SclString c_CanIdHex;
-   stw::scl::C_SclString c_CanDlc;
    bool q_CanDlcError;
-   stw::scl::C_SclString c_CanDataDec;
-   stw::scl::C_SclString c_CanDataHex;
    stw::scl::C_SclString c_Name;
    stw::scl::C_SclString c_ProtocolTextDec;
    stw::scl::C_SclString c_ProtocolTextHex;
-   stw::scl::C_SclString c_Counter;
+   uint32_t u32_Counter; ///< Number of received messages with this CAN ID
 
    std::vector<C_OscComMessageLoggerDataSignal> c_Signals;
 
    stw::can::T_STWCAN_Msg_RX c_CanMsg;
    bool q_IsTx;
+
+private:
+   uint8_t m_GetNumberOfDataBytes(void) const;
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
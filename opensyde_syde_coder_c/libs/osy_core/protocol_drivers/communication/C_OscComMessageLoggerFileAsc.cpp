@@ -160,11 +160,11 @@ void C_OscComMessageLoggerFileAsc::AddMessageToFile(const C_OscComMessageLoggerD
       // ASC specification defines a width of fixed 15 chars for CAN Id. Plus one for the space to the direction
       if (this->mq_HexActive == true)
       {
-         c_Temp.PrintFormatted("%-16s", orc_MessageData.c_CanIdHex.c_str());
+         c_Temp.PrintFormatted("%-16s", orc_MessageData.GetCanIdHex().c_str());
       }
       else
       {
-         c_Temp.PrintFormatted("%-16s", orc_MessageData.c_CanIdDec.c_str());
+         c_Temp.PrintFormatted("%-16s", orc_MessageData.GetCanIdDec().c_str());
       }
       c_LogEntry += c_Temp;
 
@@ -187,14 +187,14 @@ void C_OscComMessageLoggerFileAsc::AddMessageToFile(const C_OscComMessageLoggerD
       else
       {
          // DLC and data
-         c_LogEntry += "d " + orc_MessageData.c_CanDlc + " ";
+         c_LogEntry += "d " + orc_MessageData.GetCanDlc() + " ";
          if (this->mq_HexActive == true)
          {
-            c_LogEntry += orc_MessageData.c_CanDataHex;
+            c_LogEntry += orc_MessageData.GetCanDataHex();
          }
          else
          {
-            c_LogEntry += orc_MessageData.c_CanDataDec;
+            c_LogEntry += orc_MessageData.GetCanDataDec();
          }
       }
 
@@ -232,7 +232,7 @@ void C_OscComMessageLoggerFileAsc::AddMessageToFile(const C_OscComMessageLoggerD
       for (u32_SignalCounter = 0U; u32_SignalCounter < orc_MessageData.c_Signals.size(); u32_SignalCounter++)
       {
          const C_OscComMessageLoggerDataSignal & rc_Signal = orc_MessageData.c_Signals[u32_SignalCounter];
-         c_LogEntry += "   //Signal   " + rc_Signal.c_Name + " = " + rc_Signal.c_Value;
+         c_LogEntry += "   //Signal   " + rc_Signal.c_Name + " = " + rc_Signal.GetValue();
          if (rc_Signal.c_Unit != "")
          {
             c_LogEntry += " " + rc_Signal.c_Unit;
@@ -16,6 +16,7 @@
 #include <cstdio>
 #include <climits>
 #include <cstring>
+#include <cctype>
 
 #include "C_SclIniFile.hpp"
 #include "C_SclString.hpp"
@@ -55,8 +56,7 @@ static const char_t mcn_EqualIndicator = '=';
 //----------------------------------------------------------------------------------------------------------------------
 C_SclIniFile::C_SclIniFile(const C_SclString & orc_FileName) :
    mq_Dirty(false),
-   ms32_PreviousSectionIndex(0),
-   ms32_PreviousKeyIndex(0),
+   mq_SectionIndexValid(false),
    FileName(orc_FileName)
 {
    if (orc_FileName == "")
@@ -129,16 +129,18 @@ bool C_SclIniFile::m_Load(const C_SclString & orc_FileName)
    //(performance increase)
    for (s32_Index = 0; s32_Index < c_List.Strings.GetLength(); s32_Index++)
    {
-      c_Line = c_List.Strings[s32_Index].Trim(); //Trim to be defensive against whitespaces
+      //Trim to be defensive against whitespaces; store trimmed line for 2nd pass
+      c_List.Strings[s32_Index] = c_List.Strings[s32_Index].Trim();
+      const C_SclString & rc_Line = c_List.Strings[s32_Index];
 
-      if (c_Line.Pos(mcn_CommentIndicator) == 1U)
+      if (rc_Line.Pos(mcn_CommentIndicator) == 1U)
       {
       }
-      else if (c_Line.Pos("[") == 1U) // new section
+      else if (rc_Line.Pos("[") == 1U) // new section
       {
          c_Items.IncLength();
       }
-      else if (c_Line.Pos("=") != 0U) // we have a key
+      else if (rc_Line.Pos("=") != 0U) // we have a key
       {
          if (c_Items.GetLength() != 0)
          {
@@ -177,7 +179,7 @@ bool C_SclIniFile::m_Load(const C_SclString & orc_FileName)
    //2nd pass: enter data
    for (s32_Index = 0; s32_Index < c_List.Strings.GetLength(); s32_Index++)
    {
-      c_Line = c_List.Strings[s32_Index].Trim();
+      c_Line = c_List.Strings[s32_Index];
 
       if (c_Line.Pos(mcn_CommentIndicator) == 1U)
       {
@@ -220,6 +222,8 @@ bool C_SclIniFile::m_Load(const C_SclString & orc_FileName)
          //probably an empty line
       }
    }
+   //lookup tables are built on first access
+   mq_SectionIndexValid = false;
    return true;
 }
 
@@ -281,6 +285,7 @@ bool C_SclIniFile::m_SetValue(const C_SclString & orc_Section, const C_SclString
 {
    C_SclIniKey * pc_Key = NULL;
    C_SclIniSection * pc_Section;
+   int32_t s32_SectionIndex;
 
    if ((orc_Section == "") || (orc_Key == ""))
    {
@@ -288,18 +293,20 @@ bool C_SclIniFile::m_SetValue(const C_SclString & orc_Section, const C_SclString
    }
 
    //does the section already exist ?
-   pc_Section = m_GetSection(orc_Section);
-   if (pc_Section != NULL)
+   s32_SectionIndex = m_GetSectionIndex(orc_Section);
+   if (s32_SectionIndex >= 0)
    {
+      pc_Section = &mc_Sections[s32_SectionIndex];
       if (oq_ForceAppend == false)
       {
-         pc_Key = m_GetKey(orc_Key, pc_Section);
+         pc_Key = m_GetKey(orc_Key, s32_SectionIndex);
       }
    }
    else
    {
       //no: create new section
       pc_Section = m_CreateSection(orc_Section);
+      s32_SectionIndex = mc_Sections.GetHigh();
    }
 
    mq_Dirty = true;
@@ -311,6 +318,16 @@ bool C_SclIniFile::m_SetValue(const C_SclString & orc_Section, const C_SclString
       pc_Section->c_Keys[pc_Section->c_Keys.GetHigh()].c_Key     = orc_Key;
       pc_Section->c_Keys[pc_Section->c_Keys.GetHigh()].c_Value   = orc_Value;
       pc_Section->c_Keys[pc_Section->c_Keys.GetHigh()].c_Comment = "";
+
+      //keep lookup table up to date (first key of a name stays the one found)
+      if (mq_SectionIndexValid == true)
+      {
+         C_KeyIndex & rc_KeyIndex = mc_KeyIndices[static_cast<uint32_t>(s32_SectionIndex)];
+         if (rc_KeyIndex.q_Valid == true)
+         {
+            (void)rc_KeyIndex.c_Map.emplace(mh_GetIndexName(orc_Key), pc_Section->c_Keys.GetHigh());
+         }
+      }
    }
    else
    {
@@ -694,8 +711,8 @@ void C_SclIniFile::EraseSection(const C_SclString & orc_Section)
       {
          mc_Sections.Delete(s32_Index);
          mq_Dirty = true;
-         ms32_PreviousSectionIndex = 0;
-         ms32_PreviousKeyIndex = 0;
+         //indices of following sections changed
+         mq_SectionIndexValid = false;
          return;
       }
    }
@@ -716,19 +733,22 @@ void C_SclIniFile::EraseSection(const C_SclString & orc_Section)
 void C_SclIniFile::DeleteKey(const C_SclString & orc_Section, const C_SclString & orc_Key)
 {
    int32_t s32_Index;
-   C_SclIniSection * const pc_Section = m_GetSection(orc_Section);
+   const int32_t s32_SectionIndex = m_GetSectionIndex(orc_Section);
 
-   if (pc_Section == NULL)
+   if (s32_SectionIndex < 0)
    {
       return;
    }
 
-   for (s32_Index = 0; s32_Index < pc_Section->c_Keys.GetLength(); s32_Index++)
+   C_SclIniSection & rc_Section = mc_Sections[s32_SectionIndex];
+   for (s32_Index = 0; s32_Index < rc_Section.c_Keys.GetLength(); s32_Index++)
    {
-      if (pc_Section->c_Keys[s32_Index].c_Key.AnsiCompareIc(orc_Key) == 0)
+      if (rc_Section.c_Keys[s32_Index].c_Key.AnsiCompareIc(orc_Key) == 0)
       {
-         pc_Section->c_Keys.Delete(s32_Index);
+         rc_Section.c_Keys.Delete(s32_Index);
          mq_Dirty = true;
+         //indices of following keys changed
+         mc_KeyIndices[static_cast<uint32_t>(s32_SectionIndex)].q_Valid = false;
          return;
       }
    }
@@ -743,8 +763,15 @@ C_SclIniSection * C_SclIniFile::m_CreateSection(const C_SclString & orc_Section)
    mc_Sections[mc_Sections.GetHigh()].c_Name    = orc_Section;
    mc_Sections[mc_Sections.GetHigh()].c_Comment = "";
    mq_Dirty = true;
-   ms32_PreviousSectionIndex = 0;
-   ms32_PreviousKeyIndex = 0;
+
+   //keep lookup tables up to date (new section has no keys yet)
+   if (mq_SectionIndexValid == true)
+   {
+      C_KeyIndex c_KeyIndex;
+      c_KeyIndex.q_Valid = true;
+      (void)mc_SectionIndex.emplace(mh_GetIndexName(orc_Section), mc_Sections.GetHigh());
+      mc_KeyIndices.push_back(c_KeyIndex);
+   }
 
    return &mc_Sections[mc_Sections.GetHigh()];
 }
@@ -793,46 +820,80 @@ bool C_SclIniFile::ValueExists(const C_SclString & orc_Section, const C_SclStrin
 // pointer to that key, otherwise returns NULL.
 C_SclIniKey * C_SclIniFile::m_GetKey(const C_SclString & orc_Key, const C_SclString & orc_Section)
 {
-   C_SclIniSection * const pt_Section = m_GetSection(orc_Section);
+   const int32_t s32_SectionIndex = m_GetSectionIndex(orc_Section);
 
-   if (pt_Section == NULL)
+   if (s32_SectionIndex < 0)
    {
       return NULL;
    }
 
-   return m_GetKey(orc_Key, pt_Section);
+   return m_GetKey(orc_Key, s32_SectionIndex);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Find key in section
 
-C_SclIniKey * C_SclIniFile::m_GetKey(const C_SclString & orc_Key, C_SclIniSection * const opc_Section)
-{
-   int32_t s32_Index;
-   int32_t s32_LastIndex;
+   Uses the lookup table of the section (built on first access).
+   If a key name exists more than once the first one is returned.
 
-   s32_LastIndex = ms32_PreviousKeyIndex;
+   \param[in]     orc_Key             key to find (case insensitive)
+   \param[in]     os32_SectionIndex   index of section to search in (must be valid)
 
-   //Search from last successful point to the end
-   for (s32_Index = s32_LastIndex; s32_Index < opc_Section->c_Keys.GetLength(); s32_Index++)
+   \return
+   NULL                key not found
+   else                address of found key
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclIniKey * C_SclIniFile::m_GetKey(const C_SclString & orc_Key, const int32_t os32_SectionIndex)
+{
+   C_SclIniSection & rc_Section = mc_Sections[os32_SectionIndex];
+   C_KeyIndex & rc_KeyIndex = mc_KeyIndices[static_cast<uint32_t>(os32_SectionIndex)];
+   std::unordered_map<std::string, int32_t>::const_iterator c_It;
+
+   if (rc_KeyIndex.q_Valid == false)
    {
-      if (opc_Section->c_Keys[s32_Index].c_Key.AnsiCompareIc(orc_Key) == 0)
+      rc_KeyIndex.c_Map.clear();
+      rc_KeyIndex.c_Map.reserve(static_cast<uint32_t>(rc_Section.c_Keys.GetLength()));
+      for (int32_t s32_Index = 0; s32_Index < rc_Section.c_Keys.GetLength(); s32_Index++)
       {
-         ms32_PreviousKeyIndex = s32_Index;
-         return &opc_Section->c_Keys[s32_Index];
+         (void)rc_KeyIndex.c_Map.emplace(mh_GetIndexName(rc_Section.c_Keys[s32_Index].c_Key), s32_Index);
       }
+      rc_KeyIndex.q_Valid = true;
    }
 
-   //Not found yet -> Search from beginning to last successful point
-   for (s32_Index = 0; s32_Index < s32_LastIndex; s32_Index++)
+   c_It = rc_KeyIndex.c_Map.find(mh_GetIndexName(orc_Key));
+   if (c_It == rc_KeyIndex.c_Map.end())
    {
-      if (opc_Section->c_Keys[s32_Index].c_Key.AnsiCompareIc(orc_Key) == 0)
-      {
-         ms32_PreviousKeyIndex = s32_Index;
-         return &opc_Section->c_Keys[s32_Index];
-      }
+      return NULL;
    }
+   return &rc_Section.c_Keys[c_It->second];
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Find section index
+
+   Given a section name, locates that section in the lookup table.
+   The lookup tables are rebuilt first if the sections were changed in a way that invalidated them.
+   If a section name exists more than once the first one is returned.
 
-   return NULL;
+   \param[in]     orc_Section    ini section to find (case insensitive)
+
+   \return
+   -1                  section not found
+   else                index of found section
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SclIniFile::m_GetSectionIndex(const C_SclString & orc_Section)
+{
+   std::unordered_map<std::string, int32_t>::const_iterator c_It;
+
+   if (mq_SectionIndexValid == false)
+   {
+      m_RebuildSectionIndex();
+   }
+
+   c_It = mc_SectionIndex.find(mh_GetIndexName(orc_Section));
+   return (c_It == mc_SectionIndex.end()) ? -1 : c_It->second;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -840,13 +901,6 @@ C_SclIniKey * C_SclIniFile::m_GetKey(const C_SclString & orc_Key, C_SclIniSectio
 
    Given a section name, locates that section in the list and returns a pointer to it.
 
-   We do not simply scan from the first index each time.
-   Instead we try to improve performance for subsequent calls by assuming the following:
-   In many cases the caller will parse the file in a ways that
-   - usually the same section is used for many keys
-   - sections parsed after the first typically reside after the previously parsed section
-   So this approach can help to massively speed up access.
-
    \param[in]     orc_Section    ini section to find
 
    \return
@@ -856,37 +910,58 @@ C_SclIniKey * C_SclIniFile::m_GetKey(const C_SclString & orc_Key, C_SclIniSectio
 //----------------------------------------------------------------------------------------------------------------------
 C_SclIniSection * C_SclIniFile::m_GetSection(const C_SclString & orc_Section)
 {
-   int32_t s32_Index;
-   int32_t s32_LastIndex;
+   const int32_t s32_Index = m_GetSectionIndex(orc_Section);
+
+   return (s32_Index < 0) ? NULL : &mc_Sections[s32_Index];
+}
 
-   s32_LastIndex = ms32_PreviousSectionIndex;
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Rebuild section lookup table
 
-   //Search from last successful point to the end
-   for (s32_Index = s32_LastIndex; s32_Index < mc_Sections.GetLength(); s32_Index++)
+   The key lookup tables of the sections are only marked as invalid and built on first access.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SclIniFile::m_RebuildSectionIndex(void)
+{
+   mc_SectionIndex.clear();
+   mc_SectionIndex.reserve(static_cast<uint32_t>(mc_Sections.GetLength()));
+   for (int32_t s32_Index = 0; s32_Index < mc_Sections.GetLength(); s32_Index++)
    {
-      if (mc_Sections[s32_Index].c_Name.AnsiCompareIc(orc_Section) == 0)
-      {
-         ms32_PreviousSectionIndex = s32_Index;
-         if (s32_Index != s32_LastIndex) //section changed: restart from 1st key
-         {
-            ms32_PreviousKeyIndex = 0;
-         }
-         return &mc_Sections[s32_Index];
-      }
+      (void)mc_SectionIndex.emplace(mh_GetIndexName(mc_Sections[s32_Index].c_Name), s32_Index);
    }
+   mc_KeyIndices.assign(static_cast<uint32_t>(mc_Sections.GetLength()), C_KeyIndex());
+   mq_SectionIndexValid = true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get name as used in lookup tables
+
+   Same conversion as C_SclString::UpperCase so the lookup matches C_SclString::AnsiCompareIc.
+
+   \param[in]     orc_Name    section or key name
+
+   \return
+   upper case name
+*/
+//----------------------------------------------------------------------------------------------------------------------
+std::string C_SclIniFile::mh_GetIndexName(const C_SclString & orc_Name)
+{
+   std::string c_Name = orc_Name.c_str();
 
-   //Not found yet -> Search from beginning to last successful point
-   for (s32_Index = 0; s32_Index < s32_LastIndex; s32_Index++)
+   for (std::string::iterator c_It = c_Name.begin(); c_It != c_Name.end(); ++c_It)
    {
-      if (mc_Sections[s32_Index].c_Name.AnsiCompareIc(orc_Section) == 0)
-      {
-         ms32_PreviousSectionIndex = s32_Index;
-         ms32_PreviousKeyIndex = 0; //section changed: restart from 1st key
-         return &mc_Sections[s32_Index];
-      }
+      *c_It = static_cast<char_t>(std::toupper(*c_It));
    }
+   return c_Name;
+}
 
-   return NULL;
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclIniFile::C_KeyIndex::C_KeyIndex(void) :
+   q_Valid(false)
+{
 }
 
 //----------------------------------------------------------------------------------------------------------------------
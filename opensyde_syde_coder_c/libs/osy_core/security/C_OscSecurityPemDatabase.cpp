@@ -13,6 +13,7 @@
 #include "precomp_headers.hpp"
 
 #include "TglFile.hpp"
+#include "TglTasks.hpp"
 #include "stwerrors.hpp"
 #include "C_SclStringList.hpp"
 #include "C_OscSecurityPem.hpp"
@@ -71,25 +72,12 @@ const C_OscSecurityPemKeyInfo * C_OscSecurityPemDatabase::GetPemFileBySerialNumb
 {
    const C_OscSecurityPemKeyInfo * pc_Retval = NULL;
 
-   for (uint32_t u32_ItFile = 0UL; u32_ItFile < this->mc_StoredPemFiles.size(); ++u32_ItFile)
+   const std::map<std::vector<uint8_t>, uint32_t>::const_iterator c_It = this->mc_SerialNumberIndex.find(
+      orc_SerialNumber);
+
+   if (c_It != this->mc_SerialNumberIndex.end())
    {
-      const C_OscSecurityPemKeyInfo & rc_KeyFile = this->mc_StoredPemFiles[u32_ItFile];
-      const std::vector<uint8_t> & rc_CurSerialNumber = rc_KeyFile.GetPubKeySerialNumber();
-      if (rc_CurSerialNumber.size() == orc_SerialNumber.size())
-      {
-         bool q_Matches = true;
-         for (uint32_t u32_ItKey = 0UL; (u32_ItKey < rc_CurSerialNumber.size()) && (q_Matches == true); ++u32_ItKey)
-         {
-            if (rc_CurSerialNumber[u32_ItKey] != orc_SerialNumber[u32_ItKey])
-            {
-               q_Matches = false;
-            }
-         }
-         if (q_Matches)
-         {
-            pc_Retval = &this->mc_StoredPemFiles[u32_ItFile];
-         }
-      }
+      pc_Retval = &this->mc_StoredPemFiles[c_It->second];
    }
 
    return pc_Retval;
@@ -144,6 +132,10 @@ int32_t C_OscSecurityPemDatabase::AddLevel7PemFile(const std::string & orc_Path)
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Parse folder
 
+   All PEM files of the folder are parsed in parallel with as many threads as the system has cores.
+   Parse results are kept per file path: a file with the same content as in the previous call is not parsed again.
+   Keys are added in file order so the handling of duplicate serial numbers does not depend on the threads.
+
    \param[in]  orc_FolderPath    Folder path
 
    \return
@@ -163,14 +155,36 @@ int32_t C_OscSecurityPemDatabase::ParseFolder(const std::string & orc_FolderPath
 
    // Remove previous results
    this->mc_StoredPemFiles.clear();
+   this->mc_SerialNumberIndex.clear();
 
    if (TglDirectoryExists(c_FolderPathWithDelimiter))
    {
       const std::vector<std::string> c_Files = C_OscSecurityPemDatabase::mh_GetPemFiles(c_FolderPathWithDelimiter);
+      C_PemFileParseJobs c_Jobs;
+      c_Jobs.pc_PreviousResults = &this->mc_ParsedFiles;
+      c_Jobs.c_FilePaths = c_Files;
+      C_OscSecurityPemDatabase::mh_ParsePemFiles(c_Jobs);
+
+      this->mc_ParsedFiles.clear();
+      this->mc_StoredPemFiles.reserve(c_Files.size());
       for (uint32_t u32_It = 0UL; u32_It < c_Files.size(); ++u32_It)
       {
-         const std::string c_CurFolderPath = c_Files[u32_It];
-         C_OscSecurityPemDatabase::m_TryAddKeyFromPath(c_CurFolderPath, true);
+         C_PemFileResult & rc_Result = c_Jobs.c_Results[u32_It];
+         std::string c_ErrorMessage = rc_Result.c_ErrorMessage;
+         if (rc_Result.s32_Result == C_NO_ERR)
+         {
+            this->m_TryAddKey(rc_Result.c_KeyInfo, c_ErrorMessage, true);
+         }
+         if (c_ErrorMessage.size() > 0UL)
+         {
+            osc_write_log_warning("Read PEM database",
+                                  "Error reading file \"" + c_Files[u32_It] + "\": " + c_ErrorMessage);
+         }
+         //keep for next call
+         if (rc_Result.s32_Result != C_RANGE)
+         {
+            this->mc_ParsedFiles[c_Files[u32_It]] = rc_Result;
+         }
       }
       osc_write_log_info("Read PEM database",
                          "Imported " + stw::scl::C_SclString::IntToStr(
@@ -251,6 +265,8 @@ int32_t C_OscSecurityPemDatabase::m_TryAddKey(const C_OscSecurityPemKeyInfo & or
       {
          if (this->GetPemFileBySerialNumber(orc_NewKey.GetPubKeySerialNumber()) == NULL)
          {
+            this->mc_SerialNumberIndex[orc_NewKey.GetPubKeySerialNumber()] =
+               static_cast<uint32_t>(this->mc_StoredPemFiles.size());
             this->mc_StoredPemFiles.push_back(orc_NewKey);
          }
          else
@@ -299,3 +315,61 @@ std::vector<std::string> C_OscSecurityPemDatabase::mh_GetPemFiles(const std::str
    }
    return c_Retval;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Parse PEM files in parallel
+
+   Parses all PEM files of the jobs in parallel (see TglParallelFor()).
+   Each job writes its own result so no synchronization of the parsed data is necessary.
+
+   \param[in,out]  orc_Jobs   Jobs to process; results are stored in c_Results
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscSecurityPemDatabase::mh_ParsePemFiles(C_PemFileParseJobs & orc_Jobs)
+{
+   const uint32_t u32_NumJobs = static_cast<uint32_t>(orc_Jobs.c_FilePaths.size());
+
+   orc_Jobs.c_Results.resize(u32_NumJobs);
+   TglParallelFor(u32_NumJobs, &C_OscSecurityPemDatabase::mh_ParsePemFileJob, &orc_Jobs);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Parse PEM file of one job
+
+   Takes over the previous result of a file if its content did not change.
+
+   \param[in,out]  opv_Jobs   Jobs to process (C_PemFileParseJobs)
+   \param[in]      ou32_Job   Index of job to process
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscSecurityPemDatabase::mh_ParsePemFileJob(void * const opv_Jobs, const uint32_t ou32_Job)
+{
+   C_PemFileParseJobs * const pc_Jobs = reinterpret_cast<C_PemFileParseJobs *>(opv_Jobs);
+   const std::string & rc_Path = pc_Jobs->c_FilePaths[ou32_Job];
+   C_PemFileResult & rc_Result = pc_Jobs->c_Results[ou32_Job];
+
+   rc_Result.c_ErrorMessage = "";
+   if (TglFileExists(rc_Path))
+   {
+      const std::map<std::string, C_PemFileResult>::const_iterator c_Previous =
+         pc_Jobs->pc_PreviousResults->find(rc_Path);
+
+      C_OscSecurityPem::h_ReadFileContent(rc_Path, rc_Result.c_Content);
+      if ((c_Previous != pc_Jobs->pc_PreviousResults->end()) &&
+          (c_Previous->second.c_Content == rc_Result.c_Content))
+      {
+         rc_Result = c_Previous->second;
+      }
+      else
+      {
+         C_OscSecurityPem c_NewFile;
+         rc_Result.s32_Result = c_NewFile.LoadFromContent(rc_Result.c_Content, rc_Result.c_ErrorMessage);
+         rc_Result.c_KeyInfo = c_NewFile.GetKeyInfo();
+      }
+   }
+   else
+   {
+      rc_Result.s32_Result = C_RANGE;
+      rc_Result.c_ErrorMessage = "could not read file";
+   }
+}
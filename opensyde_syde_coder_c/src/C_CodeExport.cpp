@@ -139,6 +139,7 @@ int32_t main(const int32_t os32_Argc, char_t * const opacn_Argv[])
    }
 
    e_Result = c_TheCodeExport.Exit(e_Result);
+   stw::opensyde_core::C_OscLoggingHandler::h_Exit();
 
    return static_cast<uint8_t>(e_Result);
 }
@@ -6,8 +6,7 @@
    \class       stw::opensyde_core::C_OscAesFile
    \brief       openSYDE Core zip/unzip file utilities
 
-   Wrapper for the AES library by SergeyBel.
-   Provides functions to encrypt/decrypt a file with AES.
+   Provides functions to encrypt/decrypt a file with AES (OpenSSL EVP API).
 
    \copyright   Copyright 2021 Sensor-Technik Wiedemann GmbH. All rights reserved.
 */
@@ -46,6 +45,12 @@ public:
                                            const stw::scl::C_SclString & orc_FolderPathToUnzip,
                                            const stw::scl::C_SclString & orc_Key,
                                            stw::scl::C_SclString * const opc_ErrorMessage);
+
+private:
+   static const uint32_t mhu32_CHUNK_SIZE; ///< number of bytes processed in one step
+
+   static int32_t mh_CryptFile(const stw::scl::C_SclString & orc_Key, const stw::scl::C_SclString & orc_InFilePath,
+                               const stw::scl::C_SclString & orc_OutFilePath, const bool oq_Encrypt);
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
@@ -30,10 +30,21 @@ namespace stw::can
 class STWCAN_PACKAGE C_Can :
    public C_CanDispatcher
 {
+public:
+   ///source of reception time stamps placed in T_STWCAN_Msg_RX::u64_TimeStamp
+   enum E_TimeStampMode
+   {
+      eTIME_STAMP_SYSTEM = 0, ///< system time when the message was read by the application (default)
+      eTIME_STAMP_KERNEL,     ///< time the kernel received the message (SO_TIMESTAMPING software stamp)
+      eTIME_STAMP_HARDWARE    ///< time stamp of the CAN controller if supported; falls back to kernel time stamp
+   };
+
 private:
    C_Can(const C_Can & orc_Souce);               //not implemented -> prevent copying
    C_Can & operator = (const C_Can & orc_Souce); //not implemented -> prevent assignment
    int32_t ms32_Socket;
+   E_TimeStampMode me_TimeStampMode;
+   bool mq_FdModeRequested;
 
    // ms32_RxTimeout: Timeout parameter for poll() in m_CAN_Read_Msg.
    // -1: block until message received; 0: return immediately; >0: timeout in ms
@@ -42,11 +53,18 @@ private:
    stw::scl::C_SclString mc_CanIfName;
 
    void m_InitClass(const uint8_t ou8_CommChannel);
+   int32_t m_ConfigureTimeStamping(void) const;
+   int32_t m_ConfigureFdMode(void);
+   int32_t m_ReadMessages(const int32_t os32_TimeoutMs, T_STWCAN_Msg_RX * const opc_Messages,
+                          const uint32_t ou32_MaxMessages, uint32_t & oru32_NumRead) const;
 
 protected:
    //function from Dispatcher (mandatory to implement)
    //actual reading from CAN driver
    virtual int32_t m_CAN_Read_Msg(T_STWCAN_Msg_RX & orc_Message);
+   virtual int32_t m_CAN_Read_Msgs(T_STWCAN_Msg_RX * const opc_Messages, const uint32_t ou32_MaxMessages,
+                                   uint32_t & oru32_NumRead);
+   virtual int32_t m_CAN_WaitForRx(const uint32_t ou32_TimeoutMs);
 
 public:
    C_Can(void);
@@ -62,6 +80,8 @@ public:
    virtual int32_t CAN_Exit(void);
    virtual int32_t CAN_Reset(void);
    virtual int32_t CAN_Send_Msg(const T_STWCAN_Msg_TX & orc_Message);
+   int32_t CAN_Send_Msgs(const T_STWCAN_Msg_TX * const opc_Messages, const uint32_t ou32_NumMessages,
+                         uint32_t & oru32_NumSent);
    virtual int32_t CAN_Get_System_Time(uint64_t & oru64_SystemTime) const;
 
    int32_t CAN_Read_Msg_Timeout(const uint32_t ou32_MaxWaitTimeMS, T_STWCAN_Msg_RX & orc_Message);
@@ -72,6 +92,12 @@ public:
 
    void SetLimitRXID(const uint32_t ou32_LimitRXID);
    uint32_t GetLimitRXID(void) const;
+
+   int32_t SetTimeStampMode(const E_TimeStampMode oe_Mode);
+   E_TimeStampMode GetTimeStampMode(void) const;
+
+   int32_t SetFdMode(const bool oq_Enable);
+   bool GetFdMode(void) const;
 };
 
 /* -- Global Variables ---------------------------------------------------------------------------------------------- */
@@ -442,6 +442,7 @@ int32_t C_Can::m_ReadMsgFromDLL(T_STWCAN_Msg_RX & orc_Message) const
    -1                                DLL function returns error
    CAN_COMP_ERR_DLL_NOT_OPENED       DLL was not yet loaded
    C_CONFIG                          channel other than 0 configured but not supported by loaded DLL
+   C_RANGE                           CAN FD frame (not supported by the STW CAN DLL interface)
 */
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_Can::CAN_Send_Msg(const T_STWCAN_Msg_TX & orc_Message)
@@ -450,6 +451,10 @@ int32_t C_Can::CAN_Send_Msg(const T_STWCAN_Msg_TX & orc_Message)
    {
       return CAN_COMP_ERR_DLL_NOT_OPENED;
    }
+   if ((orc_Message.u8_FDF != 0U) || (orc_Message.u8_DLC > STWCAN_CLASSIC_MAX_DLC))
+   {
+      return C_RANGE;
+   }
    if ((mu8_CommChannel > 0U) && (mpc_Can->mq_ExtFunctionsAvailable == false))
    {
       return C_CONFIG;
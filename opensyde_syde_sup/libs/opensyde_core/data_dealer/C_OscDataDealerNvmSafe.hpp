@@ -65,6 +65,19 @@ public:
    int32_t NvmSafeWriteParameterSetFile(const stw::scl::C_SclString & orc_Path, int32_t & ors32_ResultDetail);
 
 private:
+   ///Contiguous NVM area written with one access
+   class C_NvmWriteBlock
+   {
+   public:
+      bool operator <(const C_NvmWriteBlock & orc_Cmp) const;
+
+      uint32_t u32_StartAddress;                                ///< NVM address of first byte
+      std::vector<uint8_t> c_Data;                              ///< data to write
+      std::vector<C_OscNodeDataPoolListElementId> c_ElementIds; ///< elements contained in this area (if known)
+   };
+
+   static void mh_MergeNvmWriteBlocks(std::vector<C_NvmWriteBlock> & orc_Blocks);
+   static uint32_t mh_GetNvmWriteAccessCount(const std::vector<C_NvmWriteBlock> & orc_Blocks);
    static void mh_CreateInterpretedList(const C_OscNodeDataPoolList & orc_List,
                                         C_OscParamSetInterpretedList & orc_InterpretedList);
    int32_t m_CheckParameterFileContent(const C_OscParamSetRawNode & orc_Node) const;
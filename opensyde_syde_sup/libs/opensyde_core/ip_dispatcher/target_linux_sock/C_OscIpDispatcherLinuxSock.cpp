@@ -17,9 +17,9 @@
 #include <fcntl.h>
 #include <errno.h>
 #include <sys/select.h>
-#include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
+#include <netinet/tcp.h>
 #include <arpa/inet.h>
 #include <ifaddrs.h>
 
@@ -38,6 +38,10 @@ using namespace stw::tgl;
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
 #define INVALID_SOCKET     (-1)
 
+static const uint32_t mu32_TCP_RX_CHUNK_SIZE = 4096U;      ///< minimum number of bytes to try to read with one recv()
+static const uint32_t mu32_UDP_RX_BATCH_SIZE = 8U;         ///< maximum number of datagrams read with one recvmmsg()
+static const uint32_t mu32_UDP_MAX_DATAGRAM_SIZE = 4096U;  ///< maximum size of received datagrams
+
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
 /* -- Global Variables ---------------------------------------------------------------------------------------------- */
@@ -111,6 +115,28 @@ bool C_OscIpDispatcherLinuxSock::C_BufferIdentifier::operator <(
    return q_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Discard all buffered received data
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscIpDispatcherLinuxSock::C_TcpConnection::ClearRxBuffer(void)
+{
+   this->c_RxBuffer.clear();
+   this->u32_RxBufferReadPosition = 0U;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of buffered received bytes not consumed yet
+
+   \return
+   number of bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscIpDispatcherLinuxSock::C_TcpConnection::GetNumRxBytesAvailable(void) const
+{
+   return static_cast<uint32_t>(this->c_RxBuffer.size()) - this->u32_RxBufferReadPosition;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Set up class
 
@@ -118,7 +144,9 @@ bool C_OscIpDispatcherLinuxSock::C_BufferIdentifier::operator <(
 */
 //----------------------------------------------------------------------------------------------------------------------
 C_OscIpDispatcherLinuxSock::C_OscIpDispatcherLinuxSock(void) :
-   C_OscIpDispatcher()
+   C_OscIpDispatcher(),
+   ms32_SocketUdpServer(INVALID_SOCKET),
+   mc_UdpRxBuffer(static_cast<size_t>(mu32_UDP_RX_BATCH_SIZE) * mu32_UDP_MAX_DATAGRAM_SIZE)
 {
 }
 
@@ -162,6 +190,7 @@ int32_t C_OscIpDispatcherLinuxSock::InitTcp(const uint8_t (&orau8_Ip)[4], uint32
 
    (void)memcpy(&c_NewConnection.au8_IpAddress[0], &orau8_Ip[0], 4U);
    c_NewConnection.s32_Socket = INVALID_SOCKET;
+   c_NewConnection.ClearRxBuffer();
 
    this->mc_SocketsTcp.push_back(c_NewConnection);
    oru32_Handle = static_cast<uint32_t>(mc_SocketsTcp.size() - 1U);
@@ -288,6 +317,21 @@ int32_t C_OscIpDispatcherLinuxSock::m_ConnectTcp(C_TcpConnection & orc_Connectio
       }
    }
 
+   if (q_Error == false)
+   {
+      //we have small request/response pairs: do not let Nagle's algorithm delay them
+      int x_Enabled = 1; //lint !e8080 !e970 //using type to match library interface
+      x_Return = setsockopt(orc_Connection.s32_Socket, IPPROTO_TCP, TCP_NODELAY, &x_Enabled, sizeof(x_Enabled));
+      if (x_Return != 0)
+      {
+         //not critical: communication still works, only with higher latency
+         C_SclString c_ErrnoStr = strerror(errno);
+         osc_write_log_warning("openSYDE IP-TP",
+                               "TCP socket set TCP_NODELAY failed. Error: " + c_ErrnoStr +
+                               " IP-Address: " + mh_IpToText(orc_Connection.au8_IpAddress));
+      }
+   }
+
    if (q_Error == false)
    {
       sockaddr_in t_RemoteAddr;
@@ -479,6 +523,67 @@ int32_t C_OscIpDispatcherLinuxSock::m_ConfigureUdpSocket(const bool oq_ServerPor
    return (q_Error == true) ? C_NOACT : C_NO_ERR;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Utility: read available data from TCP socket into the connection's RX buffer
+
+   Reads everything the socket can provide with one recv() call (at least the missing number of bytes,
+    at least mu32_TCP_RX_CHUNK_SIZE).
+   So in most cases the DoIP header and the following payload are read with a single system call.
+
+   \param[in,out]  orc_Connection          TCP connection to read from
+   \param[in]      ou32_NumBytesRequired   number of bytes the caller wants to consume
+
+   \return
+   C_NO_ERR   data read (might still be less than required)
+   C_NOACT    no data available or connection closed by peer
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscIpDispatcherLinuxSock::m_FillTcpRxBuffer(C_TcpConnection & orc_Connection,
+                                                      const uint32_t ou32_NumBytesRequired) const
+{
+   int32_t s32_Return = C_NOACT;
+   const uint32_t u32_NumBytesAvailable = orc_Connection.GetNumRxBytesAvailable();
+   const uint32_t u32_NumBytesMissing = ou32_NumBytesRequired - u32_NumBytesAvailable;
+   const uint32_t u32_NumBytesToRead = (u32_NumBytesMissing > mu32_TCP_RX_CHUNK_SIZE) ?
+                                       u32_NumBytesMissing : mu32_TCP_RX_CHUNK_SIZE;
+   uint32_t u32_OldSize;
+   ssize_t x_BytesRead; //lint !e970 //using type to match library interface
+
+   //drop consumed data so the buffer does not grow
+   if (orc_Connection.u32_RxBufferReadPosition > 0U)
+   {
+      (void)orc_Connection.c_RxBuffer.erase(orc_Connection.c_RxBuffer.begin(),
+                                            orc_Connection.c_RxBuffer.begin() +
+                                            orc_Connection.u32_RxBufferReadPosition);
+      orc_Connection.u32_RxBufferReadPosition = 0U;
+   }
+
+   u32_OldSize = static_cast<uint32_t>(orc_Connection.c_RxBuffer.size());
+   orc_Connection.c_RxBuffer.resize(static_cast<size_t>(u32_OldSize) + u32_NumBytesToRead);
+
+   //lint -e{926}  Side-effect of the "char"-based API.
+   x_BytesRead = recv(orc_Connection.s32_Socket, reinterpret_cast<char_t *>(&orc_Connection.c_RxBuffer[u32_OldSize]),
+                      u32_NumBytesToRead, 0);
+   if (x_BytesRead > 0)
+   {
+      orc_Connection.c_RxBuffer.resize(static_cast<size_t>(u32_OldSize) + static_cast<size_t>(x_BytesRead));
+      s32_Return = C_NO_ERR;
+   }
+   else
+   {
+      orc_Connection.c_RxBuffer.resize(u32_OldSize);
+      //0: connection closed by peer; will be detected by IsTcpConnected
+      //EWOULDBLOCK/EAGAIN: no data; ECONNRESET: will be detected by IsTcpConnected and SendTcp
+      if ((x_BytesRead < 0) && (errno != EWOULDBLOCK) && (errno != EAGAIN) && (errno != ECONNRESET))
+      {
+         C_SclString c_ErrnoStr = strerror(errno);
+         osc_write_log_error("openSYDE IP-TP", "Could not read TCP. Error: " + c_ErrnoStr + " IP-Address: " +
+                             mh_IpToText(orc_Connection.au8_IpAddress));
+      }
+   }
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Utility: compose textual representation of IP
 
@@ -587,6 +692,11 @@ int32_t C_OscIpDispatcherLinuxSock::IsTcpConnected(const uint32_t ou32_Handle)
       // Socket not opened yet
       s32_Return = C_NOACT;
    }
+   else if (this->mc_SocketsTcp[ou32_Handle].GetNumRxBytesAvailable() > 0U)
+   {
+      // We already received data that was not consumed yet; no need to ask the socket
+      s32_Return = C_NO_ERR;
+   }
    else
    {
       char_t cn_Byte;
@@ -654,6 +764,8 @@ int32_t C_OscIpDispatcherLinuxSock::ReConnectTcp(const uint32_t ou32_Handle)
          (void)close(this->mc_SocketsTcp[ou32_Handle].s32_Socket);
          this->mc_SocketsTcp[ou32_Handle].s32_Socket = INVALID_SOCKET;
       }
+      //data of the old connection is of no use anymore:
+      this->mc_SocketsTcp[ou32_Handle].ClearRxBuffer();
       //connect:
       s32_Return = this->m_ConnectTcp(this->mc_SocketsTcp[ou32_Handle]);
       if (s32_Return != C_NO_ERR)
@@ -700,6 +812,7 @@ int32_t C_OscIpDispatcherLinuxSock::CloseTcp(const uint32_t ou32_Handle)
 
       s32_Return = close(this->mc_SocketsTcp[ou32_Handle].s32_Socket);
       this->mc_SocketsTcp[ou32_Handle].s32_Socket = INVALID_SOCKET;
+      this->mc_SocketsTcp[ou32_Handle].ClearRxBuffer();
 
       osc_write_log_info("openSYDE IP-TP",
                          "TCP closesocket() OK. IP-Address: " +
@@ -737,6 +850,7 @@ int32_t C_OscIpDispatcherLinuxSock::CloseUdp(void)
 
    mc_SocketsUdpClient.resize(0);
    ms32_SocketUdpServer = INVALID_SOCKET;
+   mc_UdpRxQueue.clear();
 
    return C_NO_ERR;
 }
@@ -796,6 +910,7 @@ int32_t C_OscIpDispatcherLinuxSock::SendTcp(const uint32_t ou32_Handle, const st
                                         mh_IpToText(this->mc_SocketsTcp[ou32_Handle].au8_IpAddress));
                   (void)close(this->mc_SocketsTcp[ou32_Handle].s32_Socket);
                   this->mc_SocketsTcp[ou32_Handle].s32_Socket = INVALID_SOCKET;
+                  this->mc_SocketsTcp[ou32_Handle].ClearRxBuffer();
                   m_OnTcpConnectionDropped(ou32_Handle);
                }
             }
@@ -854,42 +969,33 @@ int32_t C_OscIpDispatcherLinuxSock::ReadTcp(const uint32_t ou32_Handle, std::vec
       }
       else
       {
-         int x_Return; //lint !e8080 !e970 //using type to match library interface
-         int x_SizeInBuffer;
+         C_TcpConnection & rc_Connection = this->mc_SocketsTcp[ou32_Handle];
+         const uint32_t u32_NumBytes = static_cast<uint32_t>(orc_Data.size());
+
          //do we have enough bytes in RX buffer ?
-         x_Return = ioctl(this->mc_SocketsTcp[ou32_Handle].s32_Socket, FIONREAD, &x_SizeInBuffer);
-         //lint !e970 //using type to match library interface
-         if ((x_Return == 0) && (x_SizeInBuffer >= static_cast<int>(orc_Data.size())))
+         if (rc_Connection.GetNumRxBytesAvailable() < u32_NumBytes)
          {
-            //enough bytes: read
-            //lint -e{926}  Side-effect of the "char"-based API. No side effects as long as we are on the Windows
-            // platform.
-            //lint !e970 //using type to match library interface
-            ssize_t x_BytesRead = recv(this->mc_SocketsTcp[ou32_Handle].s32_Socket,
-                                       reinterpret_cast<char_t *>(&orc_Data[0]), orc_Data.size(), 0);
-            if (x_BytesRead == static_cast<ssize_t>(orc_Data.size()))
+            s32_Return = this->m_FillTcpRxBuffer(rc_Connection, u32_NumBytes);
+         }
+         if (rc_Connection.GetNumRxBytesAvailable() >= u32_NumBytes)
+         {
+            //enough bytes: consume
+            if (u32_NumBytes > 0U)
             {
-               s32_Return = C_NO_ERR;
+               (void)memcpy(&orc_Data[0], &rc_Connection.c_RxBuffer[rc_Connection.u32_RxBufferReadPosition],
+                            u32_NumBytes);
+               rc_Connection.u32_RxBufferReadPosition += u32_NumBytes;
             }
-            else
+            if (rc_Connection.GetNumRxBytesAvailable() == 0U)
             {
-               //comm error: no data read even though it was reported by ioctl
-               osc_write_log_error("openSYDE IP-TP",
-                                   "TCP unexpected error: data reported as available but reading failed. IP-Address: " +
-                                   mh_IpToText(this->mc_SocketsTcp[ou32_Handle].au8_IpAddress));
-               s32_Return = C_RD_WR;
+               rc_Connection.ClearRxBuffer();
             }
-         }
-         else if (x_Return == -1)
-         {
-            C_SclString c_ErrnoStr = strerror(errno);
-            osc_write_log_error("openSYDE IP-TP", "Could not read TCP: buffer count could not be read. Error: " +
-                                c_ErrnoStr + " IP-Address: " +
-                                mh_IpToText(this->mc_SocketsTcp[ou32_Handle].au8_IpAddress));
+            s32_Return = C_NO_ERR;
          }
          else
          {
             //not enough data -> done here
+            s32_Return = C_NOACT;
          }
       }
    }
@@ -1050,6 +1156,57 @@ int32_t C_OscIpDispatcherLinuxSock::ReadTcpBuffer(const uint8_t ou8_ClientBusIde
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wait for incoming data on TCP socket
+
+   Put the calling thread to sleep until data is available on the TCP socket or the timeout expired.
+
+   \param[in]  ou32_Handle      handle obtained by InitTcp()
+   \param[in]  ou32_TimeoutMs   maximum time to wait in milliseconds
+
+   \return
+   C_NO_ERR   data available (or connection closed by peer; will be reported by ReadTcp())
+   C_TIMEOUT  no data received within timeout
+   C_CONFIG   required socket not initialized
+   C_RANGE    handle invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscIpDispatcherLinuxSock::WaitForTcpData(const uint32_t ou32_Handle, const uint32_t ou32_TimeoutMs)
+{
+   int32_t s32_Return;
+
+   if (ou32_Handle >= this->mc_SocketsTcp.size())
+   {
+      s32_Return = C_RANGE;
+   }
+   else if (this->mc_SocketsTcp[ou32_Handle].s32_Socket == INVALID_SOCKET)
+   {
+      s32_Return = C_CONFIG;
+   }
+   else if (this->mc_SocketsTcp[ou32_Handle].GetNumRxBytesAvailable() > 0U)
+   {
+      //already received; the socket would not report this data again
+      s32_Return = C_NO_ERR;
+   }
+   else
+   {
+      const int32_t s32_Socket = this->mc_SocketsTcp[ou32_Handle].s32_Socket;
+      fd_set c_SocketReadSet;
+      timeval c_TimeOut;
+      int x_Return; //lint !e8080 !e970 //using type to match library interface
+
+      FD_ZERO(&c_SocketReadSet);
+      FD_SET(s32_Socket, &c_SocketReadSet);
+      c_TimeOut.tv_sec = static_cast<time_t>(ou32_TimeoutMs / 1000U);
+      c_TimeOut.tv_usec = static_cast<suseconds_t>((ou32_TimeoutMs % 1000U) * 1000U);
+
+      x_Return = select(s32_Socket + 1, &c_SocketReadSet, NULL, NULL, &c_TimeOut);
+      //on error (e.g. EINTR) let the caller check the socket by reading
+      s32_Return = (x_Return == 0) ? C_TIMEOUT : C_NO_ERR;
+   }
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Send broadcast package on UDP request socket
 
@@ -1139,75 +1296,92 @@ int32_t C_OscIpDispatcherLinuxSock::ReadUdp(std::vector<uint8_t> & orc_Data, uin
    }
    else
    {
-      //do we have a package in RX buffer ?
-      //lint !e8080 !e970 //using type to match library interface
-      int x_SizeInBuffer;
-      //lint !e8080 !e970 //using type to match library interface
-      int x_Return = ioctl(ms32_SocketUdpServer, FIONREAD, &x_SizeInBuffer);
+      //datagrams are fetched from the socket in batches; report one per call
+      if (mc_UdpRxQueue.size() == 0U)
+      {
+         this->m_FillUdpRxQueue();
+      }
 
-      if ((x_Return == 0) && (x_SizeInBuffer >= 1))
+      if (mc_UdpRxQueue.size() > 0U)
       {
-         sockaddr_in t_Sender;
-         socklen_t t_AddressSize = sizeof(t_Sender);
-         //enough bytes: read
-         orc_Data.resize(x_SizeInBuffer);
-
-         //lint -e{926,929} Side-effect of the "char"-based API. No problems as long as we are on Windows.
-         //lint -e{740}     Side-effect of the POSIX-style API. Match is guaranteed by the API.
-         x_Return = recvfrom(ms32_SocketUdpServer, reinterpret_cast<char_t *>(&orc_Data[0]),
-                             orc_Data.size(), 0, reinterpret_cast<sockaddr *>(&t_Sender),
-                             &t_AddressSize);
-
-         //there might be more than one package in the buffer; recvfrom only reads one
-         //so we check whether we have more than zero bytes:
-         if (x_Return > 0)
-         {
-            //extract sender address
-            const uint32_t u32_IpAddr = ntohl(t_Sender.sin_addr.s_addr);
-            orau8_Ip[0] = (u32_IpAddr >> 24) & 0x0FF;
-            orau8_Ip[1] = (u32_IpAddr >> 16) & 0x0FF;
-            orau8_Ip[2] = (u32_IpAddr >> 8) & 0x0FF;
-            orau8_Ip[3] = u32_IpAddr & 0x0FF;
+         C_UdpDatagram & rc_Datagram = mc_UdpRxQueue.front();
+         orc_Data.swap(rc_Datagram.c_Data);
+         (void)memcpy(&orau8_Ip[0], &rc_Datagram.au8_IpAddress[0], 4U);
+         mc_UdpRxQueue.pop_front();
+         s32_Return = C_NO_ERR;
+      }
+   }
 
-            if (x_Return != static_cast<int>(orc_Data.size())) //lint !e970 //using type to match library interface
-            {
-               orc_Data.resize(x_Return); //we only need the data we really received
-            }
+   return s32_Return;
+}
 
-            //filter out local reception of broadcasts we sent ourselves
-            //strategy to identify those:
-            //Responses from real nodes are sent from Port 13400
-            //Our broadcasts are sent with dynamically assigned Port != 13400
-            //Also: we should not just accept anything that is thrown upon us ...
-            if (t_Sender.sin_port == htons(13400))
-            {
-               s32_Return = C_NO_ERR;
-            }
-            else
-            {
-               s32_Return = C_NOACT;
-            }
-         }
-         else
-         {
-            //comm error: no data read even though it was reported by ioctl
-            osc_write_log_error("openSYDE IP-TP",
-                                "ReadUdp unexpected error: data reported as available but reading failed. Reported size: " +
-                                C_SclString::IntToStr(
-                                   orc_Data.size()) + " Read size: " + C_SclString::IntToStr(s32_Return));
-            s32_Return = C_RD_WR;
-         }
-      }
-      else if (x_Return < 0)
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Utility: read all pending datagrams from UDP "server" socket into the RX queue
+
+   Reads up to mu32_UDP_RX_BATCH_SIZE datagrams with one recvmmsg() call.
+   Only datagrams sent from port 13400 are queued:
+   Responses from real nodes are sent from Port 13400.
+   Our own broadcasts (which we also receive) are sent with dynamically assigned Port != 13400.
+   Also: we should not just accept anything that is thrown upon us ...
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscIpDispatcherLinuxSock::m_FillUdpRxQueue(void)
+{
+   mmsghdr at_Messages[mu32_UDP_RX_BATCH_SIZE];
+   iovec at_IoVectors[mu32_UDP_RX_BATCH_SIZE];
+   sockaddr_in at_Senders[mu32_UDP_RX_BATCH_SIZE];
+   int x_NumReceived; //lint !e8080 !e970 //using type to match library interface
+
+   (void)memset(&at_Messages[0], 0, sizeof(at_Messages));
+   for (uint32_t u32_Message = 0U; u32_Message < mu32_UDP_RX_BATCH_SIZE; u32_Message++)
+   {
+      at_IoVectors[u32_Message].iov_base =
+         &this->mc_UdpRxBuffer[static_cast<size_t>(u32_Message) * mu32_UDP_MAX_DATAGRAM_SIZE];
+      at_IoVectors[u32_Message].iov_len = mu32_UDP_MAX_DATAGRAM_SIZE;
+      at_Messages[u32_Message].msg_hdr.msg_iov = &at_IoVectors[u32_Message];
+      at_Messages[u32_Message].msg_hdr.msg_iovlen = 1;
+      at_Messages[u32_Message].msg_hdr.msg_name = &at_Senders[u32_Message];
+      at_Messages[u32_Message].msg_hdr.msg_namelen = sizeof(at_Senders[u32_Message]);
+   }
+
+   x_NumReceived = recvmmsg(ms32_SocketUdpServer, &at_Messages[0], mu32_UDP_RX_BATCH_SIZE, 0, NULL);
+   if (x_NumReceived < 0)
+   {
+      if ((errno != EWOULDBLOCK) && (errno != EAGAIN))
       {
          // Write error to log, then ignore the error and continue
-         osc_write_log_error("openSYDE IP-TP", "ReadUdp called with invalid socket (ioctl(FIONREAD) failed).");
+         C_SclString c_ErrnoStr = strerror(errno);
+         osc_write_log_error("openSYDE IP-TP", "ReadUdp recvmmsg error: " + c_ErrnoStr);
       }
-      else
+   }
+   else
+   {
+      for (uint32_t u32_Message = 0U; u32_Message < static_cast<uint32_t>(x_NumReceived); u32_Message++)
       {
-         // No data available, nothing to do...
+         const mmsghdr & rt_Message = at_Messages[u32_Message];
+         if ((rt_Message.msg_hdr.msg_flags & MSG_TRUNC) != 0)
+         {
+            osc_write_log_warning("openSYDE IP-TP", "ReadUdp: datagram too big. Ignored.");
+         }
+         else if ((rt_Message.msg_len > 0U) && (at_Senders[u32_Message].sin_port == htons(mhu16_UDP_TCP_PORT)))
+         {
+            //extract sender address
+            const uint32_t u32_IpAddr = ntohl(at_Senders[u32_Message].sin_addr.s_addr);
+            const uint8_t * const pu8_Data =
+               &this->mc_UdpRxBuffer[static_cast<size_t>(u32_Message) * mu32_UDP_MAX_DATAGRAM_SIZE];
+            C_UdpDatagram c_Datagram;
+
+            c_Datagram.au8_IpAddress[0] = static_cast<uint8_t>((u32_IpAddr >> 24) & 0x0FFU);
+            c_Datagram.au8_IpAddress[1] = static_cast<uint8_t>((u32_IpAddr >> 16) & 0x0FFU);
+            c_Datagram.au8_IpAddress[2] = static_cast<uint8_t>((u32_IpAddr >> 8) & 0x0FFU);
+            c_Datagram.au8_IpAddress[3] = static_cast<uint8_t>(u32_IpAddr & 0x0FFU);
+            c_Datagram.c_Data.assign(pu8_Data, pu8_Data + rt_Message.msg_len);
+            mc_UdpRxQueue.push_back(c_Datagram);
+         }
+         else
+         {
+            //own broadcast or unexpected traffic: ignore
+         }
       }
    }
-
-   return s32_Return;
 }
@@ -38,8 +38,20 @@ private:
    class C_TcpConnection
    {
    public:
-      int32_t s32_Socket;       ///< client socket
-      uint8_t au8_IpAddress[4]; ///< server's IP (remembered for reconnecting)
+      int32_t s32_Socket;                ///< client socket
+      uint8_t au8_IpAddress[4];          ///< server's IP (remembered for reconnecting)
+      std::vector<uint8_t> c_RxBuffer;   ///< received but not yet consumed data
+      uint32_t u32_RxBufferReadPosition; ///< index of first not yet consumed byte in c_RxBuffer
+
+      void ClearRxBuffer(void);
+      uint32_t GetNumRxBytesAvailable(void) const;
+   };
+
+   class C_UdpDatagram
+   {
+   public:
+      std::vector<uint8_t> c_Data; ///< payload of datagram
+      uint8_t au8_IpAddress[4];    ///< sender's IP
    };
 
    class C_BufferIdentifier
@@ -69,12 +81,17 @@ private:
 
    std::vector<uint32_t> mc_LocalInterfaceIps; ///< IPs of local interfaces
 
+   std::list<C_UdpDatagram> mc_UdpRxQueue; ///< received but not yet reported UDP datagrams
+   std::vector<uint8_t> mc_UdpRxBuffer;    ///< receive buffer for one recvmmsg() batch (allocated once)
+
    static std::map<C_BufferIdentifier, std::list<std::vector<uint8_t> > > mhc_TcpBuffer; ///< dispatcher buffer
    static stw::tgl::C_TglCriticalSection mhc_LockBuffer;
 
    int32_t m_GetAllInstalledInterfaceIps(void);
    int32_t m_ConnectTcp(C_TcpConnection & orc_Connection) const;
    int32_t m_ConfigureUdpSocket(const bool oq_ServerPort, const uint32_t ou32_IpToBindTo, int32_t & ors32_Socket) const;
+   int32_t m_FillTcpRxBuffer(C_TcpConnection & orc_Connection, const uint32_t ou32_NumBytesRequired) const;
+   void m_FillUdpRxQueue(void);
 
    static stw::scl::C_SclString mh_IpToText(const uint8_t (&orau8_Ip)[4]);
 
@@ -97,6 +114,7 @@ public:
    virtual int32_t ReadTcpBuffer(const uint8_t ou8_ClientBusIdentifier, const uint8_t ou8_ClientNodeIdentifier,
                                  const uint8_t ou8_ServerBusIdentifier, const uint8_t ou8_ServerNodeIdentifier,
                                  std::vector<uint8_t> & orc_Data);
+   virtual int32_t WaitForTcpData(const uint32_t ou32_Handle, const uint32_t ou32_TimeoutMs);
    virtual int32_t SendUdp(const std::vector<uint8_t> & orc_Data);
    virtual int32_t ReadUdp(std::vector<uint8_t> &orc_Data, uint8_t(&orau8_Ip)[4]);
 };
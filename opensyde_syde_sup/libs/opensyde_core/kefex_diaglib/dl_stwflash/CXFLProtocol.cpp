@@ -494,9 +494,11 @@ int32_t C_XFLProtocol::SendFLASH(const uint32_t ou32_StartTimeMs, const uint8_t
    TRG_ReportProgress(0U, TGL_LoadStr(STR_FDL_TXT_WR_FLASH_RQ));
    do
    {
+      //interval is measured from the start of sending so it does not grow by the time needed for sending
+      const uint64_t u64_SendTime = TglGetTickCountUs();
       (void)m_SendFlashMessage(); //do not check for return = OK here:
                                   //network might still be down resulting in send errors
-      TRG_WaitMicroSeconds(static_cast<uint32_t>(ou8_FLASHIntervalMs) * 1000U);
+      TRG_WaitUntilMicroSeconds(u64_SendTime + (static_cast<uint64_t>(ou8_FLASHIntervalMs) * 1000U));
       TRG_HandleSystemMessages(); //prevent system from freezing
       u32_Elapsed = TglGetTickCount() - u32_StartTime;
       if (ou32_StartTimeMs != 0U)
@@ -588,7 +590,8 @@ int32_t C_XFLProtocol::EraseSector(const uint16_t ou16_SectorNumber, const uint3
 */
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_XFLProtocol::m_WaitForResponse(const uint8_t ou8_ExpectedLocalID, const uint32_t ou32_TimeOutMS,
-                                         const uint8_t (&orau8_Match)[8], const uint8_t ou8_NumExpectedToMatch,
+                                         const uint8_t (&orau8_Match)[STWCAN_FD_MAX_DLC],
+                                         const uint8_t ou8_NumExpectedToMatch,
                                          T_STWCAN_Msg_RX * const opc_MSG, const int16_t os16_CheckDLC)
 {
    uint32_t u32_StartTime;
@@ -685,6 +688,7 @@ int32_t C_XFLProtocol::m_SendHexLine(const uint8_t * const opu8_HexLine, const u
    {
       uint8_t u8_SendNow;
       int32_t s32_Counter;
+      uint64_t u64_FrameTime;
       u32_Tries++;
       s32_Counter = 1;
       s32_RemainingLength = ou16_LineSize;
@@ -696,6 +700,7 @@ int32_t C_XFLProtocol::m_SendHexLine(const uint8_t * const opu8_HexLine, const u
          (void)memcpy(&mc_CanWriteMessage.au8_Data[1], &opu8_HexLine[s32_Counter - 1], u8_SendNow);
          s32_Counter += u8_SendNow;
          mc_CanWriteMessage.u8_DLC = static_cast<uint8_t>(1U + u8_SendNow);
+         u64_FrameTime = TglGetTickCountUs();
          s32_Return = m_SendMessageWithIDs();
          if (s32_Return != C_NO_ERR)
          {
@@ -705,7 +710,9 @@ int32_t C_XFLProtocol::m_SendHexLine(const uint8_t * const opu8_HexLine, const u
          s32_RemainingLength -= u8_SendNow;
          if (s32_RemainingLength > 0)
          {
-            TRG_WaitMicroSeconds(ou32_InterFrameDelayUs); // TX-delay between individual messages
+            // TX-delay between individual messages; measured from the start of sending so the gap does not grow
+            // by the time needed for sending
+            TRG_WaitUntilMicroSeconds(u64_FrameTime + ou32_InterFrameDelayUs);
             TRG_HandleSystemMessages();
          }
       }
@@ -4425,9 +4432,10 @@ void C_XFLProtocol::TRG_ReportStatus(const C_SclString & orc_Text, const uint8_t
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-/*! \brief   Active waiting
+/*! \brief   Wait for a period of time
 
-   Actively wait for a number of micro seconds
+   Wait for a number of micro seconds using TglDelayUs().
+   Sleeps for most of the time and only actively waits for the remaining part below the sleep resolution.
 
    \param[in]     ou32_NumUs            number of micro seconds to wait
 */
@@ -4437,6 +4445,20 @@ void C_XFLProtocol::TRG_WaitMicroSeconds(const uint32_t ou32_NumUs)
    TglDelayUs(ou32_NumUs);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wait up to point in time
+
+   Wait until the system time (as reported by TglGetTickCountUs) reaches the deadline.
+   Used to send with fixed intervals.
+
+   \param[in]     ou64_DeadlineUs       point in time to wait for in micro seconds
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_XFLProtocol::TRG_WaitUntilMicroSeconds(const uint64_t ou64_DeadlineUs)
+{
+   TglDelayUntilUs(ou64_DeadlineUs);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Perform operating system message handling
 
@@ -28,6 +28,7 @@
 
 #include <cstring>
 #include <cctype>
+#include <vector>
 
 #include "C_HexFile.hpp"
 #include "stwtypes.hpp"
@@ -85,6 +86,30 @@ static const uint32_t mu32_XADR32_MASK  =   0xFFFF0000U;
 static const uint32_t mu32_MAX_DWORD    =   0xFFFFFFFFU;
 static const uint32_t mu32_MIN_DWORD    =   0x00000000U;
 
+static const uint32_t mu32_FILE_BUFFER_SIZE = 0x10000U; // stdio buffer size used for reading hex files
+
+// ASCII character to nibble value; 0xFF for characters that are no hex digit
+static const uint8_t mu8_NIBBLE_INVALID = 0xFFU;
+static const uint8_t mau8_NIBBLE_VALUES[256] =
+{
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0x00U, 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U, 0x08U, 0x09U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0x0AU, 0x0BU, 0x0CU, 0x0DU, 0x0EU, 0x0FU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0x0AU, 0x0BU, 0x0CU, 0x0DU, 0x0EU, 0x0FU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU
+};
+
 //------------------------------------------------------------------------
 
 C_HexFile::C_HexFile(void) :
@@ -136,6 +161,8 @@ uint32_t C_HexFile::LoadFromFile(const char_t * const opcn_FileName)
    int32_t s32_FileType;
 
    std::FILE * pc_File;
+   //read the file in big chunks instead of the default stdio buffer size; must stay valid until fclose
+   std::vector<char_t> c_FileBuffer;
 
    this->Clear();
    pc_File = std::fopen(opcn_FileName, "rt");
@@ -146,6 +173,16 @@ uint32_t C_HexFile::LoadFromFile(const char_t * const opcn_FileName)
    }
    else
    {
+      try
+      {
+         c_FileBuffer.resize(mu32_FILE_BUFFER_SIZE);
+         (void)std::setvbuf(pc_File, &c_FileBuffer[0], _IOFBF, c_FileBuffer.size());
+      }
+      catch (...)
+      {
+         //no problem; just use default buffer
+      }
+
       u32_Error = this->m_GetFileType(pc_File, s32_FileType); // get hex file type
       // intel-hex, s-record, ...
       if (u32_Error == NO_ERR)
@@ -1975,50 +2012,16 @@ uint32_t C_HexFile::mh_CalcCheck(char_t * const opcn_String)
 //************************************************************************
 uint32_t C_HexFile::mh_GetByte(const char_t * const opcn_String, const uint32_t ou32_Index, uint8_t & oru8_Data)
 {
-   uint32_t u32_Error = ERR_HEXLINE_SYNTAX;
-   uint32_t u32_Index = ou32_Index;
-   uint8_t u8_HiNib;
-   uint8_t u8_LoNib;
-
-   u32_Index = (u32_Index * 2U) + 1U;
-   u8_HiNib = static_cast<uint8_t>(opcn_String[u32_Index]);
-   u8_LoNib = static_cast<uint8_t>(opcn_String[u32_Index + 1]);
+   const uint32_t u32_Index = (ou32_Index * 2U) + 1U;
+   const uint8_t u8_HiNib = mau8_NIBBLE_VALUES[static_cast<uint8_t>(opcn_String[u32_Index])];
+   const uint8_t u8_LoNib = mau8_NIBBLE_VALUES[static_cast<uint8_t>(opcn_String[u32_Index + 1])];
 
-   if ((u8_HiNib >= static_cast<uint8_t>('0')) && (u8_HiNib <= static_cast<uint8_t>('9')))
-   {
-      u8_HiNib = static_cast<uint8_t>((static_cast<uint8_t>(u8_HiNib - 0x30U)) << 4);
-   }
-   else
+   if ((u8_HiNib == mu8_NIBBLE_INVALID) || (u8_LoNib == mu8_NIBBLE_INVALID))
    {
-      u8_HiNib |= 0x20U; // A..F to lower case a..f
-      if ((u8_HiNib >= 0x61U) && (u8_HiNib <= 0x66U))
-      {
-         u8_HiNib = static_cast<uint8_t>((static_cast<uint8_t>(u8_HiNib - 0x57U)) << 4);
-      }
-      else
-      {
-         return (u32_Error);
-      }
+      return ERR_HEXLINE_SYNTAX;
    }
 
-   if ((u8_LoNib >= static_cast<uint8_t>('0')) && (u8_LoNib <= static_cast<uint8_t>('9')))
-   {
-      u8_LoNib = static_cast<uint8_t>(u8_LoNib - 0x30U);
-   }
-   else
-   {
-      u8_LoNib |= 0x20U; // A..F to lower case a..f
-      if ((u8_LoNib >= 0x61U) && (u8_LoNib <= 0x66U))
-      {
-         u8_LoNib = static_cast<uint8_t>(u8_LoNib - 0x57U);
-      }
-      else
-      {
-         return (u32_Error);
-      }
-   }
-
-   oru8_Data = (u8_HiNib | u8_LoNib);
+   oru8_Data = static_cast<uint8_t>((static_cast<uint32_t>(u8_HiNib) << 4U) | u8_LoNib);
    return NO_ERR;
 }
 
@@ -2194,6 +2197,43 @@ const uint8_t * C_HexFile::NextLine(void)
    return (pu8_Line);
 }
 
+//-----------------------------------------------------------------------------
+/*!
+   \brief   find memory dump block by address
+
+   Binary search for the block with the highest start address that is less or equal than the specified address.
+   Relies on the blocks being sorted by address and not overlapping (ensured by GetDataDump()).
+
+   \param[in]     orc_Dump       memory dump to search in
+   \param[in]     ou32_Address   absolute address
+
+   \return
+   >= 0     index of block starting at or before ou32_Address (the address might be behind the end of the block)
+   -1       ou32_Address is located before the first block
+*/
+//-----------------------------------------------------------------------------
+int32_t C_HexFile::mh_FindBlock(const C_HexDataDump & orc_Dump, const uint32_t ou32_Address)
+{
+   int32_t s32_Low = 0;
+   int32_t s32_High = orc_Dump.at_Blocks.GetLength() - 1;
+   int32_t s32_Result = -1;
+
+   while (s32_Low <= s32_High)
+   {
+      const int32_t s32_Middle = s32_Low + ((s32_High - s32_Low) / 2);
+      if (orc_Dump.at_Blocks[s32_Middle].u32_AddressOffset <= ou32_Address)
+      {
+         s32_Result = s32_Middle;
+         s32_Low = s32_Middle + 1;
+      }
+      else
+      {
+         s32_High = s32_Middle - 1;
+      }
+   }
+   return s32_Result;
+}
+
 //-----------------------------------------------------------------------------
 /*!
    \brief   returns a number of bytes from an absolute address
@@ -2228,11 +2268,11 @@ int32_t C_HexFile::GetDataByAddress(const uint32_t ou32_Address, uint16_t & oru1
       return -1;
    }
 
-   for (s32_Block = 0; s32_Block < pc_HexFileData->at_Blocks.GetLength(); s32_Block++)
+   s32_Block = mh_FindBlock(*pc_HexFileData, ou32_Address);
+   if (s32_Block >= 0)
    {
       u32_BlockLength = pc_HexFileData->at_Blocks[s32_Block].au8_Data.GetLength();
-      if ((ou32_Address <= (pc_HexFileData->at_Blocks[s32_Block].u32_AddressOffset + u32_BlockLength)) &&
-          (ou32_Address >= pc_HexFileData->at_Blocks[s32_Block].u32_AddressOffset))
+      if (ou32_Address <= (pc_HexFileData->at_Blocks[s32_Block].u32_AddressOffset + u32_BlockLength))
       {
          //it's in this block !
          //it must be completely in this block, as we do not want to read undefined data from any gaps !
@@ -2340,7 +2380,14 @@ int32_t C_HexFile::FindPattern(uint32_t & oru32_Address, const uint8_t ou8_Patte
       return -1;
    }
 
-   for (s32_Block = 0; s32_Block < pc_HexFileData->at_Blocks.GetLength(); s32_Block++)
+   //skip all blocks before the start address
+   s32_Block = mh_FindBlock(*pc_HexFileData, oru32_Address);
+   if (s32_Block < 0)
+   {
+      s32_Block = 0;
+   }
+
+   for (; s32_Block < pc_HexFileData->at_Blocks.GetLength(); s32_Block++)
    {
       u32_BlockLength = pc_HexFileData->at_Blocks[s32_Block].au8_Data.GetLength();
       if (oru32_Address < (pc_HexFileData->at_Blocks[s32_Block].u32_AddressOffset + u32_BlockLength))
@@ -2399,22 +2446,21 @@ int32_t C_HexFile::FindPattern(uint32_t & oru32_Address, const uint8_t ou8_Patte
 //-----------------------------------------------------------------------------
 const C_HexDataDump * C_HexFile::GetDataDump(uint32_t & oru32_ErrorResult)
 {
-   uint32_t u32_NumBlocks;
    int64_t s64_LastAddress;
    int32_t s32_BlockIndex;
-   uint32_t u32_BlockSize;
    uint32_t u32_Index;
    const uint8_t * pu8_Data;
    uint32_t u32_Address;
    uint8_t u8_Size;
-   bool q_FirstBlock;
+   std::vector<uint32_t> c_BlockOffsets;
+   std::vector<uint32_t> c_BlockSizes;
 
    if (mq_DumpIsDirty == false)
    {
       oru32_ErrorResult = NO_ERR;
       return &this->mc_Dump;
    }
-   //First go through whole data and detect number of blocks
+   //First go through whole data and detect position and size of all blocks
    //This will improve speed as we do not need to resize the DynamicArray, potentially
    // already containing a lot of data, all the time.
    pu8_Data = LineInit();
@@ -2425,86 +2471,49 @@ const C_HexDataDump * C_HexFile::GetDataDump(uint32_t & oru32_ErrorResult)
    }
 
    s64_LastAddress = -2; //-2 -> make sure that a block is detected at the first line
-   u32_NumBlocks = 0U;
-   while (pu8_Data != NULL)
-   {
-      pu8_Data = NextBinData(u32_Address, u8_Size);
-      if (pu8_Data != NULL)
-      {
-         //memory overlap ? (we assume hex file data already sorted by address)
-         if (static_cast<int64_t>(u32_Address) < s64_LastAddress)
-         {
-            oru32_ErrorResult = WRN_RECORD_OVERLAY | ((u32_Address) & ~ERR_MASK);
-            mu32_LastOverlayErrorAddress = u32_Address;
-            return NULL;
-         }
-         else if (static_cast<int64_t>(u32_Address) > s64_LastAddress)
-         {
-            u32_NumBlocks++; //new block detected
-         }
-         else
-         {
-            //nothing to do ...
-         }
-
-         s64_LastAddress = static_cast<int64_t>(u32_Address) + u8_Size;
-      }
-   }
-
-   //now size the array accordingly:
    try
    {
-      mc_Dump.at_Blocks.SetLength(u32_NumBlocks);
-   }
-   catch (...)
-   {
-      oru32_ErrorResult = ERR_NOT_ENOUGH_MEMORY;
-      return NULL;
-   }
-
-   pu8_Data = LineInit();
-   s64_LastAddress = -2; //-2 -> make sure that a block is detected at the first line
-   s32_BlockIndex = 0;
-   u32_BlockSize = 0U;
-
-   //again: first check how big each block is for performance reasons ...
-   q_FirstBlock = true;
-   while (pu8_Data != NULL)
-   {
-      pu8_Data = NextBinData(u32_Address, u8_Size);
-      if (pu8_Data != NULL)
+      while (pu8_Data != NULL)
       {
-         if (q_FirstBlock == true) //start of block
+         pu8_Data = NextBinData(u32_Address, u8_Size);
+         if (pu8_Data != NULL)
          {
-            //set offset of block:
-            mc_Dump.at_Blocks[s32_BlockIndex].u32_AddressOffset = u32_Address;
-            q_FirstBlock = false;
-         }
-
-         if ((static_cast<int64_t>(u32_Address) > s64_LastAddress) && (u32_BlockSize > 0U))
-         {
-            //new block -> set size of last one
-            try
+            //memory overlap ? (we assume hex file data already sorted by address)
+            if (static_cast<int64_t>(u32_Address) < s64_LastAddress)
             {
-               mc_Dump.at_Blocks[s32_BlockIndex].au8_Data.SetLength(u32_BlockSize);
+               oru32_ErrorResult = WRN_RECORD_OVERLAY | ((u32_Address) & ~ERR_MASK);
+               mu32_LastOverlayErrorAddress = u32_Address;
+               return NULL;
             }
-            catch (...)
+            else if ((c_BlockSizes.size() == 0U) ||
+                     ((static_cast<int64_t>(u32_Address) > s64_LastAddress) && (c_BlockSizes.back() > 0U)))
             {
-               oru32_ErrorResult = ERR_NOT_ENOUGH_MEMORY;
-               return NULL;
+               //new block detected
+               c_BlockOffsets.push_back(u32_Address);
+               c_BlockSizes.push_back(0U);
             }
-            s32_BlockIndex++; //new block detected
-            u32_BlockSize = 0U;
-            mc_Dump.at_Blocks[s32_BlockIndex].u32_AddressOffset = u32_Address;
+            else if (c_BlockSizes.back() == 0U)
+            {
+               //block only contained empty records so far: starts at this record
+               c_BlockOffsets.back() = u32_Address;
+            }
+            else
+            {
+               //nothing to do ...
+            }
+
+            c_BlockSizes.back() += u8_Size;
+            s64_LastAddress = static_cast<int64_t>(u32_Address) + u8_Size;
          }
-         u32_BlockSize += u8_Size;
-         s64_LastAddress = static_cast<int64_t>(u32_Address) + u8_Size;
       }
-   }
-   //final block:
-   try
-   {
-      mc_Dump.at_Blocks[s32_BlockIndex].au8_Data.SetLength(u32_BlockSize);
+
+      //now size the array accordingly:
+      mc_Dump.at_Blocks.SetLength(static_cast<int32_t>(c_BlockSizes.size()));
+      for (uint32_t u32_Block = 0U; u32_Block < c_BlockSizes.size(); u32_Block++)
+      {
+         mc_Dump.at_Blocks[u32_Block].u32_AddressOffset = c_BlockOffsets[u32_Block];
+         mc_Dump.at_Blocks[u32_Block].au8_Data.SetLength(c_BlockSizes[u32_Block]);
+      }
    }
    catch (...)
    {
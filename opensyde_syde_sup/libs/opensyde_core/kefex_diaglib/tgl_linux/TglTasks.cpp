@@ -13,6 +13,7 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <unistd.h>
 #include <signal.h>
+#include <time.h>
 #include "stwtypes.hpp"
 #include "TglTasks.hpp"
 
@@ -23,12 +24,24 @@ using namespace stw::tgl;
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
+///Items to be processed by TglParallelFor
+class C_TglParallelForJobs
+{
+public:
+   PR_TglParallelForFunction pr_Function; ///< function to execute per item
+   void * pv_Instance;                    ///< argument for pr_Function
+   uint32_t u32_NumItems;                 ///< number of items to process
+   uint32_t u32_NextItem;                 ///< index of next item to process; protected by c_Lock
+   C_TglCriticalSection c_Lock;           ///< for locking access to u32_NextItem
+};
 
 /* -- Global Variables ---------------------------------------------------------------------------------------------- */
 
 /* -- Module Global Variables --------------------------------------------------------------------------------------- */
 
 /* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+static uint32_t m_GetNumberOfCores(void);
+static void m_ParallelForWorker(void * const opv_Jobs);
 
 /* -- Implementation ------------------------------------------------------------------------------------------------ */
 
@@ -75,3 +88,242 @@ void C_TglCriticalSection::Release(void)
 }
 
 //----------------------------------------------------------------------------------------------------------------------
+
+C_TglEvent::C_TglEvent(void) :
+   mq_Signaled(false)
+{
+   pthread_condattr_t t_Attributes;
+
+   pthread_mutex_init(&mt_Mutex, NULL);
+   //use monotonic clock for timed waits so changing the system time has no effect:
+   pthread_condattr_init(&t_Attributes);
+   pthread_condattr_setclock(&t_Attributes, CLOCK_MONOTONIC);
+   pthread_cond_init(&mt_Condition, &t_Attributes);
+   pthread_condattr_destroy(&t_Attributes);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_TglEvent::~C_TglEvent(void)
+{
+   pthread_cond_destroy(&mt_Condition);
+   pthread_mutex_destroy(&mt_Mutex);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//set event; releases one waiting thread (or the next one to wait if there is none waiting)
+void C_TglEvent::Signal(void)
+{
+   pthread_mutex_lock(&mt_Mutex);
+   mq_Signaled = true;
+   pthread_cond_signal(&mt_Condition);
+   pthread_mutex_unlock(&mt_Mutex);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   wait for event to be signaled
+
+   The event is reset when the function returns.
+
+   \param[in]   ou32_TimeoutMs    maximum time to wait in milliseconds
+
+   \return
+   true      event was signaled
+   false     timeout
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_TglEvent::Wait(const uint32_t ou32_TimeoutMs)
+{
+   bool q_Return;
+   struct timespec t_Deadline;
+   int sn_Ret = 0;
+
+   (void)clock_gettime(CLOCK_MONOTONIC, &t_Deadline);
+   t_Deadline.tv_sec += static_cast<time_t>(ou32_TimeoutMs / 1000U);
+   t_Deadline.tv_nsec += static_cast<long>((ou32_TimeoutMs % 1000U) * 1000000U); //lint !e970 !e8080 //type from API
+   if (t_Deadline.tv_nsec >= 1000000000L)
+   {
+      t_Deadline.tv_sec++;
+      t_Deadline.tv_nsec -= 1000000000L;
+   }
+
+   pthread_mutex_lock(&mt_Mutex);
+   while ((mq_Signaled == false) && (sn_Ret == 0))
+   {
+      sn_Ret = pthread_cond_timedwait(&mt_Condition, &mt_Mutex, &t_Deadline);
+   }
+   q_Return = mq_Signaled;
+   mq_Signaled = false;
+   pthread_mutex_unlock(&mt_Mutex);
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_TglThread::C_TglThread(void) :
+   mpr_Function(NULL),
+   mpv_Instance(NULL),
+   mq_Started(false)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//does not wait for the thread; call WaitForFinished() before
+C_TglThread::~C_TglThread(void)
+{
+   if (mq_Started == true)
+   {
+      pthread_detach(mt_Thread);
+   }
+   mpr_Function = NULL;
+   mpv_Instance = NULL;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   start thread
+
+   \param[in]   opr_Function    function to execute in the thread
+   \param[in]   opv_Instance    argument to pass to opr_Function
+
+   \return
+   true      thread started
+   false     thread was already started or could not be created
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_TglThread::Start(const PR_ThreadFunction opr_Function, void * const opv_Instance)
+{
+   bool q_Return = false;
+
+   if ((mq_Started == false) && (opr_Function != NULL))
+   {
+      mpr_Function = opr_Function;
+      mpv_Instance = opv_Instance;
+      if (pthread_create(&mt_Thread, NULL, &C_TglThread::mh_ThreadFunction, this) == 0)
+      {
+         mq_Started = true;
+         q_Return = true;
+      }
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//block until the thread function has returned; no effect if the thread was not started
+void C_TglThread::WaitForFinished(void)
+{
+   if (mq_Started == true)
+   {
+      pthread_join(mt_Thread, NULL);
+      mq_Started = false;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//true: thread was started and not waited for yet
+bool C_TglThread::IsStarted(void) const
+{
+   return mq_Started;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void * C_TglThread::mh_ThreadFunction(void * const opv_Thread)
+{
+   C_TglThread * const pc_Thread = reinterpret_cast<C_TglThread *>(opv_Thread);
+
+   pc_Thread->mpr_Function(pc_Thread->mpv_Instance);
+   return NULL;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   process items in parallel
+
+   Calls opr_Function once for each index from 0 to (ou32_NumItems - 1).
+   The items are processed with as many threads as the system has cores (the calling thread is one of them).
+   Returns after all items were processed.
+   Items are independent: opr_Function must not rely on the order of the calls and must synchronize access to
+    shared data itself.
+
+   \param[in]   ou32_NumItems   number of items to process
+   \param[in]   opr_Function    function to execute per item
+   \param[in]   opv_Instance    argument to pass to opr_Function
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void stw::tgl::TglParallelFor(const uint32_t ou32_NumItems, const PR_TglParallelForFunction opr_Function,
+                              void * const opv_Instance)
+{
+   if ((ou32_NumItems > 0U) && (opr_Function != NULL))
+   {
+      C_TglParallelForJobs c_Jobs;
+      uint32_t u32_NumThreads = m_GetNumberOfCores();
+      C_TglThread * pc_Threads = NULL;
+
+      c_Jobs.pr_Function = opr_Function;
+      c_Jobs.pv_Instance = opv_Instance;
+      c_Jobs.u32_NumItems = ou32_NumItems;
+      c_Jobs.u32_NextItem = 0U;
+
+      if (u32_NumThreads > ou32_NumItems)
+      {
+         u32_NumThreads = ou32_NumItems;
+      }
+      if (u32_NumThreads > 1U)
+      {
+         //if a thread can not be started its items are processed by the others
+         pc_Threads = new C_TglThread[u32_NumThreads - 1U];
+         for (uint32_t u32_ItThread = 0U; u32_ItThread < (u32_NumThreads - 1U); u32_ItThread++)
+         {
+            (void)pc_Threads[u32_ItThread].Start(&m_ParallelForWorker, &c_Jobs);
+         }
+      }
+      m_ParallelForWorker(&c_Jobs);
+      if (pc_Threads != NULL)
+      {
+         for (uint32_t u32_ItThread = 0U; u32_ItThread < (u32_NumThreads - 1U); u32_ItThread++)
+         {
+            pc_Threads[u32_ItThread].WaitForFinished();
+         }
+         delete[] pc_Threads;
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//process items of TglParallelFor until none are left
+static void m_ParallelForWorker(void * const opv_Jobs)
+{
+   C_TglParallelForJobs * const pc_Jobs = reinterpret_cast<C_TglParallelForJobs *>(opv_Jobs);
+   bool q_Done = false;
+
+   while (q_Done == false)
+   {
+      uint32_t u32_Item;
+      pc_Jobs->c_Lock.Acquire();
+      u32_Item = pc_Jobs->u32_NextItem;
+      if (u32_Item < pc_Jobs->u32_NumItems)
+      {
+         pc_Jobs->u32_NextItem++;
+      }
+      pc_Jobs->c_Lock.Release();
+
+      if (u32_Item < pc_Jobs->u32_NumItems)
+      {
+         pc_Jobs->pr_Function(pc_Jobs->pv_Instance, u32_Item);
+      }
+      else
+      {
+         q_Done = true;
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//number of available cores (at least 1)
+static uint32_t m_GetNumberOfCores(void)
+{
+   const long sn_NumCores = sysconf(_SC_NPROCESSORS_ONLN); //lint !e970 !e8080 //type from API
+
+   return (sn_NumCores > 1L) ? static_cast<uint32_t>(sn_NumCores) : 1U;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
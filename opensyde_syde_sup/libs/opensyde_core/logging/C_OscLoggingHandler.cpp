@@ -12,6 +12,7 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "precomp_headers.hpp"
 
+#include <cstdio>
 #include <iostream>
 #include <sstream>
 #include <iomanip>
@@ -40,11 +41,150 @@ C_SclString C_OscLoggingHandler::mhc_FileName = "";
 C_TglCriticalSection C_OscLoggingHandler::mhc_ConsoleCriticalSection;
 C_TglCriticalSection C_OscLoggingHandler::mhc_FileCriticalSection;
 std::ofstream C_OscLoggingHandler::mhc_File;
+uint32_t C_OscLoggingHandler::mhu32_MaxFileSize = 0U;
+uint64_t C_OscLoggingHandler::mhu64_FileSize = 0U;
+const uint32_t C_OscLoggingHandler::mhu32_QUEUE_CAPACITY = 4096U;
+C_OscLoggingQueue C_OscLoggingHandler::mhc_Queue(C_OscLoggingHandler::mhu32_QUEUE_CAPACITY);
+std::atomic<uint32_t> C_OscLoggingHandler::mhc_NumDroppedEntries(0U);
+uint32_t C_OscLoggingHandler::mhu32_NumReportedDroppedEntries = 0U;
+std::atomic<bool> C_OscLoggingHandler::mhc_WriterRunning(false);
+std::atomic<uint32_t> C_OscLoggingHandler::mhc_NumProducers(0U);
+std::atomic<bool> C_OscLoggingHandler::mhc_StopWriter(false);
+C_TglEvent C_OscLoggingHandler::mhc_WriterEvent;
+C_TglThread C_OscLoggingHandler::mhc_WriterThread;
+thread_local std::vector<std::string> * C_OscLoggingHandler::mhpc_CapturedEntries = NULL;
 
 /* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
 
 /* -- Implementation ------------------------------------------------------------------------------------------------ */
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscLoggingQueue::C_Cell::C_Cell(void) :
+   c_Sequence(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Constructor
+
+   \param[in] ou32_Capacity  maximum number of entries (must be a power of two)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscLoggingQueue::C_OscLoggingQueue(const uint32_t ou32_Capacity) :
+   mc_Cells(ou32_Capacity),
+   mu32_IndexMask(ou32_Capacity - 1U),
+   mc_WriteIndex(0U),
+   mc_ReadIndex(0U)
+{
+   tgl_assert((ou32_Capacity != 0U) && ((ou32_Capacity & (ou32_Capacity - 1U)) == 0U));
+   for (uint32_t u32_Index = 0U; u32_Index < ou32_Capacity; u32_Index++)
+   {
+      mc_Cells[u32_Index].c_Sequence.store(u32_Index, std::memory_order_relaxed);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add entry to queue
+
+   Can be called concurrently from any number of threads.
+   Does not block: if the queue is full the function returns immediately.
+
+   \param[in,out] orc_Entry  entry to add; content is moved into the queue on success
+
+   \return
+   true    entry added
+   false   queue is full
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscLoggingQueue::Push(std::string & orc_Entry)
+{
+   bool q_Return = false;
+   bool q_Done = false;
+   uint32_t u32_Position = mc_WriteIndex.load(std::memory_order_relaxed);
+
+   while (q_Done == false)
+   {
+      C_Cell & rc_Cell = mc_Cells[u32_Position & mu32_IndexMask];
+      const uint32_t u32_Sequence = rc_Cell.c_Sequence.load(std::memory_order_acquire);
+      const int32_t s32_Difference = static_cast<int32_t>(u32_Sequence - u32_Position);
+
+      if (s32_Difference == 0)
+      {
+         //cell is free: try to claim it; on failure u32_Position is updated and we retry
+         if (mc_WriteIndex.compare_exchange_weak(u32_Position, u32_Position + 1U, std::memory_order_relaxed) == true)
+         {
+            rc_Cell.c_Entry = std::move(orc_Entry);
+            rc_Cell.c_Sequence.store(u32_Position + 1U, std::memory_order_release);
+            q_Return = true;
+            q_Done = true;
+         }
+      }
+      else if (s32_Difference < 0)
+      {
+         //cell was not read yet: queue is full
+         q_Done = true;
+      }
+      else
+      {
+         //another producer was faster
+         u32_Position = mc_WriteIndex.load(std::memory_order_relaxed);
+      }
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get oldest entry from queue
+
+   \param[out] orc_Entry  oldest entry (only valid if the function returns true)
+
+   \return
+   true    entry returned
+   false   queue is empty
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscLoggingQueue::Pop(std::string & orc_Entry)
+{
+   bool q_Return = false;
+   bool q_Done = false;
+   uint32_t u32_Position = mc_ReadIndex.load(std::memory_order_relaxed);
+
+   while (q_Done == false)
+   {
+      C_Cell & rc_Cell = mc_Cells[u32_Position & mu32_IndexMask];
+      const uint32_t u32_Sequence = rc_Cell.c_Sequence.load(std::memory_order_acquire);
+      const int32_t s32_Difference = static_cast<int32_t>(u32_Sequence - (u32_Position + 1U));
+
+      if (s32_Difference == 0)
+      {
+         //cell is filled: try to claim it; on failure u32_Position is updated and we retry
+         if (mc_ReadIndex.compare_exchange_weak(u32_Position, u32_Position + 1U, std::memory_order_relaxed) == true)
+         {
+            orc_Entry = std::move(rc_Cell.c_Entry);
+            rc_Cell.c_Entry.clear();
+            //release the cell for the producer one round later:
+            rc_Cell.c_Sequence.store(u32_Position + mu32_IndexMask + 1U, std::memory_order_release);
+            q_Return = true;
+            q_Done = true;
+         }
+      }
+      else if (s32_Difference < 0)
+      {
+         //cell was not written yet: queue is empty
+         q_Done = true;
+      }
+      else
+      {
+         //another consumer was faster
+         u32_Position = mc_ReadIndex.load(std::memory_order_relaxed);
+      }
+   }
+   return q_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Set write to file active flag
 
@@ -53,10 +193,7 @@ std::ofstream C_OscLoggingHandler::mhc_File;
 //----------------------------------------------------------------------------------------------------------------------
 void C_OscLoggingHandler::h_SetWriteToFileActive(const bool oq_Active)
 {
-   if (C_OscLoggingHandler::mhc_File.is_open() == true)
-   {
-      C_OscLoggingHandler::mhc_File.close();
-   }
+   mh_CloseFile();
    C_OscLoggingHandler::mhq_WriteToFile = oq_Active;
    mh_OpenFile();
 }
@@ -86,17 +223,31 @@ void C_OscLoggingHandler::h_SetMeasurePerformanceActive(const bool oq_Active)
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Set log file location path and file name
 
+   If the writer thread is running the file is switched without stopping it:
+   entries queued before the switch are written to the old file, all later ones to the new file.
+
    \param[in] orc_CompleteLogFileLocation Log file location path and file name
 */
 //----------------------------------------------------------------------------------------------------------------------
 void C_OscLoggingHandler::h_SetCompleteLogFileLocation(const C_SclString & orc_CompleteLogFileLocation)
 {
-   if (C_OscLoggingHandler::mhc_File.is_open() == true)
+   if (C_OscLoggingHandler::mhc_WriterRunning.load() == true)
    {
+      //Critical section
+      C_OscLoggingHandler::mhc_FileCriticalSection.Acquire();
+      C_OscLoggingHandler::mh_WriteQueuedEntries();
       C_OscLoggingHandler::mhc_File.close();
+      C_OscLoggingHandler::mhc_FileName = orc_CompleteLogFileLocation;
+      (void)C_OscLoggingHandler::mh_OpenFileStream();
+      //Critical section
+      C_OscLoggingHandler::mhc_FileCriticalSection.Release();
+   }
+   else
+   {
+      mh_CloseFile();
+      C_OscLoggingHandler::mhc_FileName = orc_CompleteLogFileLocation;
+      mh_OpenFile();
    }
-   C_OscLoggingHandler::mhc_FileName = orc_CompleteLogFileLocation;
-   mh_OpenFile();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -111,6 +262,36 @@ const C_SclString & C_OscLoggingHandler::h_GetCompleteLogFileLocation(void)
    return C_OscLoggingHandler::mhc_FileName;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set maximum size of log file
+
+   If the log file reaches this size it is renamed to "<log file name>.1" (replacing an older one)
+   and a new log file is started.
+
+   \param[in] ou32_MaxFileSize Maximum file size in bytes (0: no limit)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscLoggingHandler::h_SetMaxFileSize(const uint32_t ou32_MaxFileSize)
+{
+   C_OscLoggingHandler::mhc_FileCriticalSection.Acquire();
+   C_OscLoggingHandler::mhu32_MaxFileSize = ou32_MaxFileSize;
+   C_OscLoggingHandler::mhc_FileCriticalSection.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of log file entries dropped so far
+
+   Entries are dropped if they are logged faster than they can be written to the log file.
+
+   \return
+   Number of dropped entries
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscLoggingHandler::h_GetNumDroppedEntries(void)
+{
+   return C_OscLoggingHandler::mhc_NumDroppedEntries.load();
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Write info message to log
 
@@ -265,6 +446,45 @@ C_SclString C_OscLoggingHandler::h_StwError(const int32_t os32_Error)
    return c_Retval;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Start capturing the log entries of the calling thread
+
+   Until h_StopCapture() is called, entries written by the calling thread are formatted as usual but appended to
+   orc_Entries instead of being written. The caller decides whether and when to write them with
+   h_WriteCapturedEntries() (e.g. to write the output of parallel jobs in job order).
+   Entries of other threads are not affected.
+
+   \param[in,out]  orc_Entries   List to append the entries to; must stay valid until h_StopCapture()
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscLoggingHandler::h_StartCapture(std::vector<std::string> & orc_Entries)
+{
+   C_OscLoggingHandler::mhpc_CapturedEntries = &orc_Entries;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Stop capturing the log entries of the calling thread (see h_StartCapture())
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscLoggingHandler::h_StopCapture(void)
+{
+   C_OscLoggingHandler::mhpc_CapturedEntries = NULL;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write log entries captured with h_StartCapture()
+
+   \param[in]  orc_Entries   Captured entries
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscLoggingHandler::h_WriteCapturedEntries(const std::vector<std::string> & orc_Entries)
+{
+   for (uint32_t u32_Entry = 0U; u32_Entry < orc_Entries.size(); ++u32_Entry)
+   {
+      C_OscLoggingHandler::mh_OutputEntry(orc_Entries[u32_Entry]);
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Utility to flush current log entries (No manual call necessary)
 */
@@ -281,16 +501,33 @@ void C_OscLoggingHandler::h_Flush(void)
    }
 
    //File
-   if ((C_OscLoggingHandler::mhq_WriteToFile == true) && (C_OscLoggingHandler::mhc_File.is_open() == true))
+   if ((C_OscLoggingHandler::mhq_WriteToFile == true) && (C_OscLoggingHandler::mhc_WriterRunning.load() == true))
    {
       //Critical section
       C_OscLoggingHandler::mhc_FileCriticalSection.Acquire();
+      //do not wait for the writer thread:
+      C_OscLoggingHandler::mh_WriteQueuedEntries();
       C_OscLoggingHandler::mhc_File.flush();
       //Critical section
       C_OscLoggingHandler::mhc_FileCriticalSection.Release();
    }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Stop logging to file
+
+   Stops the background writer thread, writes all queued entries and closes the log file.
+   Must be called before the application exits resp. before a library containing the logging handler is unloaded.
+   The thread is not stopped by a static destructor as waiting for it there can dead-lock
+    (e.g. while the Windows loader lock is held on unloading a DLL).
+   Logging to file can be resumed by calling h_SetWriteToFileActive().
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscLoggingHandler::h_Exit(void)
+{
+   C_OscLoggingHandler::h_SetWriteToFileActive(false);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Get date time as formatted string
 
@@ -385,28 +622,54 @@ void C_OscLoggingHandler::mh_WriteLog(const C_SclString & orc_Type, const C_SclS
    c_LogEntryStream << "  ";
    c_LogEntryStream << &std::left << orc_Message.c_str() << &std::endl;
 
+   if (C_OscLoggingHandler::mhpc_CapturedEntries != NULL)
+   {
+      //output later with h_WriteCapturedEntries()
+      C_OscLoggingHandler::mhpc_CapturedEntries->push_back(c_LogEntryStream.str());
+   }
+   else
+   {
+      C_OscLoggingHandler::mh_OutputEntry(c_LogEntryStream.str());
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write formatted entry to console and/or file (as configured)
+
+   \param[in] orc_Entry  Formatted log entry (including line break)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscLoggingHandler::mh_OutputEntry(const std::string & orc_Entry)
+{
    //Console
    if (C_OscLoggingHandler::mhq_WriteToConsole == true)
    {
       //Critical section
       C_OscLoggingHandler::mhc_ConsoleCriticalSection.Acquire();
-      std::cout << c_LogEntryStream.str();
+      std::cout << orc_Entry;
       //Critical section
       C_OscLoggingHandler::mhc_ConsoleCriticalSection.Release();
    }
 
    //File
-   if ((C_OscLoggingHandler::mhq_WriteToFile == true) && (C_OscLoggingHandler::mhc_File.is_open() == true))
+   if (C_OscLoggingHandler::mhq_WriteToFile == true)
    {
-      const std::string c_Message = c_LogEntryStream.str();
-      //Critical section
-      C_OscLoggingHandler::mhc_FileCriticalSection.Acquire();
-
-      //TGL critical section -> file
-      C_OscLoggingHandler::mhc_File.write(c_Message.c_str(), c_Message.size());
-
-      //Critical section
-      C_OscLoggingHandler::mhc_FileCriticalSection.Release();
+      //register before checking the writer state so mh_CloseFile() can wait for this entry to be queued
+      ++C_OscLoggingHandler::mhc_NumProducers;
+      if (C_OscLoggingHandler::mhc_WriterRunning.load() == true)
+      {
+         //hand over to writer thread; never wait for the file here
+         std::string c_Message = orc_Entry;
+         if (C_OscLoggingHandler::mhc_Queue.Push(c_Message) == true)
+         {
+            C_OscLoggingHandler::mhc_WriterEvent.Signal();
+         }
+         else
+         {
+            ++C_OscLoggingHandler::mhc_NumDroppedEntries;
+         }
+      }
+      --C_OscLoggingHandler::mhc_NumProducers;
    }
 }
 
@@ -418,6 +681,34 @@ void C_OscLoggingHandler::mh_OpenFile(void)
 {
    if (((C_OscLoggingHandler::mhc_FileName != "") && (C_OscLoggingHandler::mhq_WriteToFile == true)) &&
        (C_OscLoggingHandler::mhc_File.is_open() == false))
+   {
+      if (C_OscLoggingHandler::mh_OpenFileStream() == true)
+      {
+         //start writer thread
+         C_OscLoggingHandler::mhc_StopWriter.store(false);
+         if (C_OscLoggingHandler::mhc_WriterThread.Start(&C_OscLoggingHandler::mh_WriterThread, NULL) == true)
+         {
+            C_OscLoggingHandler::mhc_WriterRunning.store(true);
+         }
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Open the file stream for appending (create folder if necessary)
+
+   Caller must hold mhc_FileCriticalSection if the writer thread is running.
+
+   \return
+   true    file open
+   false   could not open file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscLoggingHandler::mh_OpenFileStream(void)
+{
+   bool q_Return = false;
+
+   if (C_OscLoggingHandler::mhc_FileName != "")
    {
       const C_SclString c_FilePath = TglExtractFilePath(C_OscLoggingHandler::mhc_FileName);
       //Folder
@@ -426,6 +717,160 @@ void C_OscLoggingHandler::mh_OpenFile(void)
          TglCreateDirectory(c_FilePath);
       }
       C_OscLoggingHandler::mhc_File.open(C_OscLoggingHandler::mhc_FileName.c_str(), std::ios::app);
+      if (C_OscLoggingHandler::mhc_File.is_open() == true)
+      {
+         (void)C_OscLoggingHandler::mhc_File.seekp(0, std::ios::end);
+         C_OscLoggingHandler::mhu64_FileSize = static_cast<uint64_t>(C_OscLoggingHandler::mhc_File.tellp());
+         q_Return = true;
+      }
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Stop writer thread and close file if open
+
+   Entries still queued are written before closing the file.
+   Producers that saw the writer running before it was stopped are waited for, so their entries are part of the
+    final drain (and neither lost nor written to the next file).
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscLoggingHandler::mh_CloseFile(void)
+{
+   //no new entries from here:
+   C_OscLoggingHandler::mhc_WriterRunning.store(false);
+   while (C_OscLoggingHandler::mhc_NumProducers.load() != 0U)
+   {
+      //a producer is just queuing its entry
+      TglSleep(0U);
+   }
+
+   if (C_OscLoggingHandler::mhc_WriterThread.IsStarted() == true)
+   {
+      C_OscLoggingHandler::mhc_StopWriter.store(true);
+      C_OscLoggingHandler::mhc_WriterEvent.Signal();
+      C_OscLoggingHandler::mhc_WriterThread.WaitForFinished();
+   }
+
+   C_OscLoggingHandler::mhc_FileCriticalSection.Acquire();
+   C_OscLoggingHandler::mh_WriteQueuedEntries();
+   if (C_OscLoggingHandler::mhc_File.is_open() == true)
+   {
+      C_OscLoggingHandler::mhc_File.close();
+   }
+   C_OscLoggingHandler::mhc_FileCriticalSection.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Writer thread function
+
+   Waits for queued entries and writes them to the log file until a stop is requested.
+   The wait is limited so entries are written regularly even if many of them are queued with one signal.
+
+   \param[in] opv_Instance  not used
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscLoggingHandler::mh_WriterThread(void * const opv_Instance)
+{
+   bool q_Stop = false;
+
+   (void)opv_Instance;
+   while (q_Stop == false)
+   {
+      if (C_OscLoggingHandler::mhc_StopWriter.load() == false)
+      {
+         (void)C_OscLoggingHandler::mhc_WriterEvent.Wait(100U);
+      }
+      q_Stop = C_OscLoggingHandler::mhc_StopWriter.load();
+
+      C_OscLoggingHandler::mhc_FileCriticalSection.Acquire();
+      C_OscLoggingHandler::mh_WriteQueuedEntries();
+      C_OscLoggingHandler::mhc_FileCriticalSection.Release();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write all queued entries to the log file
+
+   Also reports entries dropped since the last call.
+   Caller must hold mhc_FileCriticalSection.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscLoggingHandler::mh_WriteQueuedEntries(void)
+{
+   std::string c_Entry;
+   bool q_Written = false;
+   const uint32_t u32_NumDropped = C_OscLoggingHandler::mhc_NumDroppedEntries.load();
+
+   while (C_OscLoggingHandler::mhc_Queue.Pop(c_Entry) == true)
+   {
+      if (C_OscLoggingHandler::mhc_File.is_open() == true)
+      {
+         C_OscLoggingHandler::mhc_File.write(c_Entry.c_str(), c_Entry.size());
+         C_OscLoggingHandler::mhu64_FileSize += c_Entry.size();
+         q_Written = true;
+      }
+   }
+
+   if ((u32_NumDropped != C_OscLoggingHandler::mhu32_NumReportedDroppedEntries) &&
+       (C_OscLoggingHandler::mhc_File.is_open() == true))
+   {
+      C_TglDateTime c_DateTime;
+      std::stringstream c_LogEntryStream;
+
+      TglGetDateTimeNow(c_DateTime);
+      c_LogEntryStream << &std::left << std::setw(25) <<
+         C_OscLoggingHandler::h_UtilConvertDateTimeToString(c_DateTime);
+      c_LogEntryStream << &std::left << std::setw(7) << "WARNING" << "  ";
+      c_LogEntryStream << &std::left << std::setw(26) << "Logging" << "  ";
+      c_LogEntryStream << &std::left << std::setw(52) << "C_OscLoggingHandler::mh_WriteQueuedEntries" << "  ";
+      c_LogEntryStream << (u32_NumDropped - C_OscLoggingHandler::mhu32_NumReportedDroppedEntries) <<
+         " log entries dropped as the log file could not be written fast enough." << &std::endl;
+      c_Entry = c_LogEntryStream.str();
+      C_OscLoggingHandler::mhc_File.write(c_Entry.c_str(), c_Entry.size());
+      C_OscLoggingHandler::mhu64_FileSize += c_Entry.size();
+      C_OscLoggingHandler::mhu32_NumReportedDroppedEntries = u32_NumDropped;
+      q_Written = true;
+   }
+
+   if (q_Written == true)
+   {
+      C_OscLoggingHandler::mhc_File.flush();
+
+      //checked once per batch: if rotating fails it is retried with the next batch
+      if ((C_OscLoggingHandler::mhu32_MaxFileSize != 0U) &&
+          (C_OscLoggingHandler::mhu64_FileSize >= C_OscLoggingHandler::mhu32_MaxFileSize))
+      {
+         C_OscLoggingHandler::mh_RotateFile();
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Continue with a new log file
+
+   Renames the current log file to "<log file name>.1" (replacing an older one) and opens a new, empty one.
+   If the file cannot be renamed (e.g. opened by another application) the current file is reopened and
+    appended to; rotating is retried with the next write.
+   Caller must hold mhc_FileCriticalSection.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscLoggingHandler::mh_RotateFile(void)
+{
+   const C_SclString c_PreviousFileName = C_OscLoggingHandler::mhc_FileName + ".1";
+
+   C_OscLoggingHandler::mhc_File.close();
+   //may fail if there is no older file; a real problem shows up when renaming
+   (void)std::remove(c_PreviousFileName.c_str());
+   if (std::rename(C_OscLoggingHandler::mhc_FileName.c_str(), c_PreviousFileName.c_str()) == 0)
+   {
+      C_OscLoggingHandler::mhc_File.open(C_OscLoggingHandler::mhc_FileName.c_str(), std::ios::trunc);
+      C_OscLoggingHandler::mhu64_FileSize = 0U;
+   }
+   else
+   {
+      //never throw away the current content: keep on appending
+      C_OscLoggingHandler::mhc_File.open(C_OscLoggingHandler::mhc_FileName.c_str(), std::ios::app);
    }
 }
 
@@ -445,8 +890,5 @@ C_OscLoggingHandler::C_OscLoggingHandler(void)
 //----------------------------------------------------------------------------------------------------------------------
 C_OscLoggingHandler::~C_OscLoggingHandler(void)
 {
-   if (C_OscLoggingHandler::mhc_File.is_open() == true)
-   {
-      C_OscLoggingHandler::mhc_File.close();
-   }
+   mh_CloseFile();
 }
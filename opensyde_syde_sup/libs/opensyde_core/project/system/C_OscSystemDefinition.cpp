@@ -496,6 +496,7 @@ const
       if (opq_NameConflict != NULL)
       {
          //check for node name used more than once (independent of character case)
+         const stw::scl::C_SclString c_CheckedName = rc_CheckedNode.c_Properties.c_Name.LowerCase();
          *opq_NameConflict = false;
          for (uint32_t u32_ItNode = 0; u32_ItNode < this->c_Nodes.size(); ++u32_ItNode)
          {
@@ -517,7 +518,7 @@ const
                   const C_OscNode & rc_CurrentNode = this->c_Nodes[u32_ItNode];
                   c_CurName = rc_CurrentNode.c_Properties.c_Name;
                }
-               if (rc_CheckedNode.c_Properties.c_Name.LowerCase() == c_CurName.LowerCase())
+               if (c_CheckedName == c_CurName.LowerCase())
                {
                   *opq_NameConflict = true;
                   break;
@@ -965,13 +966,13 @@ int32_t C_OscSystemDefinition::CheckErrorBus(const uint32_t ou32_BusIndex, bool
       *opq_NameConflict = false;
       if (ou32_BusIndex < this->c_Buses.size())
       {
-         const C_OscSystemBus & rc_CheckedBus = this->c_Buses[ou32_BusIndex];
-         for (uint32_t u32_ItBus = 0; u32_ItBus < this->c_Buses.size(); ++u32_ItBus)
+         const stw::scl::C_SclString c_CheckedName = this->c_Buses[ou32_BusIndex].c_Name.LowerCase();
+         for (uint32_t u32_ItBus = 0; (u32_ItBus < this->c_Buses.size()) && (*opq_NameConflict == false); ++u32_ItBus)
          {
             if (u32_ItBus != ou32_BusIndex)
             {
                const C_OscSystemBus & rc_CurrentBus = this->c_Buses[u32_ItBus];
-               if (rc_CheckedBus.c_Name.LowerCase() == rc_CurrentBus.c_Name.LowerCase())
+               if (c_CheckedName == rc_CurrentBus.c_Name.LowerCase())
                {
                   *opq_NameConflict = true;
                }
@@ -21,6 +21,7 @@
 #include "C_OscSystemDefinitionFiler.hpp"
 #include "TglFile.hpp"
 #include "TglUtils.hpp"
+#include "TglTasks.hpp"
 #include "C_OscNodeSquadFiler.hpp"
 #include "C_OscLoggingHandler.hpp"
 
@@ -127,6 +128,8 @@ int32_t C_OscSystemDefinitionFiler::h_LoadSystemDefinitionFile(C_OscSystemDefini
    \param[in]      orc_SystemDefinition   Pointer to storage
    \param[in]      orc_Path               Path of system definition
    \param[in,out]  opc_CreatedFiles       Optional storage for history of all created files (and without sysdef)
+   \param[in]      opc_NodesToSave        (Optional parameter) only write node files of nodes flagged with 1;
+                                          see h_SaveNodes
 
    \return
    C_NO_ERR   data saved
@@ -136,7 +139,8 @@ int32_t C_OscSystemDefinitionFiler::h_LoadSystemDefinitionFile(C_OscSystemDefini
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_OscSystemDefinitionFiler::h_SaveSystemDefinitionFile(const C_OscSystemDefinition & orc_SystemDefinition,
                                                                const stw::scl::C_SclString & orc_Path,
-                                                               std::vector<C_SclString> * const opc_CreatedFiles)
+                                                               std::vector<C_SclString> * const opc_CreatedFiles,
+                                                               const std::vector<uint8_t> * const opc_NodesToSave)
 {
    int32_t s32_Return = C_NO_ERR;
 
@@ -166,7 +170,8 @@ int32_t C_OscSystemDefinitionFiler::h_SaveSystemDefinitionFile(const C_OscSystem
    if (s32_Return == C_NO_ERR)
    {
       C_OscXmlParser c_XmlParser;
-      s32_Return = h_SaveSystemDefinition(orc_SystemDefinition, c_XmlParser, orc_Path, opc_CreatedFiles);
+      s32_Return = h_SaveSystemDefinition(orc_SystemDefinition, c_XmlParser, orc_Path, opc_CreatedFiles,
+                                          opc_NodesToSave);
       if (s32_Return == C_NO_ERR)
       {
          s32_Return = c_XmlParser.SaveToFile(orc_Path);
@@ -244,6 +249,9 @@ int32_t C_OscSystemDefinitionFiler::h_LoadNodes(std::vector<C_OscNode> & orc_Nod
    if (c_SelectedNode == "node")
    {
       uint8_t u8_NodeIndex = 0U;
+      C_NodeFileLoadJobs c_Jobs;
+      c_Jobs.pc_Nodes = &orc_Nodes;
+      c_Jobs.q_SkipContent = oq_SkipContent;
       do
       {
          C_OscNode c_Item;
@@ -285,7 +293,9 @@ int32_t C_OscSystemDefinitionFiler::h_LoadNodes(std::vector<C_OscNode> & orc_Nod
                }
                if (q_SkipNode == false)
                {
-                  s32_Retval = C_OscNodeFiler::h_LoadNodeFile(c_Item, c_FileName, oq_SkipContent);
+                  //node files are independent: load them in parallel after all file names are known
+                  c_Jobs.c_NodeIndices.push_back(u8_NodeIndex);
+                  c_Jobs.c_FilePaths.push_back(c_FileName);
                }
             }
             else
@@ -314,6 +324,20 @@ int32_t C_OscSystemDefinitionFiler::h_LoadNodes(std::vector<C_OscNode> & orc_Nod
          c_SelectedNode = orc_XmlParser.SelectNodeNext("node");
       }
       while (c_SelectedNode == "node");
+      if ((s32_Retval == C_NO_ERR) && (c_Jobs.c_FilePaths.size() > 0UL))
+      {
+         C_OscSystemDefinitionFiler::mh_LoadNodeFiles(c_Jobs);
+         //evaluate in node order; same result as loading one after another: stop at first failed node
+         for (uint32_t u32_ItJob = 0UL; u32_ItJob < c_Jobs.c_Results.size(); ++u32_ItJob)
+         {
+            if (c_Jobs.c_Results[u32_ItJob] != C_NO_ERR)
+            {
+               s32_Retval = c_Jobs.c_Results[u32_ItJob];
+               orc_Nodes.resize(c_Jobs.c_NodeIndices[u32_ItJob]);
+               break;
+            }
+         }
+      }
       if (s32_Retval == C_NO_ERR)
       {
          //Return (no check to allow reuse)
@@ -444,6 +468,11 @@ int32_t C_OscSystemDefinitionFiler::h_LoadBuses(std::vector<C_OscSystemBus> & or
    \param[in,out]  orc_XmlParser       XML with "nodes" active
    \param[in]      orc_BasePath        Base path
    \param[in,out]  opc_CreatedFiles    Optional storage for history of all created files
+   \param[in]      opc_NodesToSave     (Optional parameter) only write node files of nodes flagged with 1;
+                                       the existing files of all other nodes are kept and only referenced.
+                                       Ignored if no base path is used or opc_CreatedFiles is used
+                                       (the created files are only known after writing).
+                                       Files which do not exist yet are always written.
 
    \return
    C_NO_ERR   no error
@@ -453,7 +482,8 @@ int32_t C_OscSystemDefinitionFiler::h_LoadBuses(std::vector<C_OscSystemBus> & or
 int32_t C_OscSystemDefinitionFiler::h_SaveNodes(const std::vector<C_OscNode> & orc_Nodes,
                                                 C_OscXmlParserBase & orc_XmlParser,
                                                 const stw::scl::C_SclString & orc_BasePath,
-                                                std::vector<C_SclString> * const opc_CreatedFiles)
+                                                std::vector<C_SclString> * const opc_CreatedFiles,
+                                                const std::vector<uint8_t> * const opc_NodesToSave)
 {
    int32_t s32_Retval = C_NO_ERR;
    const std::map<uint32_t,
@@ -477,16 +507,22 @@ int32_t C_OscSystemDefinitionFiler::h_SaveNodes(const std::vector<C_OscNode> & o
          const C_SclString c_FileName = c_FolderName + "/" + C_OscNodeFiler::h_GetFileName();
          const C_SclString c_CombinedFolderName = C_OscSystemFilerUtil::h_CombinePaths(orc_BasePath, c_FolderName);
          const C_SclString c_CombinedFileName = C_OscSystemFilerUtil::h_CombinePaths(orc_BasePath, c_FileName);
-         //Create folder
-         if (TglCreateDirectory(c_CombinedFolderName) != 0)
+         const bool q_KeepExistingFile =
+            ((((opc_NodesToSave != NULL) && (opc_CreatedFiles == NULL)) && (u32_Index < opc_NodesToSave->size())) &&
+             ((*opc_NodesToSave)[u32_Index] == 0U)) && (TglFileExists(c_CombinedFileName) == true);
+         if (q_KeepExistingFile == false)
          {
-            osc_write_log_error("Saving node definition",
-                                "Could not create directory \"" + c_CombinedFolderName + "\"");
+            //Create folder
+            if (TglCreateDirectory(c_CombinedFolderName) != 0)
+            {
+               osc_write_log_error("Saving node definition",
+                                   "Could not create directory \"" + c_CombinedFolderName + "\"");
+            }
+            //Save node file
+            s32_Retval = C_OscNodeFiler::h_SaveNodeFile(rc_Node, c_CombinedFileName,
+                                                        (opc_CreatedFiles != NULL) ? &c_CreatedFiles : NULL,
+                                                        c_NodeIndicesToNameMap);
          }
-         //Save node file
-         s32_Retval = C_OscNodeFiler::h_SaveNodeFile(rc_Node, c_CombinedFileName,
-                                                     (opc_CreatedFiles != NULL) ? &c_CreatedFiles : NULL,
-                                                     c_NodeIndicesToNameMap);
          //Store if necessary
          if (opc_CreatedFiles != NULL)
          {
@@ -716,6 +752,8 @@ int32_t C_OscSystemDefinitionFiler::h_LoadSystemDefinition(C_OscSystemDefinition
    \param[in,out]  orc_XmlParser          XML with default state
    \param[in]      orc_BasePath           Base path
    \param[in,out]  opc_CreatedFiles       Optional storage for history of all created files
+   \param[in]      opc_NodesToSave        (Optional parameter) only write node files of nodes flagged with 1;
+                                          see h_SaveNodes
 
    \return
    C_NO_ERR   no error
@@ -725,7 +763,8 @@ int32_t C_OscSystemDefinitionFiler::h_LoadSystemDefinition(C_OscSystemDefinition
 int32_t C_OscSystemDefinitionFiler::h_SaveSystemDefinition(const C_OscSystemDefinition & orc_SystemDefinition,
                                                            C_OscXmlParserBase & orc_XmlParser,
                                                            const stw::scl::C_SclString & orc_BasePath,
-                                                           std::vector<C_SclString> * const opc_CreatedFiles)
+                                                           std::vector<C_SclString> * const opc_CreatedFiles,
+                                                           const std::vector<uint8_t> * const opc_NodesToSave)
 {
    int32_t s32_Return;
 
@@ -739,7 +778,8 @@ int32_t C_OscSystemDefinitionFiler::h_SaveSystemDefinition(const C_OscSystemDefi
    C_OscNodeSquadFiler::h_SaveNodeGroups(orc_SystemDefinition.c_NodeSquads, orc_XmlParser);
    //Node
    tgl_assert(orc_XmlParser.CreateAndSelectNodeChild("nodes") == "nodes");
-   s32_Return = h_SaveNodes(orc_SystemDefinition.c_Nodes, orc_XmlParser, orc_BasePath, opc_CreatedFiles);
+   s32_Return = h_SaveNodes(orc_SystemDefinition.c_Nodes, orc_XmlParser, orc_BasePath, opc_CreatedFiles,
+                            opc_NodesToSave);
    if (s32_Return == C_NO_ERR)
    {
       //Return
@@ -801,3 +841,66 @@ std::map<uint32_t, C_SclString> C_OscSystemDefinitionFiler::mh_MapNodeIndicesToN
    }
    return c_Retval;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load node files in parallel
+
+   Loads all node files of the jobs in parallel (see TglParallelFor()).
+   Each job loads into its own node so no synchronization of the loaded data is necessary.
+   Jobs after a failed job are not processed anymore.
+   The log output of the jobs is captured and written in job order up to the first failed job afterwards. So the
+   log is the same as when loading the nodes one after the other (jobs after the failed one might already have
+   run; their output is dropped).
+
+   \param[in,out]  orc_Jobs   Jobs to process; results are stored in c_Results
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscSystemDefinitionFiler::mh_LoadNodeFiles(C_NodeFileLoadJobs & orc_Jobs)
+{
+   const uint32_t u32_NumJobs = static_cast<uint32_t>(orc_Jobs.c_FilePaths.size());
+
+   orc_Jobs.c_Results.assign(u32_NumJobs, C_NOACT);
+   orc_Jobs.c_FirstFailedJob.store(u32_NumJobs);
+   orc_Jobs.c_LogEntries.assign(u32_NumJobs, std::vector<std::string>());
+   TglParallelFor(u32_NumJobs, &C_OscSystemDefinitionFiler::mh_LoadNodeFileJob, &orc_Jobs);
+
+   for (uint32_t u32_Job = 0U; (u32_Job < u32_NumJobs) && (u32_Job <= orc_Jobs.c_FirstFailedJob.load()); ++u32_Job)
+   {
+      C_OscLoggingHandler::h_WriteCapturedEntries(orc_Jobs.c_LogEntries[u32_Job]);
+   }
+   orc_Jobs.c_LogEntries.clear();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load node file of one job
+
+   \param[in,out]  opv_Jobs   Jobs to process (C_NodeFileLoadJobs)
+   \param[in]      ou32_Job   Index of job to process
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscSystemDefinitionFiler::mh_LoadNodeFileJob(void * const opv_Jobs, const uint32_t ou32_Job)
+{
+   C_NodeFileLoadJobs * const pc_Jobs = reinterpret_cast<C_NodeFileLoadJobs *>(opv_Jobs);
+
+   //loading stops at the first failed node; later nodes are not needed
+   if (ou32_Job < pc_Jobs->c_FirstFailedJob.load())
+   {
+      int32_t s32_Result;
+
+      //log output is written by mh_LoadNodeFiles() in job order
+      C_OscLoggingHandler::h_StartCapture(pc_Jobs->c_LogEntries[ou32_Job]);
+      s32_Result = C_OscNodeFiler::h_LoadNodeFile((*pc_Jobs->pc_Nodes)[pc_Jobs->c_NodeIndices[ou32_Job]],
+                                                  pc_Jobs->c_FilePaths[ou32_Job], pc_Jobs->q_SkipContent);
+      C_OscLoggingHandler::h_StopCapture();
+      pc_Jobs->c_Results[ou32_Job] = s32_Result;
+      if (s32_Result != C_NO_ERR)
+      {
+         uint32_t u32_FirstFailedJob = pc_Jobs->c_FirstFailedJob.load();
+         while ((ou32_Job < u32_FirstFailedJob) &&
+                (pc_Jobs->c_FirstFailedJob.compare_exchange_weak(u32_FirstFailedJob, ou32_Job) == false))
+         {
+            //retry with updated value
+         }
+      }
+   }
+}
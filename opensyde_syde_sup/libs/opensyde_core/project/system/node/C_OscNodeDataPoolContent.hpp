@@ -13,12 +13,11 @@
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 
+#include <memory>
 #include <vector>
 #include <string>
 #include "stwtypes.hpp"
 
-#include "TglTasks.hpp"
-
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw
 {
@@ -28,14 +27,41 @@ namespace opensyde_core
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
+///Byte storage for C_OscNodeDataPoolContent
+//Up to mhu32_INLINE_SIZE bytes (all scalar types) are held inline without heap allocation.
+//Larger data (arrays) is held in a buffer that is shared between copies and only copied on the first write access.
+//The sharing itself is not synchronized: an instance must not be copied while another thread writes to it.
+//The interface follows std::vector so the storage can be used the same way.
+class C_OscNodeDataPoolContentBuffer
+{
+public:
+   C_OscNodeDataPoolContentBuffer(void);
+   C_OscNodeDataPoolContentBuffer(const C_OscNodeDataPoolContentBuffer & orc_Source);
+   C_OscNodeDataPoolContentBuffer & operator = (const C_OscNodeDataPoolContentBuffer & orc_Source);
+
+   //lint -save -e8001 -e8011 //naming compatible to std::vector
+   uint32_t size(void) const;
+   void resize(const uint32_t ou32_Size, const uint8_t ou8_Value = 0U);
+   //lint -restore
+   const uint8_t & operator [](const uint32_t ou32_Index) const;
+   uint8_t & operator [](const uint32_t ou32_Index);
+
+private:
+   static const uint32_t mhu32_INLINE_SIZE = 8U;
+
+   uint32_t mu32_Size;
+   uint8_t mau8_Inline[mhu32_INLINE_SIZE];            ///< used if mu32_Size <= mhu32_INLINE_SIZE
+   std::shared_ptr<std::vector<uint8_t> > mc_Shared; ///< used if mu32_Size > mhu32_INLINE_SIZE
+
+   uint8_t * m_GetWritableData(void);
+};
+
 ///Data class for any supported data pool data type
 class C_OscNodeDataPoolContent
 {
 public:
    C_OscNodeDataPoolContent(void);
    C_OscNodeDataPoolContent(const C_OscNodeDataPoolContent & orc_Source);
-   //lint -esym(1539,stw::opensyde_core::C_OscNodeDataPoolContent::mc_CriticalSection)
-   //The lock of the copy is intended to remain unchanged.
    C_OscNodeDataPoolContent & operator = (const C_OscNodeDataPoolContent & orc_Source);
    virtual ~C_OscNodeDataPoolContent(void);
 
@@ -164,7 +190,7 @@ public:
 private:
    E_Type me_Type;               ///< Currently active type
    bool mq_Array;                ///< Flag for array (true) or single element type (false)
-   std::vector<uint8_t> mc_Data; ///< Contained value
+   C_OscNodeDataPoolContentBuffer mc_Data; ///< Contained value
 
    template <typename T> void m_SetValue(const T & orc_Value, const E_Type oe_Type);
    template <typename T> void m_GetValue(const E_Type oe_Type, T & orc_Value) const;
@@ -190,10 +216,6 @@ private:
    bool m_CompareArrayEqual(const C_OscNodeDataPoolContent & orc_Cmp, const uint32_t ou32_Index) const;
    bool m_CompareArrayNotEqual(const C_OscNodeDataPoolContent & orc_Cmp, const uint32_t ou32_Index) const;
 
-   // It is mutable because of the constness of the getter functions. Without the keyword mutable the getter functions
-   // must be non const and that is not wanted.
-   mutable stw::tgl::C_TglCriticalSection mc_CriticalSection;
-
    void m_GetBaseType(bool & orq_IsUintBase, bool & orq_IsSintBase, bool & orq_IsFloatBase, uint64_t & oru64_UintValue,
                       int64_t & ors64_SintValue, float64_t & orf64_FloatValue) const;
    void m_GetBaseTypeArray(const uint32_t & oru32_Index, bool & orq_IsUintBase, bool & orq_IsSintBase,
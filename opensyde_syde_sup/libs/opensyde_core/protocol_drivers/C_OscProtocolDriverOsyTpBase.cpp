@@ -295,6 +295,72 @@ int32_t C_OscProtocolDriverOsyTpBase::m_GetFromRxQueue(C_OscProtocolDriverOsySer
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check whether Tx queue is empty
+
+   \return
+   true    no service waiting to be sent
+   false   service(s) waiting to be sent
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscProtocolDriverOsyTpBase::m_IsTxQueueEmpty(void)
+{
+   bool q_Empty;
+
+   mc_CsTxQueue.Acquire();
+   q_Empty = mc_TxQueue.empty();
+   mc_CsTxQueue.Release();
+   return q_Empty;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check whether Rx queue is empty
+
+   \return
+   true    no received service waiting to be read
+   false   received service(s) waiting to be read
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscProtocolDriverOsyTpBase::m_IsRxQueueEmpty(void)
+{
+   bool q_Empty;
+
+   mc_CsRxQueue.Acquire();
+   q_Empty = mc_RxQueue.empty();
+   mc_CsRxQueue.Release();
+   return q_Empty;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wait for incoming communication
+
+   Put the calling thread to sleep until there is something for Cycle() to do or the timeout expired.
+   Used by the protocol driver instead of rescinding the CPU time between two Cycle() calls.
+
+   Default implementation: report whether there already are services waiting in the queues.
+   Transport protocols can override this function to block on the underlying communication driver.
+
+   \param[in]  ou32_TimeoutMs   maximum time to wait in milliseconds
+
+   \return
+   C_NO_ERR   there is something to handle by Cycle()
+   C_TIMEOUT  nothing happened within timeout
+   C_NOACT    waiting not supported (the caller needs to use a different mechanism to rescind CPU time)
+   C_CONFIG   no dispatcher installed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscProtocolDriverOsyTpBase::WaitForIncoming(const uint32_t ou32_TimeoutMs)
+{
+   int32_t s32_Return = C_NOACT;
+
+   (void)ou32_TimeoutMs;
+   if ((m_IsRxQueueEmpty() == false) || (m_IsTxQueueEmpty() == false))
+   {
+      s32_Return = C_NO_ERR;
+   }
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Clear Rx and Tx service queues
 
@@ -51,7 +51,13 @@ C_OscProtocolDriverOsyTpCan::C_ServiceState::C_ServiceState(void) :
    u8_SequenceNumber(0U),
    e_Status(eIDLE),
    u32_StartTimeMs(0U),
-   u32_SendCfTimeout(0U)
+   u32_SendCfTimeout(0U),
+   u8_BlockSize(0U),
+   u8_BlockCounter(0U),
+   u32_SeparationTimeUs(0U),
+   u64_NextCfTimeUs(0U),
+   u8_DataLength(mhu8_CAN_DL_CLASSIC),
+   q_CanFd(false)
 {
 }
 
@@ -66,7 +72,10 @@ C_OscProtocolDriverOsyTpCan::C_ServiceState::C_ServiceState(void) :
 C_OscProtocolDriverOsyTpCan::C_OscProtocolDriverOsyTpCan(const uint16_t ou16_MaxServiceQueueSize) :
    C_OscProtocolDriverOsyTpBase(ou16_MaxServiceQueueSize),
    mpc_CanDispatcher(NULL),
-   mu16_DispatcherClientHandle(0U)
+   mu16_DispatcherClientHandle(0U),
+   mu8_RxBlockSize(0U),
+   mu8_RxSeparationTime(0U),
+   mu8_TxDataLength(mhu8_CAN_DL_CLASSIC)
 {
 }
 
@@ -98,6 +107,8 @@ C_OscProtocolDriverOsyTpCan::~C_OscProtocolDriverOsyTpCan(void)
 
    Invalid frames will be ignored.
 
+   CAN FD single frames with more than 8 bytes are supported (SF_DL in second byte as defined by ISO 15765-2).
+
    \param[in]  orc_CanMessage   incoming CAN message
 
    \return
@@ -110,15 +121,23 @@ int32_t C_OscProtocolDriverOsyTpCan::m_HandleIncomingSingleFrame(const T_STWCAN_
 {
    C_OscProtocolDriverOsyService c_Service;
    int32_t s32_Return = C_NO_ERR;
-   const uint8_t u8_Size = orc_CanMessage.au8_Data[0] & 0x0FU;
+   uint8_t u8_Size = orc_CanMessage.au8_Data[0] & 0x0FU;
+   uint8_t u8_DataIndex = 1U;
+
+   if ((orc_CanMessage.u8_DLC > mhu8_CAN_DL_CLASSIC) && (u8_Size == 0U))
+   {
+      //CAN FD single frame escape sequence: length in second byte
+      u8_Size = orc_CanMessage.au8_Data[1];
+      u8_DataIndex = 2U;
+   }
 
    c_Service.c_Data.resize(u8_Size);
-   if (orc_CanMessage.u8_DLC >= (c_Service.c_Data.size() + 1))
+   if (orc_CanMessage.u8_DLC >= (c_Service.c_Data.size() + u8_DataIndex))
    {
       //extract data:
       if (c_Service.c_Data.size() > 0)
       {
-         (void)std::memcpy(&c_Service.c_Data[0], &orc_CanMessage.au8_Data[1], c_Service.c_Data.size());
+         (void)std::memcpy(&c_Service.c_Data[0], &orc_CanMessage.au8_Data[u8_DataIndex], c_Service.c_Data.size());
       }
       //add to queue:
       s32_Return = m_AddToRxQueue(c_Service);
@@ -205,11 +224,14 @@ int32_t C_OscProtocolDriverOsyTpCan::m_HandleIncomingOsySpecificSingleFrame(cons
    * the CAN message is addressed to us
    * the type of frame
 
+   The length of the first frame defines the CAN frame data length (RX_DL) of the transfer:
+   8 for classic CAN; up to 64 for CAN FD.
+
    \param[in]  orc_CanMessage   incoming CAN message
 
    \return
    C_NO_ERR     no problems
-   C_CONFIG     frame invalid (DLC is not 8)
+   C_CONFIG     frame invalid (DLC is not 8 resp. CAN FD length; or total size fits into a single frame)
    C_COM        could not send out flow control
 */
 //----------------------------------------------------------------------------------------------------------------------
@@ -223,34 +245,30 @@ int32_t C_OscProtocolDriverOsyTpCan::m_HandleIncomingFirstFrame(const T_STWCAN_M
       mc_RxService.e_Status = C_ServiceState::eIDLE;
    }
 
-   if (orc_CanMessage.u8_DLC == 8U)
+   //get total size:
+   const uint8_t u8_Size = orc_CanMessage.au8_Data[0] & 0x0FU;
+   const uint16_t u16_ServiceSize = static_cast<uint16_t>(static_cast<uint16_t>(u8_Size) << 8U) +
+                                    orc_CanMessage.au8_Data[1];
+   //number of service bytes in first frame:
+   const uint8_t u8_NumBytes = static_cast<uint8_t>(orc_CanMessage.u8_DLC - 2U);
+
+   if (((orc_CanMessage.u8_DLC == mhu8_CAN_DL_CLASSIC) ||
+        ((orc_CanMessage.u8_FDF != 0U) && (orc_CanMessage.u8_DLC > mhu8_CAN_DL_CLASSIC))) &&
+       (u16_ServiceSize > u8_NumBytes))
    {
-      T_STWCAN_Msg_TX c_TxMsg;
-      //get total size:
-      const uint8_t u8_Size = orc_CanMessage.au8_Data[0] & 0x0FU;
-      const uint16_t u16_ServiceSize = static_cast<uint16_t>(static_cast<uint16_t>(u8_Size) << 8U) +
-                                       orc_CanMessage.au8_Data[1];
       mc_RxService.c_ServiceData.c_Data.resize(u16_ServiceSize);
-      (void)std::memcpy(&mc_RxService.c_ServiceData.c_Data[0], &orc_CanMessage.au8_Data[2], 6U);
-      mc_RxService.u16_TransmissionIndex = 6U;
+      (void)std::memcpy(&mc_RxService.c_ServiceData.c_Data[0], &orc_CanMessage.au8_Data[2], u8_NumBytes);
+      mc_RxService.u16_TransmissionIndex = u8_NumBytes;
       mc_RxService.u8_SequenceNumber = 1U;
-
-      //send flow control:
-      c_TxMsg.u32_ID = m_GetTxIdentifier();
-      c_TxMsg.u8_XTD = 1U;
-      c_TxMsg.u8_RTR = 0U;
-      c_TxMsg.u8_DLC = 3U;
-      c_TxMsg.au8_Data[0] = mhu8_ISO15765_N_PCI_FC;
-      c_TxMsg.au8_Data[1] = 0U; //no block limits (BS)
-      c_TxMsg.au8_Data[2] = 0U; //no separation time (STmin)
-
-      s32_Return = mpc_CanDispatcher->CAN_Send_Msg(c_TxMsg); //lint !e613  //caller is responsible for valid dispatcher
-      if (s32_Return != C_NO_ERR)
-      {
-         m_LogWarningWithHeader("Could not send flow control CAN message.", TGL_UTIL_FUNC_ID);
-         s32_Return = C_COM;
-      }
-      else
+      //all CFs but the last one must have the length of the first frame
+      mc_RxService.u8_DataLength = orc_CanMessage.u8_DLC;
+      mc_RxService.q_CanFd = (orc_CanMessage.u8_FDF != 0U);
+      //remember block size for whole transfer so it is not affected by reconfiguration
+      mc_RxService.u8_BlockSize = mu8_RxBlockSize;
+      mc_RxService.u8_BlockCounter = 0U;
+
+      s32_Return = m_SendFlowControl();
+      if (s32_Return == C_NO_ERR)
       {
          mc_RxService.e_Status = C_ServiceState::eWAITING_FOR_CONSECUTIVE_FRAME;
       }
@@ -264,17 +282,89 @@ int32_t C_OscProtocolDriverOsyTpCan::m_HandleIncomingFirstFrame(const T_STWCAN_M
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Send flow control for ongoing Rx transfer
+
+   Send "continue to send" flow control with the BS of the ongoing Rx transfer and the configured STmin.
+
+   \return
+   C_NO_ERR     no problems
+   C_COM        could not send out flow control
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscProtocolDriverOsyTpCan::m_SendFlowControl(void) const
+{
+   int32_t s32_Return;
+   T_STWCAN_Msg_TX c_TxMsg;
+
+   c_TxMsg.u32_ID = m_GetTxIdentifier();
+   c_TxMsg.u8_XTD = 1U;
+   c_TxMsg.u8_RTR = 0U;
+   c_TxMsg.u8_FDF = (mc_RxService.q_CanFd == true) ? 1U : 0U; //same frame format as the first frame
+   c_TxMsg.u8_DLC = 3U;
+   c_TxMsg.au8_Data[0] = mhu8_ISO15765_N_PCI_FC + mhu8_ISO15765_FS_CTS;
+   c_TxMsg.au8_Data[1] = mc_RxService.u8_BlockSize; //block limit (BS)
+   c_TxMsg.au8_Data[2] = mu8_RxSeparationTime;      //separation time (STmin)
+
+   s32_Return = mpc_CanDispatcher->CAN_Send_Msg(c_TxMsg); //lint !e613  //caller is responsible for valid dispatcher
+   if (s32_Return != C_NO_ERR)
+   {
+      m_LogWarningWithHeader("Could not send flow control CAN message.", TGL_UTIL_FUNC_ID);
+      s32_Return = C_COM;
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get separation time from STmin parameter
+
+   Decode STmin as defined by ISO 15765-2:
+   * 0x00..0x7F: 0..127 ms
+   * 0xF1..0xF9: 100..900 us
+   * reserved values: shall be interpreted as the longest STmin (127 ms)
+
+   \param[in]  ou8_SeparationTime   STmin in ISO 15765-2 encoding
+
+   \return
+   separation time in us
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscProtocolDriverOsyTpCan::mh_GetSeparationTimeUs(const uint8_t ou8_SeparationTime)
+{
+   uint32_t u32_TimeUs;
+
+   if (ou8_SeparationTime <= 0x7FU)
+   {
+      u32_TimeUs = static_cast<uint32_t>(ou8_SeparationTime) * 1000U;
+   }
+   else if ((ou8_SeparationTime >= 0xF1U) && (ou8_SeparationTime <= 0xF9U))
+   {
+      u32_TimeUs = static_cast<uint32_t>(ou8_SeparationTime - 0xF0U) * 100U;
+   }
+   else
+   {
+      u32_TimeUs = 0x7FU * 1000U;
+   }
+   return u32_TimeUs;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Send next consecutive frames
 
-   Try to send as many CFs as left in the Tx state machine.
-   Advance the Tx state machine accordingly
-   If the dispatcher reports a problem leave the state machine as it is.
+   Try to send as many CFs as allowed by the flow control parameters of the server:
+   * CFs are not sent before the separation time (STmin) since the previous CF has expired
+   * after a full block (BS) the state machine waits for the next flow control
+
+   Advance the Tx state machine accordingly.
+   If the dispatcher reports a problem (most likely Tx buffer full) the CF is retried after
+    mhu32_CF_TX_RETRY_TIME_US (overall timeout is checked by Cycle()).
 
    Only to be called when the state machine is in state eMORE_CONSECUTIVE_FRAMES_TO_SEND
 
    \return
-   C_NO_ERR     no problems: all pending CFs sent; Tx state machine set to eIDLE again
+   C_NO_ERR     no problems: all pending CFs of transfer resp. block sent;
+                Tx state machine set to eIDLE resp. eWAITING_FOR_FLOW_CONTROL
+   C_BUSY       separation time not yet expired; Tx state machine still at eMORE_CONSECUTIVE_FRAMES_TO_SEND
    C_COM        could not send out consecutive frame (one/some might have been sent, however)
                 Tx state machine still at eMORE_CONSECUTIVE_FRAMES_TO_SEND
 */
@@ -284,15 +374,26 @@ int32_t C_OscProtocolDriverOsyTpCan::m_SendNextConsecutiveFrames(void)
    int32_t s32_Return = C_NO_ERR;
 
    //continue where we left:
-   for (; mc_TxService.u16_TransmissionIndex < mc_TxService.c_ServiceData.c_Data.size();
-        mc_TxService.u16_TransmissionIndex += 7)
+   while ((mc_TxService.e_Status == C_ServiceState::eMORE_CONSECUTIVE_FRAMES_TO_SEND) &&
+          (mc_TxService.u16_TransmissionIndex < mc_TxService.c_ServiceData.c_Data.size()))
    {
       T_STWCAN_Msg_TX c_TxMsg;
+      const uint64_t u64_Now = TglGetTickCountUs();
+      const uint8_t u8_MaxBytesPerFrame = mc_TxService.u8_DataLength - 1U;
       const uint8_t u8_NumBytesToSend = static_cast<uint8_t>
                                         (((mc_TxService.c_ServiceData.c_Data.size() -
-                                           mc_TxService.u16_TransmissionIndex) > 7U) ? 7U :
+                                           mc_TxService.u16_TransmissionIndex) > u8_MaxBytesPerFrame) ?
+                                         u8_MaxBytesPerFrame :
                                          (mc_TxService.c_ServiceData.c_Data.size() -
                                           mc_TxService.u16_TransmissionIndex));
+
+      if (u64_Now < mc_TxService.u64_NextCfTimeUs)
+      {
+         //separation time not expired yet; Cycle() will continue
+         s32_Return = C_BUSY;
+         break;
+      }
+
       c_TxMsg.u32_ID = m_GetTxIdentifier();
       c_TxMsg.u8_XTD = 1U;
       c_TxMsg.u8_RTR = 0U;
@@ -302,27 +403,49 @@ int32_t C_OscProtocolDriverOsyTpCan::m_SendNextConsecutiveFrames(void)
       (void)std::memcpy(&c_TxMsg.au8_Data[1],
                         &mc_TxService.c_ServiceData.c_Data[mc_TxService.u16_TransmissionIndex],
                         u8_NumBytesToSend);
+      if (mc_TxService.q_CanFd == true)
+      {
+         c_TxMsg.u8_FDF = 1U;
+         mh_PadCanFdFrame(c_TxMsg);
+      }
 
       //send message:
       //lint -e{613}  //caller is responsible for valid dispatcher
       s32_Return = mpc_CanDispatcher->CAN_Send_Msg(c_TxMsg);
       if (s32_Return != C_NO_ERR)
       {
-         //most likely Tx buffer is full; but we cannot be 100% sure, so write a log entry
-         m_LogWarningWithHeader("Could not send consecutive frame CAN message (Tx buffer full ?).", TGL_UTIL_FUNC_ID);
-         s32_Return = C_COM; //probably the Tx queue is full, we'll retry later
+         //most likely Tx buffer is full; retry a little later instead of hammering the driver
+         //if the problem persists Cycle() will abort the transfer after the CF timeout
+         mc_TxService.u64_NextCfTimeUs = u64_Now + mhu32_CF_TX_RETRY_TIME_US;
+         s32_Return = C_COM;
          break;
       }
 
+      mc_TxService.u16_TransmissionIndex += u8_NumBytesToSend;
+      mc_TxService.u64_NextCfTimeUs = u64_Now + mc_TxService.u32_SeparationTimeUs;
+
       //set sequence number for next block:
       mc_TxService.u8_SequenceNumber++;
       if (mc_TxService.u8_SequenceNumber == 16U)
       {
          mc_TxService.u8_SequenceNumber = 0U;
       }
+
+      //end of block ?
+      if (mc_TxService.u8_BlockSize != 0U)
+      {
+         mc_TxService.u8_BlockCounter++;
+         if ((mc_TxService.u8_BlockCounter >= mc_TxService.u8_BlockSize) &&
+             (mc_TxService.u16_TransmissionIndex < mc_TxService.c_ServiceData.c_Data.size()))
+         {
+            //wait for next flow control; N_Bs timeout starts now
+            mc_TxService.e_Status = C_ServiceState::eWAITING_FOR_FLOW_CONTROL;
+            mc_TxService.u32_StartTimeMs = TglGetTickCount();
+         }
+      }
    }
    //finished with this transfer ?
-   if (s32_Return == C_NO_ERR)
+   if (mc_TxService.u16_TransmissionIndex >= mc_TxService.c_ServiceData.c_Data.size())
    {
       mc_TxService.e_Status = C_ServiceState::eIDLE;
    }
@@ -333,6 +456,11 @@ int32_t C_OscProtocolDriverOsyTpCan::m_SendNextConsecutiveFrames(void)
 /*! \brief   Handle incoming flow control
 
    Continue sending ongoing Tx transfer consecutive frames when waiting for flow control.
+   Handles the flow status as defined by ISO 15765-2:
+   * ContinueToSend: take over BS and STmin and send next block of consecutive frames
+   * Wait: restart N_Bs timeout
+   * Overflow: abort Tx transfer
+
    Invalid and unexpected frames will be ignored.
 
    We already know
@@ -345,8 +473,9 @@ int32_t C_OscProtocolDriverOsyTpCan::m_SendNextConsecutiveFrames(void)
    \return
    C_NO_ERR     no problems
    C_NOACT      unexpected flow control
-   C_CONFIG     frame invalid (DLC is not 3)
-   C_OVERFLOW   invalid STmin or BS (only 0 supported for each)
+   C_CONFIG     frame invalid (DLC is less than 3)
+   C_RANGE      invalid flow status
+   C_OVERFLOW   server reported overflow; Tx transfer aborted
    C_COM        could not send out following consecutive frames
 */
 //----------------------------------------------------------------------------------------------------------------------
@@ -357,33 +486,66 @@ int32_t C_OscProtocolDriverOsyTpCan::m_HandleIncomingFlowControl(const T_STWCAN_
    //are we in a segmented Tx transfer ?
    if (mc_TxService.e_Status == C_ServiceState::eWAITING_FOR_FLOW_CONTROL)
    {
-      //only accept STmin=0 and BS=0
-      if (orc_CanMessage.u8_DLC == 3U)
+      //frames might be padded
+      if (orc_CanMessage.u8_DLC >= 3U)
       {
-         if ((orc_CanMessage.au8_Data[1] == 0U) && (orc_CanMessage.au8_Data[2] == 0U))
+         switch (orc_CanMessage.au8_Data[0] & 0x0FU)
          {
-            //set total timeout value for sending all CFs (kicks in if the Tx buffer of the CAN dispatcher is full)
-            //N_As is ISO 15765-2 is per CAN frame (and quite high at 1000ms ...)
-            //For the total transfer we use the total number of CAN frames, assume the lowest supported bitrate
-            // in openSYDE (100 kbit/s) and an alien busload of 50%
-            //So we'll have around 2 ms/message
-            //But we'll add a lower limit of 100ms to compensate for client side timing constraints
-            mc_TxService.u32_SendCfTimeout =
-               static_cast<uint32_t>((mc_TxService.c_ServiceData.c_Data.size() / 7U) * 2U);
-            if (mc_TxService.u32_SendCfTimeout < 100U)
+         case mhu8_ISO15765_FS_CTS:
             {
-               mc_TxService.u32_SendCfTimeout = 100U;
-            }
-            //offset with current system time:
-            mc_TxService.u32_SendCfTimeout += TglGetTickCount();
-            mc_TxService.e_Status = C_ServiceState::eMORE_CONSECUTIVE_FRAMES_TO_SEND;
+               const uint32_t u32_BytesPerFrame = static_cast<uint32_t>(mc_TxService.u8_DataLength) - 1U;
+               const uint32_t u32_RemainingFrames =
+                  static_cast<uint32_t>(((mc_TxService.c_ServiceData.c_Data.size() -
+                                          mc_TxService.u16_TransmissionIndex) + (u32_BytesPerFrame - 1U)) /
+                                        u32_BytesPerFrame);
+               const uint32_t u32_BlockFrames =
+                  ((orc_CanMessage.au8_Data[1] == 0U) || (orc_CanMessage.au8_Data[1] > u32_RemainingFrames)) ?
+                  u32_RemainingFrames : orc_CanMessage.au8_Data[1];
+
+               mc_TxService.u8_BlockSize = orc_CanMessage.au8_Data[1];
+               mc_TxService.u8_BlockCounter = 0U;
+               mc_TxService.u32_SeparationTimeUs = mh_GetSeparationTimeUs(orc_CanMessage.au8_Data[2]);
+               mc_TxService.u64_NextCfTimeUs = 0U; //first CF of block can be sent right away
+
+               //set timeout value for sending all CFs of the block (kicks in if the Tx buffer of the CAN dispatcher
+               // is full)
+               //N_As is ISO 15765-2 is per CAN frame (and quite high at 1000ms ...)
+               //For the block we use the number of CAN frames, assume the lowest supported bitrate
+               // in openSYDE (100 kbit/s) and an alien busload of 50%
+               //So we'll have around 2 ms/message plus the separation time requested by the server
+               //But we'll add a lower limit of 100ms to compensate for client side timing constraints
+               mc_TxService.u32_SendCfTimeout = u32_BlockFrames * (2U + ((mc_TxService.u32_SeparationTimeUs + 999U) /
+                                                                         1000U));
+               if (mc_TxService.u32_SendCfTimeout < 100U)
+               {
+                  mc_TxService.u32_SendCfTimeout = 100U;
+               }
+               //offset with current system time:
+               mc_TxService.u32_SendCfTimeout += TglGetTickCount();
+               mc_TxService.e_Status = C_ServiceState::eMORE_CONSECUTIVE_FRAMES_TO_SEND;
 
-            s32_Return = m_SendNextConsecutiveFrames();
-         }
-         else
-         {
-            m_LogWarningWithHeader("Flow control with unsupported STmin or BS received. Ignoring.", TGL_UTIL_FUNC_ID);
+               s32_Return = m_SendNextConsecutiveFrames();
+               if (s32_Return == C_BUSY)
+               {
+                  //paced by separation time; will be continued by Cycle()
+                  s32_Return = C_NO_ERR;
+               }
+            }
+            break;
+         case mhu8_ISO15765_FS_WAIT:
+            //server needs more time: restart N_Bs
+            mc_TxService.u32_StartTimeMs = TglGetTickCount();
+            break;
+         case mhu8_ISO15765_FS_OVERFLOW:
+            m_LogWarningWithHeader("Flow control with status overflow received. Aborting ongoing Tx transfer.",
+                                   TGL_UTIL_FUNC_ID);
+            mc_TxService.e_Status = C_ServiceState::eIDLE;
             s32_Return = C_OVERFLOW;
+            break;
+         default:
+            m_LogWarningWithHeader("Flow control with invalid flow status received. Ignoring.", TGL_UTIL_FUNC_ID);
+            s32_Return = C_RANGE;
+            break;
          }
       }
       else
@@ -424,6 +586,7 @@ int32_t C_OscProtocolDriverOsyTpCan::m_HandleIncomingFlowControl(const T_STWCAN_
    C_CONFIG     frame invalid (DLC is too little)
    C_RANGE      invalid sequence number
    C_OVERFLOW   could not add full service to Rx queue
+   C_COM        could not send out flow control for next block; transfer aborted
 */
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_OscProtocolDriverOsyTpCan::m_HandleIncomingConsecutiveFrame(const T_STWCAN_Msg_RX & orc_CanMessage)
@@ -436,6 +599,7 @@ int32_t C_OscProtocolDriverOsyTpCan::m_HandleIncomingConsecutiveFrame(const T_ST
       {
          //correct sequence; copy data.
          const uint8_t u8_NumBytes = (orc_CanMessage.u8_DLC - 1);
+         const uint8_t u8_MaxBytesPerFrame = mc_RxService.u8_DataLength - 1U;
          if (u8_NumBytes >= (mc_RxService.c_ServiceData.c_Data.size() - mc_RxService.u16_TransmissionIndex))
          {
             //enough data received to fill our buffer:
@@ -451,22 +615,36 @@ int32_t C_OscProtocolDriverOsyTpCan::m_HandleIncomingConsecutiveFrame(const T_ST
             }
             mc_RxService.e_Status = C_ServiceState::eIDLE;
          }
-         else if (orc_CanMessage.u8_DLC == 8U)
+         else if (orc_CanMessage.u8_DLC == mc_RxService.u8_DataLength)
          {
             (void)std::memcpy(&mc_RxService.c_ServiceData.c_Data[mc_RxService.u16_TransmissionIndex],
-                              &orc_CanMessage.au8_Data[1], 7U);
-            mc_RxService.u16_TransmissionIndex += 7U;
+                              &orc_CanMessage.au8_Data[1], u8_MaxBytesPerFrame);
+            mc_RxService.u16_TransmissionIndex += u8_MaxBytesPerFrame;
             //set next expected sequence number:
             mc_RxService.u8_SequenceNumber++;
             if (mc_RxService.u8_SequenceNumber == 16U)
             {
                mc_RxService.u8_SequenceNumber = 0U;
             }
-            //no need to check whether we need to send a flow control: we always use STmin=0 and BS=0
+            //end of block ? request next one
+            if (mc_RxService.u8_BlockSize != 0U)
+            {
+               mc_RxService.u8_BlockCounter++;
+               if (mc_RxService.u8_BlockCounter >= mc_RxService.u8_BlockSize)
+               {
+                  mc_RxService.u8_BlockCounter = 0U;
+                  s32_Return = m_SendFlowControl();
+                  if (s32_Return != C_NO_ERR)
+                  {
+                     //server will run into N_Bs timeout
+                     mc_RxService.e_Status = C_ServiceState::eIDLE;
+                  }
+               }
+            }
          }
          else
          {
-            //not all data available but DLC < 8; this is messed up: abort
+            //not all data available but DLC < RX_DL; this is messed up: abort
             mc_RxService.e_Status = C_ServiceState::eIDLE;
             m_LogWarningWithHeader("Consecutive frame with incorrect DLC received.", TGL_UTIL_FUNC_ID);
             s32_Return = C_CONFIG;
@@ -673,6 +851,119 @@ void C_OscProtocolDriverOsyTpCan::mh_ComposeSingleFrame(const C_OscProtocolDrive
    }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Utility: compose CAN FD single frame for sending
+
+   Compose CAN FD single frame from specified parameters.
+   Services with up to 7 bytes use the classic PCI format.
+   Larger services use the escape sequence defined by ISO 15765-2 (SF_DL in second byte) and are padded to the next
+    valid CAN FD frame length.
+   Function does not check for validity of parameters (e.g. valid service size).
+   Caller is responsible.
+
+   \param[in]  orc_Service       service to put into frame (max. 62 bytes)
+   \param[in]  ou32_Identifier   CAN identifier to use
+   \param[out] orc_CanMessage    resulting CAN message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscProtocolDriverOsyTpCan::mh_ComposeCanFdSingleFrame(const C_OscProtocolDriverOsyService & orc_Service,
+                                                             const uint32_t ou32_Identifier,
+                                                             T_STWCAN_Msg_TX & orc_CanMessage)
+{
+   if (orc_Service.c_Data.size() <= 7U)
+   {
+      mh_ComposeSingleFrame(orc_Service, ou32_Identifier, orc_CanMessage);
+   }
+   else
+   {
+      orc_CanMessage.u32_ID = ou32_Identifier;
+      orc_CanMessage.u8_XTD = 1U;
+      orc_CanMessage.u8_RTR = 0U;
+      orc_CanMessage.u8_DLC = static_cast<uint8_t>(orc_Service.c_Data.size() + 2U);
+
+      //set PCI:
+      orc_CanMessage.au8_Data[0] = mhu8_ISO15765_N_PCI_SF;
+      orc_CanMessage.au8_Data[1] = static_cast<uint8_t>(orc_Service.c_Data.size());
+      (void)std::memcpy(&orc_CanMessage.au8_Data[2], &orc_Service.c_Data[0], orc_Service.c_Data.size());
+   }
+   orc_CanMessage.u8_FDF = 1U;
+   mh_PadCanFdFrame(orc_CanMessage);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get CAN frame data length to use for the next Tx transfer
+
+   \return
+   configured TX_DL if the dispatcher supports CAN FD; 8 otherwise
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint8_t C_OscProtocolDriverOsyTpCan::m_GetTxDataLength(void) const
+{
+   uint8_t u8_Return = mhu8_CAN_DL_CLASSIC;
+
+   if ((mu8_TxDataLength > mhu8_CAN_DL_CLASSIC) && (mpc_CanDispatcher != NULL) &&
+       (mpc_CanDispatcher->GetFDAvailable() == true))
+   {
+      u8_Return = mu8_TxDataLength;
+   }
+   return u8_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Utility: get valid CAN FD frame length
+
+   \param[in]  ou8_NumBytes   number of bytes to transfer (0..64)
+
+   \return
+   smallest CAN FD frame length that can hold ou8_NumBytes bytes (0..8, 12, 16, 20, 24, 32, 48, 64)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint8_t C_OscProtocolDriverOsyTpCan::mh_GetCanFdFrameLength(const uint8_t ou8_NumBytes)
+{
+   uint8_t u8_Length;
+
+   if (ou8_NumBytes <= 8U)
+   {
+      u8_Length = ou8_NumBytes;
+   }
+   else if (ou8_NumBytes <= 24U)
+   {
+      //12, 16, 20, 24
+      u8_Length = static_cast<uint8_t>(((ou8_NumBytes + 3U) / 4U) * 4U);
+   }
+   else if (ou8_NumBytes <= 32U)
+   {
+      u8_Length = 32U;
+   }
+   else if (ou8_NumBytes <= 48U)
+   {
+      u8_Length = 48U;
+   }
+   else
+   {
+      u8_Length = mhu8_CAN_DL_FD_MAX;
+   }
+   return u8_Length;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Utility: pad CAN FD frame to next valid length
+
+   \param[in,out]  orc_CanMessage   CAN FD message to pad; DLC is adjusted
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscProtocolDriverOsyTpCan::mh_PadCanFdFrame(T_STWCAN_Msg_TX & orc_CanMessage)
+{
+   const uint8_t u8_Length = mh_GetCanFdFrameLength(orc_CanMessage.u8_DLC);
+
+   if (u8_Length > orc_CanMessage.u8_DLC)
+   {
+      (void)std::memset(&orc_CanMessage.au8_Data[orc_CanMessage.u8_DLC], mhu8_ISO15765_PADDING,
+                        static_cast<size_t>(u8_Length) - orc_CanMessage.u8_DLC);
+      orc_CanMessage.u8_DLC = u8_Length;
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Handling the response to the services BroadcastSetNodeIdBySerialNumber/-Extended
 
@@ -816,6 +1107,9 @@ int32_t C_OscProtocolDriverOsyTpCan::Cycle(void)
       int32_t s32_Return;
       if (mc_TxService.e_Status == C_ServiceState::eIDLE)
       {
+         const uint8_t u8_TxDataLength = m_GetTxDataLength();
+         const bool q_CanFd = (u8_TxDataLength > mhu8_CAN_DL_CLASSIC);
+
          //do we have more to send ?
          s32_Return = C_NO_ERR;
          while (s32_Return == C_NO_ERR)
@@ -823,11 +1117,19 @@ int32_t C_OscProtocolDriverOsyTpCan::Cycle(void)
             s32_Return = this->m_GetFromTxQueue(mc_TxService.c_ServiceData);
             if (s32_Return == C_NO_ERR)
             {
-               if (mc_TxService.c_ServiceData.c_Data.size() <= 7)
+               if ((mc_TxService.c_ServiceData.c_Data.size() <= 7) ||
+                   ((q_CanFd == true) && (mc_TxService.c_ServiceData.c_Data.size() <= (u8_TxDataLength - 2U))))
                {
                   //simple single frame:
                   T_STWCAN_Msg_TX c_Msg;
-                  mh_ComposeSingleFrame(mc_TxService.c_ServiceData, m_GetTxIdentifier(), c_Msg);
+                  if (q_CanFd == true)
+                  {
+                     mh_ComposeCanFdSingleFrame(mc_TxService.c_ServiceData, m_GetTxIdentifier(), c_Msg);
+                  }
+                  else
+                  {
+                     mh_ComposeSingleFrame(mc_TxService.c_ServiceData, m_GetTxIdentifier(), c_Msg);
+                  }
 
                   s32_Return = mpc_CanDispatcher->CAN_Send_Msg(c_Msg);
                   if (s32_Return != C_NO_ERR)
@@ -905,20 +1207,24 @@ int32_t C_OscProtocolDriverOsyTpCan::Cycle(void)
                }
                else
                {
-                  //multi-frame; compose first frame:
+                  //multi-frame; compose first frame (full TX_DL; CFs use the same length):
                   T_STWCAN_Msg_TX c_TxMsg;
+                  const uint8_t u8_NumBytes = u8_TxDataLength - 2U;
                   c_TxMsg.u32_ID = m_GetTxIdentifier();
                   c_TxMsg.u8_XTD = 1U;
                   c_TxMsg.u8_RTR = 0U;
-                  c_TxMsg.u8_DLC = 8U;
+                  c_TxMsg.u8_FDF = (q_CanFd == true) ? 1U : 0U;
+                  c_TxMsg.u8_DLC = u8_TxDataLength;
 
                   c_TxMsg.au8_Data[0] = static_cast<uint8_t>(mhu8_ISO15765_N_PCI_FF +
                                                              ((mc_TxService.c_ServiceData.c_Data.size() >> 8U) &
                                                               0x0FU));
                   c_TxMsg.au8_Data[1] = static_cast<uint8_t>(mc_TxService.c_ServiceData.c_Data.size() & 0xFFU);
-                  (void)std::memcpy(&c_TxMsg.au8_Data[2], &mc_TxService.c_ServiceData.c_Data[0], 6U);
-                  mc_TxService.u16_TransmissionIndex = 6U;
+                  (void)std::memcpy(&c_TxMsg.au8_Data[2], &mc_TxService.c_ServiceData.c_Data[0], u8_NumBytes);
+                  mc_TxService.u16_TransmissionIndex = u8_NumBytes;
                   mc_TxService.u8_SequenceNumber = 1U;
+                  mc_TxService.u8_DataLength = u8_TxDataLength;
+                  mc_TxService.q_CanFd = q_CanFd;
                   s32_Return = mpc_CanDispatcher->CAN_Send_Msg(c_TxMsg);
                   if (s32_Return != C_NO_ERR)
                   {
@@ -948,7 +1254,7 @@ int32_t C_OscProtocolDriverOsyTpCan::Cycle(void)
       }
       else if (mc_TxService.e_Status == C_ServiceState::eMORE_CONSECUTIVE_FRAMES_TO_SEND)
       {
-         //try to send more frames:
+         //try to send more frames (paced by separation time set by server):
          //result checked indirectly via state machine status
          (void)m_SendNextConsecutiveFrames();
          //still not finished ?
@@ -1015,6 +1321,80 @@ int32_t C_OscProtocolDriverOsyTpCan::Cycle(void)
    return s32_ReturnFunc;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wait for incoming communication for CAN-TP
+
+   Put the calling thread to sleep until there is something for Cycle() to do or the timeout expired.
+   Returns immediately if
+   - there are received services waiting to be read
+   - there are services or consecutive frames waiting to be sent
+
+   Otherwise blocks on the CAN dispatcher until CAN messages were received.
+   If sending of consecutive frames is paced by the server's STmin, blocks until the next frame is due at most.
+   Gaps below one millisecond are waited with TglDelayUntilUs() as the dispatcher only waits in full milliseconds.
+
+   \param[in]  ou32_TimeoutMs   maximum time to wait in milliseconds
+
+   \return
+   C_NO_ERR   there is something to handle by Cycle()
+   C_TIMEOUT  nothing happened within timeout
+   C_NOACT    waiting not supported by CAN driver
+   C_CONFIG   no dispatcher installed
+   else       error reported by CAN dispatcher
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscProtocolDriverOsyTpCan::WaitForIncoming(const uint32_t ou32_TimeoutMs)
+{
+   int32_t s32_Return;
+
+   if (mpc_CanDispatcher == NULL)
+   {
+      s32_Return = C_CONFIG;
+   }
+   else if ((this->m_IsRxQueueEmpty() == false) ||
+            ((mc_TxService.e_Status == C_ServiceState::eIDLE) && (this->m_IsTxQueueEmpty() == false)))
+   {
+      s32_Return = C_NO_ERR;
+   }
+   else if (mc_TxService.e_Status == C_ServiceState::eMORE_CONSECUTIVE_FRAMES_TO_SEND)
+   {
+      const uint64_t u64_Now = TglGetTickCountUs();
+      if (mc_TxService.u64_NextCfTimeUs <= u64_Now)
+      {
+         s32_Return = C_NO_ERR;
+      }
+      else if ((mc_TxService.u64_NextCfTimeUs - u64_Now) < 1000U)
+      {
+         //sub-millisecond STmin (0xF1..0xF9): the dispatcher can only wait in ms; waiting 0 ms would busy-spin
+         TglDelayUntilUs(mc_TxService.u64_NextCfTimeUs);
+         s32_Return = C_NO_ERR; //next CF is due
+      }
+      else
+      {
+         //sleep until the next CF is due (or something comes in); round up so we do not wake up too early
+         const uint64_t u64_DueInMs = ((mc_TxService.u64_NextCfTimeUs - u64_Now) + 999U) / 1000U;
+         if (u64_DueInMs < ou32_TimeoutMs)
+         {
+            s32_Return = mpc_CanDispatcher->WaitForIncoming(mu16_DispatcherClientHandle,
+                                                            static_cast<uint32_t>(u64_DueInMs));
+            if (s32_Return == C_TIMEOUT)
+            {
+               s32_Return = C_NO_ERR; //next CF is due
+            }
+         }
+         else
+         {
+            s32_Return = mpc_CanDispatcher->WaitForIncoming(mu16_DispatcherClientHandle, ou32_TimeoutMs);
+         }
+      }
+   }
+   else
+   {
+      s32_Return = mpc_CanDispatcher->WaitForIncoming(mu16_DispatcherClientHandle, ou32_TimeoutMs);
+   }
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Make server and client identifiers known to TP.
 
@@ -1266,6 +1646,82 @@ int32_t C_OscProtocolDriverOsyTpCan::SetDispatcher(C_CanDispatcher * const opc_D
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set flow control parameters for incoming segmented transfers
+
+   Configure the block size (BS) and separation time (STmin) we send in our flow control frames.
+   Allows the server to adapt the sending of consecutive frames to the capabilities of the client.
+   Will be applied with the next first frame received.
+
+   Default: BS = 0, STmin = 0 (no limits)
+
+   \param[in]    ou8_BlockSize        number of CFs to be sent by server before waiting for next flow control
+                                        (0 = no limit)
+   \param[in]    ou8_SeparationTime   minimum time between two CFs in ISO 15765-2 encoding
+                                        (0x00..0x7F: 0..127 ms; 0xF1..0xF9: 100..900 us)
+
+   \return
+   C_NO_ERR   no problems
+   C_RANGE    invalid STmin
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscProtocolDriverOsyTpCan::SetFlowControlParameters(const uint8_t ou8_BlockSize,
+                                                               const uint8_t ou8_SeparationTime)
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   if ((ou8_SeparationTime > 0x7FU) && ((ou8_SeparationTime < 0xF1U) || (ou8_SeparationTime > 0xF9U)))
+   {
+      s32_Return = C_RANGE;
+   }
+   else
+   {
+      mu8_RxBlockSize = ou8_BlockSize;
+      mu8_RxSeparationTime = ou8_SeparationTime;
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set CAN frame data length for outgoing transfers
+
+   Configure the CAN frame data length (TX_DL as defined by ISO 15765-2) used for sending services.
+   With a TX_DL > 8 CAN FD frames are used for all point-to-point transfers:
+   * single frames with up to TX_DL - 2 bytes of service data
+   * first and consecutive frames with TX_DL - 2 resp. TX_DL - 1 bytes of service data
+
+   CAN FD frames are only used if the installed dispatcher reports CAN FD to be available. Otherwise classic CAN
+    frames are used.
+   Broadcasts and openSYDE specific multi frames always use classic CAN frames.
+   The server must support CAN FD frames when a TX_DL > 8 is configured.
+   Incoming CAN FD frames are always accepted independent of this setting.
+   Will be applied with the next Tx transfer.
+
+   Default: 8 (classic CAN)
+
+   \param[in]    ou8_TxDataLength   TX_DL (8, 12, 16, 20, 24, 32, 48, 64)
+
+   \return
+   C_NO_ERR   no problems
+   C_RANGE    invalid TX_DL
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscProtocolDriverOsyTpCan::SetTxDataLength(const uint8_t ou8_TxDataLength)
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   if ((ou8_TxDataLength < mhu8_CAN_DL_CLASSIC) || (ou8_TxDataLength > mhu8_CAN_DL_FD_MAX) ||
+       (mh_GetCanFdFrameLength(ou8_TxDataLength) != ou8_TxDataLength))
+   {
+      s32_Return = C_RANGE;
+   }
+   else
+   {
+      mu8_TxDataLength = ou8_TxDataLength;
+   }
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Read serial number of all devices on local bus
 
@@ -1197,6 +1197,42 @@ int32_t C_OscProtocolDriverOsyTpIp::Cycle(void)
    return s32_ReturnFunc;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wait for incoming communication for IP-TP
+
+   Put the calling thread to sleep until there is something for Cycle() to do or the timeout expired.
+   Returns immediately if there are services waiting in the Rx or Tx queue.
+   Otherwise blocks on the TCP connection until data was received.
+
+   \param[in]  ou32_TimeoutMs   maximum time to wait in milliseconds
+
+   \return
+   C_NO_ERR   there is something to handle by Cycle()
+   C_TIMEOUT  nothing happened within timeout
+   C_NOACT    waiting not supported by IP dispatcher
+   C_CONFIG   no dispatcher installed
+   else       error reported by IP dispatcher
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscProtocolDriverOsyTpIp::WaitForIncoming(const uint32_t ou32_TimeoutMs)
+{
+   int32_t s32_Return;
+
+   if (mpc_Dispatcher == NULL)
+   {
+      s32_Return = C_CONFIG;
+   }
+   else if ((this->m_IsRxQueueEmpty() == false) || (this->m_IsTxQueueEmpty() == false))
+   {
+      s32_Return = C_NO_ERR;
+   }
+   else
+   {
+      s32_Return = mpc_Dispatcher->WaitForTcpData(mu32_DispatcherHandle, ou32_TimeoutMs);
+   }
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Print logging text
 
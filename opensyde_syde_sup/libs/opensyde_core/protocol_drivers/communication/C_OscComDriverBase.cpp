@@ -49,12 +49,12 @@ C_OscComDriverBaseCanMessage::C_OscComDriverBaseCanMessage(void) :
    u32_TimeToSend(0U),
    u32_Interval(0U)
 {
-   this->c_Msg.u8_Align = 0U;
+   this->c_Msg.u8_FDF = 0U;
    this->c_Msg.u8_DLC = 0U;
    this->c_Msg.u8_RTR = 0U;
    this->c_Msg.u8_XTD = 0U;
    this->c_Msg.u32_ID = 0U;
-   (void)std::memset(&this->c_Msg.au8_Data[0], 0, 8U);
+   (void)std::memset(&this->c_Msg.au8_Data[0], 0, sizeof(this->c_Msg.au8_Data));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -76,6 +76,7 @@ bool C_OscComDriverBaseCanMessage::operator ==(const C_OscComDriverBaseCanMessag
        (this->c_Msg.u8_DLC == orc_Cmp.c_Msg.u8_DLC) &&
        (this->c_Msg.u8_RTR == orc_Cmp.c_Msg.u8_RTR) &&
        (this->c_Msg.u8_XTD == orc_Cmp.c_Msg.u8_XTD) &&
+       (this->c_Msg.u8_FDF == orc_Cmp.c_Msg.u8_FDF) &&
        (this->u32_Interval == orc_Cmp.u32_Interval))
    {
       uint8_t u8_Counter;
@@ -412,8 +413,8 @@ int32_t C_OscComDriverBase::SendCanMessageDirect(const T_STWCAN_Msg_TX & orc_Msg
          // Inform the logger about the sent message
          T_STWCAN_Msg_RX c_Msg;
 
-         (void)std::memcpy(&c_Msg.au8_Data[0], &orc_Msg.au8_Data[0], 8U);
-         c_Msg.u8_Align = orc_Msg.u8_Align;
+         (void)std::memcpy(&c_Msg.au8_Data[0], &orc_Msg.au8_Data[0], sizeof(c_Msg.au8_Data));
+         c_Msg.u8_FDF = orc_Msg.u8_FDF;
          c_Msg.u8_DLC = orc_Msg.u8_DLC;
          c_Msg.u8_RTR = orc_Msg.u8_RTR;
          c_Msg.u8_XTD = orc_Msg.u8_XTD;
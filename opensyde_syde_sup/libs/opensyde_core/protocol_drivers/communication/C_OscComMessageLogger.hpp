@@ -139,7 +139,21 @@ private:
    C_OscComMessageLogger(const C_OscComMessageLogger &);
    C_OscComMessageLogger & operator =(const C_OscComMessageLogger &);
 
+   ///Reference to one CAN message in a registered openSYDE system definition
+   class C_OsySysDefMessageRef
+   {
+   public:
+      C_OsySysDefMessageRef(void);
+
+      const C_OscCanMessage * pc_Message;           ///< NULL: no message with this ID
+      const C_OscNodeDataPoolList * pc_DataPoolList; ///< COMM list containing the message's signals
+   };
+
    void m_ConvertCanMessage(const stw::can::T_STWCAN_Msg_RX & orc_Msg, const bool oq_IsTx);
+   void m_UpdateOsySysDefIndex(void);
+   void m_AddOsySysDefToIndex(const C_OscComMessageLoggerOsySysDefConfig & orc_SysDefConfig);
+   void m_AddOsySysDefMessageToIndex(const C_OscCanMessage & orc_Message,
+                                     const C_OscNodeDataPoolList * const opc_DataPoolList);
    void m_InterpretSysDefCanSignal(C_OscComMessageLoggerData & orc_MessageData,
                                    const C_OscCanSignal & orc_OscSignal) const;
    void m_ResetCounter(void);
@@ -159,6 +173,10 @@ private:
 
    // Database interpretation
    std::map<stw::scl::C_SclString, C_OscComMessageLoggerOsySysDefConfig> mc_OsySysDefs;
+   // Lookup of CAN messages of all active openSYDE system definitions on their configured buses
+   // (same split as for message counting: direct access for standard IDs, map for extended IDs)
+   std::vector<C_OsySysDefMessageRef> mc_OsySysDefIndexStandardId;
+   std::map<uint32_t, C_OsySysDefMessageRef> mc_OsySysDefIndexExtendedId;
 
    // Filtering
    std::vector<C_OscComMessageLoggerFilter> mc_CanFilterConfig;
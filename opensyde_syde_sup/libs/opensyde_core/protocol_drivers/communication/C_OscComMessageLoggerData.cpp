@@ -35,12 +35,14 @@ using namespace stw::opensyde_core;
 //----------------------------------------------------------------------------------------------------------------------
 C_OscComMessageLoggerDataSignal::C_OscComMessageLoggerDataSignal(void) :
    c_Name(""),
-   c_Value(""),
    c_Unit(""),
-   c_RawValueDec(""),
-   c_RawValueHex(""),
    c_Comment(""),
-   q_DlcError(false)
+   c_ValueDescription(""),
+   q_DlcError(false),
+   u64_RawValue(0U),
+   e_ValueType(C_OscNodeDataPoolContent::eUINT8),
+   f64_Factor(1.0),
+   f64_Offset(0.0)
 {
 }
 
@@ -68,6 +70,129 @@ bool C_OscComMessageLoggerDataSignal::operator <(const C_OscComMessageLoggerData
    return q_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get interpreted signal value as string
+
+   The value description is returned if set.
+
+   \return
+   Scaled value
+   "N/A" if the signal is not inside the received data bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclString C_OscComMessageLoggerDataSignal::GetValue(void) const
+{
+   C_SclString c_Return;
+
+   if (this->q_DlcError == true)
+   {
+      c_Return = "N/A";
+   }
+   else if (this->c_ValueDescription != "")
+   {
+      c_Return = this->c_ValueDescription;
+   }
+   else
+   {
+      c_Return = this->m_GetScaledValue(this->f64_Factor, this->f64_Offset);
+   }
+
+   return c_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get signal raw value as decimal string
+
+   For float types the unscaled value is returned as the raw bytes do not make any sense.
+
+   \return
+   Raw value
+   "N/A" if the signal is not inside the received data bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclString C_OscComMessageLoggerDataSignal::GetRawValueDec(void) const
+{
+   C_SclString c_Return;
+
+   if (this->q_DlcError == true)
+   {
+      c_Return = "N/A";
+   }
+   else if ((this->e_ValueType == C_OscNodeDataPoolContent::eFLOAT32) ||
+            (this->e_ValueType == C_OscNodeDataPoolContent::eFLOAT64))
+   {
+      c_Return = this->m_GetScaledValue(1.0, 0.0);
+   }
+   else
+   {
+      c_Return = C_SclString::IntToStr(this->u64_RawValue);
+   }
+
+   return c_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get signal raw value as hexadecimal string
+
+   For float types the unscaled value is returned as the raw bytes do not make any sense.
+
+   \return
+   Raw value
+   "N/A" if the signal is not inside the received data bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclString C_OscComMessageLoggerDataSignal::GetRawValueHex(void) const
+{
+   C_SclString c_Return;
+
+   if (this->q_DlcError == true)
+   {
+      c_Return = "N/A";
+   }
+   else if ((this->e_ValueType == C_OscNodeDataPoolContent::eFLOAT32) ||
+            (this->e_ValueType == C_OscNodeDataPoolContent::eFLOAT64))
+   {
+      c_Return = this->m_GetScaledValue(1.0, 0.0);
+   }
+   else
+   {
+      c_Return = C_SclString::IntToHex(static_cast<int64_t>(this->u64_RawValue), 1).UpperCase();
+   }
+
+   return c_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Convert raw value to scaled string
+
+   \param[in]  of64_Factor   Factor for resulting value
+   \param[in]  of64_Offset   Offset for resulting value
+
+   \return
+   Scaled value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclString C_OscComMessageLoggerDataSignal::m_GetScaledValue(const float64_t of64_Factor,
+                                                              const float64_t of64_Offset) const
+{
+   C_OscNodeDataPoolContent c_Value;
+   std::vector<uint8_t> c_Blob;
+   std::string c_StringValue;
+   uint32_t u32_Counter;
+
+   c_Value.SetArray(false);
+   c_Value.SetType(this->e_ValueType);
+   c_Blob.resize(c_Value.GetSizeByte());
+   for (u32_Counter = 0U; u32_Counter < c_Blob.size(); ++u32_Counter)
+   {
+      c_Blob[u32_Counter] = static_cast<uint8_t>(this->u64_RawValue >> (static_cast<uint64_t>(u32_Counter) * 8U));
+   }
+   c_Value.SetValueFromLittleEndianBlob(c_Blob);
+   c_Value.GetValueAsScaledString(of64_Factor, of64_Offset, c_StringValue, 0U, true, true);
+
+   return c_StringValue.c_str();
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Default constructor
 */
@@ -76,19 +201,11 @@ C_OscComMessageLoggerData::C_OscComMessageLoggerData(void) :
    u64_TimeStampRelative(0U),
    u64_TimeStampAbsoluteStart(0U),
    u64_TimeStampAbsoluteTimeOfDay(0U),
-   c_TimeStampRelative(""),
-   c_TimeStampAbsoluteStart(""),
-   c_TimeStampAbsoluteTimeOfDay(""),
-   c_CanIdDec(""),
-   c_CanIdHex(""),
-   c_CanDlc(""),
    q_CanDlcError(false),
-   c_CanDataDec(""),
-   c_CanDataHex(""),
    c_Name(""),
    c_ProtocolTextDec(""),
    c_ProtocolTextHex(""),
-   c_Counter(""),
+   u32_Counter(0U),
    c_CanMsg(stw::can::T_STWCAN_Msg_RX()),
    q_IsTx(false)
 {
@@ -148,3 +265,182 @@ C_SclString C_OscComMessageLoggerData::h_GetTimestampAsString(const uint64_t ou6
 
    return c_TimeStamp;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get relative timestamp as string
+
+   \return
+   Formatted timestamp (see h_GetTimestampAsString)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclString C_OscComMessageLoggerData::GetTimeStampRelative(void) const
+{
+   return C_OscComMessageLoggerData::h_GetTimestampAsString(this->u64_TimeStampRelative);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get absolute timestamp since start of logging as string
+
+   \return
+   Formatted timestamp (see h_GetTimestampAsString)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclString C_OscComMessageLoggerData::GetTimeStampAbsoluteStart(void) const
+{
+   return C_OscComMessageLoggerData::h_GetTimestampAsString(this->u64_TimeStampAbsoluteStart);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get absolute timestamp based on time of day as string
+
+   \return
+   Formatted timestamp (see h_GetTimestampAsString)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclString C_OscComMessageLoggerData::GetTimeStampAbsoluteTimeOfDay(void) const
+{
+   return C_OscComMessageLoggerData::h_GetTimestampAsString(this->u64_TimeStampAbsoluteTimeOfDay);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get CAN ID as decimal string
+
+   \return
+   CAN ID; extended IDs are marked with a trailing "x"
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclString C_OscComMessageLoggerData::GetCanIdDec(void) const
+{
+   C_SclString c_Return;
+
+   c_Return.PrintFormatted((this->c_CanMsg.u8_XTD > 0U) ? "%ux" : "%u", this->c_CanMsg.u32_ID);
+
+   return c_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get CAN ID as hexadecimal string
+
+   \return
+   CAN ID; extended IDs are marked with a trailing "x"
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclString C_OscComMessageLoggerData::GetCanIdHex(void) const
+{
+   C_SclString c_Return;
+
+   c_Return.PrintFormatted((this->c_CanMsg.u8_XTD > 0U) ? "%Xx" : "%X", this->c_CanMsg.u32_ID);
+
+   return c_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get CAN DLC as string
+
+   \return
+   CAN DLC
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclString C_OscComMessageLoggerData::GetCanDlc(void) const
+{
+   return C_SclString::IntToStr(this->c_CanMsg.u8_DLC);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get CAN data bytes as decimal string
+
+   Each byte is right aligned with a width of three characters; bytes are separated by a space.
+
+   \return
+   CAN data bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclString C_OscComMessageLoggerData::GetCanDataDec(void) const
+{
+   // up to 64 bytes with 3 digits and separator + termination
+   char_t acn_Buffer[(static_cast<uint32_t>(stw::can::STWCAN_FD_MAX_DLC) * 4U) + 1U];
+   uint32_t u32_Pos = 0U;
+   uint8_t u8_DbCounter;
+   const uint8_t u8_Dlc = this->m_GetNumberOfDataBytes();
+
+   for (u8_DbCounter = 0U; u8_DbCounter < u8_Dlc; ++u8_DbCounter)
+   {
+      const uint8_t u8_Value = this->c_CanMsg.au8_Data[u8_DbCounter];
+      if (u8_DbCounter > 0U)
+      {
+         acn_Buffer[u32_Pos] = ' ';
+         ++u32_Pos;
+      }
+      acn_Buffer[u32_Pos] = (u8_Value >= 100U) ? static_cast<char_t>('0' + (u8_Value / 100U)) : ' ';
+      acn_Buffer[u32_Pos + 1U] =
+         (u8_Value >= 10U) ? static_cast<char_t>('0' + ((u8_Value / 10U) % 10U)) : ' ';
+      acn_Buffer[u32_Pos + 2U] = static_cast<char_t>('0' + (u8_Value % 10U));
+      u32_Pos += 3U;
+   }
+   acn_Buffer[u32_Pos] = '\0';
+
+   return acn_Buffer;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get CAN data bytes as hexadecimal string
+
+   Each byte is shown with two digits; bytes are separated by a space.
+
+   \return
+   CAN data bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclString C_OscComMessageLoggerData::GetCanDataHex(void) const
+{
+   static const char_t hacn_DIGITS[] = "0123456789ABCDEF";
+   // up to 64 bytes with 2 digits and separator + termination
+   char_t acn_Buffer[(static_cast<uint32_t>(stw::can::STWCAN_FD_MAX_DLC) * 3U) + 1U];
+   uint32_t u32_Pos = 0U;
+   uint8_t u8_DbCounter;
+   const uint8_t u8_Dlc = this->m_GetNumberOfDataBytes();
+
+   for (u8_DbCounter = 0U; u8_DbCounter < u8_Dlc; ++u8_DbCounter)
+   {
+      const uint8_t u8_Value = this->c_CanMsg.au8_Data[u8_DbCounter];
+      if (u8_DbCounter > 0U)
+      {
+         acn_Buffer[u32_Pos] = ' ';
+         ++u32_Pos;
+      }
+      acn_Buffer[u32_Pos] = hacn_DIGITS[u8_Value >> 4U];
+      acn_Buffer[u32_Pos + 1U] = hacn_DIGITS[u8_Value & 0x0FU];
+      u32_Pos += 2U;
+   }
+   acn_Buffer[u32_Pos] = '\0';
+
+   return acn_Buffer;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get message counter as string
+
+   \return
+   Number of received messages with this CAN ID
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclString C_OscComMessageLoggerData::GetCounter(void) const
+{
+   return C_SclString::IntToStr(this->u32_Counter);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of data bytes to render
+
+   The DLC is limited to the frame type's maximum: 8 bytes for classic CAN, 64 bytes for CAN FD.
+
+   \return
+   Number of valid bytes in c_CanMsg.au8_Data
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint8_t C_OscComMessageLoggerData::m_GetNumberOfDataBytes(void) const
+{
+   const uint8_t u8_Max = (this->c_CanMsg.u8_FDF != 0U) ? stw::can::STWCAN_FD_MAX_DLC : 8U;
+
+   return std::min(this->c_CanMsg.u8_DLC, u8_Max);
+}
@@ -48,6 +48,7 @@ C_OscComSequencesBase::C_OscComSequencesBase(const bool oq_RoutingActive, const
    mpc_ComDriver(new C_OscComDriverFlash(oq_RoutingActive, oq_UpdateRoutingMode, &mh_MyXflReportProgress, this)),
    mpc_SystemDefinition(NULL),
    mu32_ActiveBusIndex(0U),
+   mpc_SecurityPemDb(NULL),
    mq_OpenSydeDevicesActive(false),
    mq_StwFlashloaderDevicesActive(false),
    mq_StwFlashloaderDevicesActiveOnLocalBus(false)
@@ -64,6 +65,7 @@ C_OscComSequencesBase::~C_OscComSequencesBase(void)
 {
    delete this->mpc_ComDriver;
    mpc_SystemDefinition = NULL;
+   mpc_SecurityPemDb = NULL; //do not delete ! not owned by us
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -120,6 +122,7 @@ int32_t C_OscComSequencesBase::Init(C_OscSystemDefinition & orc_SystemDefinition
       this->mu32_ActiveBusIndex = ou32_ActiveBusIndex;
       this->mc_ActiveNodes = orc_ActiveNodes;
       this->mc_TimeoutNodes.resize(this->mc_ActiveNodes.size(), 0);
+      this->mpc_SecurityPemDb = opc_SecurityPemDb;
 
       s32_Return = this->mpc_ComDriver->Init(orc_SystemDefinition, ou32_ActiveBusIndex,
                                              orc_ActiveNodes, opc_CanDispatcher, opc_IpDispatcher, opc_SecurityPemDb);
@@ -13,6 +13,7 @@
 #include "precomp_headers.hpp"
 
 #include <set>
+#include <algorithm>
 #include "stwtypes.hpp"
 #include "stwerrors.hpp"
 #include "C_OscSuSequences.hpp"
@@ -121,7 +122,8 @@ bool C_OscSuSequences::m_IsNodeActive(const uint32_t ou32_NodeIndex, const uint3
 /*! \brief   Reports some information about the current sequence
 
    To be overridden by application.
-   Default implementation here: print to console.
+   Default implementation here: print to console
+   (for a worker of a parallel system update: forward to the instance running the update).
 
    The public procedure functions report their progress using either this function or the polymorphous variation.
    If a procedure function finishes without problems it reports a progress of 100 before it returns.
@@ -145,17 +147,29 @@ bool C_OscSuSequences::m_IsNodeActive(const uint32_t ou32_NodeIndex, const uint3
 bool C_OscSuSequences::m_ReportProgress(const E_ProgressStep oe_Step, const int32_t os32_Result,
                                         const uint8_t ou8_Progress, const C_SclString & orc_Information)
 {
-   std::cout << "Step: " << static_cast<uint32_t>(oe_Step) << " Result: " << os32_Result << " Progress: " <<
-      static_cast<uint32_t>(ou8_Progress) << " Info: "  << orc_Information.c_str() << "\n";
+   bool q_Return = false;
+
+   if (this->mpc_ParallelUpdateParent != NULL)
+   {
+      //worker of a parallel system update: report via the instance running the update
+      q_Return = this->mpc_ParallelUpdateParent->m_ReportParallelUpdateProgress(*this, oe_Step, os32_Result,
+                                                                                ou8_Progress, NULL, orc_Information);
+   }
+   else
+   {
+      std::cout << "Step: " << static_cast<uint32_t>(oe_Step) << " Result: " << os32_Result << " Progress: " <<
+         static_cast<uint32_t>(ou8_Progress) << " Info: "  << orc_Information.c_str() << "\n";
+   }
 
-   return false;
+   return q_Return;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Reports some information about the current sequence for a specific server
 
    To be overridden by application.
-   Default implementation here: print to console.
+   Default implementation here: print to console
+   (for a worker of a parallel system update: forward to the instance running the update).
 
    For more details see description of the other m_ReportProgress() function
 
@@ -175,12 +189,24 @@ bool C_OscSuSequences::m_ReportProgress(const E_ProgressStep oe_Step, const int3
                                         const uint8_t ou8_Progress, const C_OscProtocolDriverOsyNode & orc_Server,
                                         const C_SclString & orc_Information)
 {
-   std::cout << "Step: " << static_cast<uint32_t>(oe_Step) << " Result: " << os32_Result << " Progress: " <<
-      static_cast<uint32_t>(ou8_Progress) << " Bus Id: " << static_cast<uint32_t>(orc_Server.u8_BusIdentifier) <<
-      " Node Id: " << static_cast<uint32_t>(orc_Server.u8_NodeIdentifier) << " Info: " <<
-      orc_Information.c_str() << "\n";
+   bool q_Return = false;
+
+   if (this->mpc_ParallelUpdateParent != NULL)
+   {
+      //worker of a parallel system update: report via the instance running the update
+      q_Return = this->mpc_ParallelUpdateParent->m_ReportParallelUpdateProgress(*this, oe_Step, os32_Result,
+                                                                                ou8_Progress, &orc_Server,
+                                                                                orc_Information);
+   }
+   else
+   {
+      std::cout << "Step: " << static_cast<uint32_t>(oe_Step) << " Result: " << os32_Result << " Progress: " <<
+         static_cast<uint32_t>(ou8_Progress) << " Bus Id: " << static_cast<uint32_t>(orc_Server.u8_BusIdentifier) <<
+         " Node Id: " << static_cast<uint32_t>(orc_Server.u8_NodeIdentifier) << " Info: " <<
+         orc_Information.c_str() << "\n";
+   }
 
-   return false;
+   return q_Return;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -2144,7 +2170,13 @@ int32_t C_OscSuSequences::m_ReadDeviceInformationStwFlashloader(const uint8_t ou
 C_OscSuSequences::C_OscSuSequences(void) :
    C_OscComSequencesBase(true, true),
    mu32_CurrentNode(0U),
-   mu32_CurrentFile(0U)
+   mu32_CurrentFile(0U),
+   mpc_ParallelUpdateParent(NULL),
+   mq_ParallelUpdateAbort(false),
+   ms32_ParallelUpdateResult(C_NO_ERR),
+   mpc_ParallelUpdateApplications(NULL),
+   mq_ParallelUpdateFailOnFirstError(true),
+   mq_ParallelUpdateAtLeastOneError(false)
 {
 }
 
@@ -3266,6 +3298,718 @@ int32_t C_OscSuSequences::ActivateFlashloader(const bool oq_FailOnFirstError)
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Update one node
+
+   Flash all configured files of one node (see UpdateSystem() for details).
+   Routing to the node is set up before and removed after the update.
+
+   \param[in]  orc_ApplicationToWrite   files to flash for the node
+   \param[in]  ou32_NodeIndex           index of node within system definition
+
+   \return
+   see UpdateSystem()
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscSuSequences::m_UpdateNode(const C_OscSuSequences::C_DoFlash & orc_ApplicationToWrite,
+                                       const uint32_t ou32_NodeIndex)
+{
+   int32_t s32_Return = C_NO_ERR;
+   C_OscSuSequencesNodeUpdateStates & rc_NodeUpdateStates = this->mc_UpdateStatesNodes[ou32_NodeIndex];
+
+   //flash openSYDE nodes
+   if ((orc_ApplicationToWrite.c_FilesToFlash.size() > 0) ||
+       (orc_ApplicationToWrite.c_FilesToWriteToNvm.size() > 0) ||
+       (orc_ApplicationToWrite.c_PemFile != ""))
+   {
+      uint32_t u32_BusIndex;
+      bool q_RoutingActivated = false;
+
+      s32_Return = this->mpc_ComDriver->GetBusIndexOfRoutingNode(ou32_NodeIndex, u32_BusIndex);
+
+      if (s32_Return == C_NOACT)
+      {
+         // No routing necessary
+         u32_BusIndex = this->mu32_ActiveBusIndex;
+         s32_Return = C_NO_ERR;
+      }
+      else if (s32_Return == C_NO_ERR)
+      {
+         uint32_t u32_ErrorIndex = 0U;
+         // Routing necessary
+         s32_Return = this->mpc_ComDriver->StartRouting(ou32_NodeIndex, &u32_ErrorIndex);
+
+         if (s32_Return != C_NO_ERR)
+         {
+            // Handle routing specific errors
+            this->mc_ConnectStatesNodes[ou32_NodeIndex].q_CouldNotReachedDueToRoutingError = true;
+            if ((s32_Return != C_CONFIG) &&
+                (s32_Return != C_RANGE))
+            {
+               this->mc_ConnectStatesNodes[u32_ErrorIndex].q_RoutingNodeError = true;
+            }
+
+            if (s32_Return == C_CHECKSUM)
+            {
+               this->mc_ConnectStatesNodes[u32_ErrorIndex].q_AuthenticationError = true;
+            }
+         }
+
+         q_RoutingActivated = true;
+      }
+      else
+      {
+         // Error case
+      }
+
+      if (s32_Return == C_NO_ERR)
+      {
+         C_OscNodeProperties::E_FlashLoaderProtocol e_ProtocolType;
+
+         const bool q_Return = m_IsNodeActive(ou32_NodeIndex, u32_BusIndex, e_ProtocolType, mc_CurrentNode);
+         if (q_Return == true)
+         {
+            if (e_ProtocolType == C_OscNodeProperties::eFL_OPEN_SYDE)
+            {
+               const C_OscDeviceDefinition * const pc_DeviceDefinition =
+                  this->mpc_SystemDefinition->c_Nodes[ou32_NodeIndex].pc_DeviceDefinition;
+               const uint32_t u32_SubDeviceIndex =
+                  this->mpc_SystemDefinition->c_Nodes[ou32_NodeIndex].u32_SubDeviceIndex;
+               (void)m_ReportProgress(eUPDATE_SYSTEM_OSY_NODE_START, C_NO_ERR, 10U, mc_CurrentNode,
+                                      "Starting device update ...");
+               tgl_assert(pc_DeviceDefinition != NULL);
+               if (pc_DeviceDefinition != NULL)
+               {
+                  C_OscProtocolDriverOsy::C_ListOfFeatures c_AvailableFeatures;
+                  bool q_SetProgrammingMode = true;
+
+                  //if connected via Ethernet we might need to reconnect (in case we ran into the session timeout)
+                  s32_Return = this->m_ReconnectToTargetServer();
+                  if (s32_Return != C_NO_ERR)
+                  {
+                     (void)m_ReportProgress(eUPDATE_SYSTEM_OSY_RECONNECT_ERROR, s32_Return, 10U, mc_CurrentNode,
+                                            "Could not reconnect to node");
+                     if (s32_Return != C_CHECKSUM)
+                     {
+                        s32_Return = C_COM;
+                     }
+                  }
+
+                  if (s32_Return == C_NO_ERR)
+                  {
+                     //check which protocol features are available
+                     s32_Return = this->mpc_ComDriver->SendOsyReadListOfFeatures(this->mc_CurrentNode,
+                                                                                 c_AvailableFeatures);
+                     if (s32_Return != C_NO_ERR)
+                     {
+                        (void)m_ReportProgress(eUPDATE_SYSTEM_OSY_NODE_READ_FEATURE_ERROR, s32_Return, 10U,
+                                               mc_CurrentNode,
+                                               "Could not read available openSYDE Flashloader features.");
+                        s32_Return = C_COM;
+                     }
+                  }
+
+                  //files to flash ?
+                  if ((s32_Return == C_NO_ERR) &&
+                      (orc_ApplicationToWrite.c_FilesToFlash.size() > 0))
+                  {
+                     tgl_assert(u32_SubDeviceIndex < pc_DeviceDefinition->c_SubDevices.size());
+                     //address based or file based ?
+                     if (pc_DeviceDefinition->c_SubDevices[u32_SubDeviceIndex].q_FlashloaderOpenSydeIsFileBased ==
+                         false)
+                     {
+                        s32_Return = m_FlashNodeOpenSydeHex(
+                           orc_ApplicationToWrite.c_FilesToFlash,
+                           orc_ApplicationToWrite.c_OtherAcceptedDeviceNames,
+                           pc_DeviceDefinition->c_SubDevices[u32_SubDeviceIndex].u32_FlashloaderOpenSydeRequestDownloadTimeout,
+                           pc_DeviceDefinition->c_SubDevices[u32_SubDeviceIndex].u32_FlashloaderOpenSydeTransferDataTimeout,
+                           q_SetProgrammingMode,
+                           rc_NodeUpdateStates.c_StateHexFiles);
+                     }
+                     else
+                     {
+                        s32_Return = m_FlashNodeOpenSydeFile(
+                           orc_ApplicationToWrite.c_FilesToFlash,
+                           pc_DeviceDefinition->c_SubDevices[u32_SubDeviceIndex].u32_FlashloaderOpenSydeRequestDownloadTimeout,
+                           pc_DeviceDefinition->c_SubDevices[u32_SubDeviceIndex].u32_FlashloaderOpenSydeTransferDataTimeout,
+                           c_AvailableFeatures,
+                           q_SetProgrammingMode,
+                           rc_NodeUpdateStates.c_StateOtherFiles);
+                     }
+                  }
+
+                  //files to write to Nvm ?
+                  if ((s32_Return == C_NO_ERR) &&
+                      (orc_ApplicationToWrite.c_FilesToWriteToNvm.size() > 0))
+                  {
+                     s32_Return =
+                        m_WriteNvmOpenSyde(orc_ApplicationToWrite.c_FilesToWriteToNvm,
+                                           c_AvailableFeatures,
+                                           q_SetProgrammingMode,
+                                           rc_NodeUpdateStates.c_StatePsiFiles);
+                  }
+
+                  // Special case: An other security level is necessary for the next steps.
+                  // The next step must set the programming mode with the other security level again
+                  q_SetProgrammingMode = true;
+
+                  // PEM file to write?
+                  if (s32_Return == C_NO_ERR)
+                  {
+                     s32_Return = m_WritePemOpenSydeFile(orc_ApplicationToWrite.c_PemFile,
+                                                         c_AvailableFeatures,
+                                                         q_SetProgrammingMode,
+                                                         rc_NodeUpdateStates.c_StatePemFile);
+                  }
+
+                  // States to write?
+                  if (s32_Return == C_NO_ERR)
+                  {
+                     s32_Return = m_WriteOpenSydeNodeStates(orc_ApplicationToWrite,
+                                                            c_AvailableFeatures,
+                                                            q_SetProgrammingMode,
+                                                            rc_NodeUpdateStates.c_StatePemFile);
+                  }
+
+                  (void)this->m_DisconnectFromTargetServer();
+               }
+               if (s32_Return == C_NO_ERR)
+               {
+                  (void)m_ReportProgress(eUPDATE_SYSTEM_OSY_NODE_FINISHED, C_NO_ERR, 100U, mc_CurrentNode,
+                                         "Finishing device update ...");
+               }
+            }
+            else
+            {
+               //flash STW Flashloader nodes
+               s32_Return = m_FlashNodeXfl(orc_ApplicationToWrite.c_FilesToFlash,
+                                           rc_NodeUpdateStates.c_StateStwFlHexFiles);
+
+               if ((s32_Return == C_NO_ERR) &&
+                   ((orc_ApplicationToWrite.c_FilesToWriteToNvm.size() > 0) ||
+                    (orc_ApplicationToWrite.c_PemFile != "")))
+               {
+                  //writing to NVM and PEM files are not supported by STW Flashloader
+                  s32_Return = C_CONFIG;
+               }
+            }
+         }
+      }
+
+      if (q_RoutingActivated == true)
+      {
+         // Stop routing always to clean up
+         this->mpc_ComDriver->StopRouting(ou32_NodeIndex);
+      }
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Update nodes one after the other
+
+   Runs the node updates of UpdateSystem() in the given order (see UpdateSystem() for the error handling).
+   Used for the sequential part of the update and by each worker of a parallel update.
+
+   \param[in]      orc_ApplicationsToWrite   list of files to flash per node
+   \param[in]      orc_NodesOrder            indices of the nodes to update, in update order
+   \param[in]      oq_FailOnFirstError       true: stop with the error of the first node that failed
+                                             false: continue with the next node
+   \param[in,out]  orq_AtLeastOneError       set to true if the update of at least one node failed
+
+   \return
+   C_NO_ERR    all nodes processed (oq_FailOnFirstError = false: check orq_AtLeastOneError)
+   C_BUSY      parallel update was stopped by another worker or by the user
+   else        error of the first node that failed (oq_FailOnFirstError = true; see UpdateSystem())
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscSuSequences::m_UpdateNodesInOrder(const std::vector<C_OscSuSequences::C_DoFlash> & orc_ApplicationsToWrite,
+                                               const std::vector<uint32_t> & orc_NodesOrder,
+                                               const bool oq_FailOnFirstError, bool & orq_AtLeastOneError)
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   for (uint32_t u32_Position = 0U; u32_Position < orc_NodesOrder.size(); u32_Position++)
+   {
+      const uint32_t u32_NodeIndex = orc_NodesOrder[u32_Position];
+      const C_DoFlash & rc_ApplicationToWrite = orc_ApplicationsToWrite[u32_NodeIndex];
+      C_OscSuSequencesNodeUpdateStates & rc_NodeUpdateStates = this->mc_UpdateStatesNodes[u32_NodeIndex];
+      const bool q_NodeHasFiles = (rc_ApplicationToWrite.c_FilesToFlash.size() > 0) ||
+                                  (rc_ApplicationToWrite.c_FilesToWriteToNvm.size() > 0) ||
+                                  (rc_ApplicationToWrite.c_PemFile != "");
+
+      if (this->m_IsParallelUpdateAborted() == true)
+      {
+         //another worker failed or the user aborted: do not start with the next node
+         s32_Return = C_BUSY;
+         break;
+      }
+
+      // Save node index
+      this->mu32_CurrentNode = u32_NodeIndex;
+
+      if ((oq_FailOnFirstError == false) && (q_NodeHasFiles == true) &&
+          (this->m_IsNodeReachable(u32_NodeIndex) == false))
+      {
+         // A node on the route to the current node had a timeout before
+         s32_Return = C_TIMEOUT;
+         osc_write_log_warning("System Update",
+                               "Node (" + C_SclString::IntToStr(u32_NodeIndex) +
+                               ") is not reachable due to previous timeout.");
+      }
+      else
+      {
+         s32_Return = this->m_UpdateNode(rc_ApplicationToWrite, u32_NodeIndex);
+      }
+
+      if (s32_Return != C_NO_ERR)
+      {
+         switch (s32_Return)
+         {
+         case C_TIMEOUT:
+            rc_NodeUpdateStates.q_Timeout = true;
+            break;
+         case C_CHECKSUM:
+            rc_NodeUpdateStates.q_AuthenticationError = true;
+            break;
+         default:
+            // Nothing to do
+            break;
+         }
+
+         orq_AtLeastOneError = true;
+         if (oq_FailOnFirstError == true)
+         {
+            break;
+         }
+
+         if (s32_Return == C_TIMEOUT)
+         {
+            // Skip all nodes routed via this one
+            this->mc_TimeoutNodes[u32_NodeIndex] = 1U;
+         }
+         osc_write_log_warning("System Update",
+                               "Update of node (" + C_SclString::IntToStr(u32_NodeIndex) +
+                               ") failed with error " + C_SclString::IntToStr(s32_Return) +
+                               ". Continuing with next node.");
+         s32_Return = C_NO_ERR;
+      }
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get all nodes the client talks to when updating one node
+
+   Adds the node itself and all routers on its route to the set.
+
+   \param[in]      ou32_NodeIndex   index of node within system definition
+   \param[in,out]  orc_Nodes        set to add the node indices to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscSuSequences::m_GetNodesOnRoute(const uint32_t ou32_NodeIndex, std::set<uint32_t> & orc_Nodes) const
+{
+   C_OscRoutingRoute c_Route(ou32_NodeIndex);
+
+   this->mpc_ComDriver->GetRouteOfNode(ou32_NodeIndex, c_Route);
+   (void)orc_Nodes.insert(ou32_NodeIndex);
+   for (uint32_t u32_Point = 0U; u32_Point < c_Route.c_VecRoutePoints.size(); ++u32_Point)
+   {
+      (void)orc_Nodes.insert(c_Route.c_VecRoutePoints[u32_Point].u32_NodeIndex);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Split the update order into lanes that can be updated concurrently
+
+   Only done if additional IP dispatchers were set with SetParallelUpdateIpDispatchers() and the client is connected
+   to an Ethernet bus (on a CAN bus all nodes share the one channel of the client).
+
+   Two nodes end up in the same lane if they share a node on their routes (e.g. two targets behind the same router,
+   or a target that is router for another one). Nodes in different lanes are reached via disjoint sets of nodes and
+   connections and can therefore be updated at the same time. Within a lane the order of orc_NodesOrder is kept.
+   STW Flashloader nodes are not put into any lane; they stay in the sequential part of the update.
+
+   \param[in]   orc_NodesOrder   update order (index is update position, value is node index)
+   \param[out]  orc_Lanes        node indices per lane in update order;
+                                 empty if there are less than two lanes (i.e. nothing to gain)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscSuSequences::m_PlanParallelUpdate(const std::vector<uint32_t> & orc_NodesOrder,
+                                            std::vector<std::vector<uint32_t> > & orc_Lanes) const
+{
+   orc_Lanes.clear();
+
+   if ((this->mc_ParallelUpdateIpDispatchers.size() > 0) &&
+       (this->mpc_SystemDefinition->c_Buses[this->mu32_ActiveBusIndex].e_Type == C_OscSystemBus::eETHERNET))
+   {
+      const uint32_t u32_NO_LANE = 0xFFFFFFFFUL;
+      std::vector<std::set<uint32_t> > c_NodesOfLanes; //nodes each lane talks to; empty for merged lanes
+      std::vector<uint32_t> c_LaneOfPosition(orc_NodesOrder.size(), u32_NO_LANE);
+      uint32_t u32_Lane;
+
+      for (uint32_t u32_Position = 0U; u32_Position < orc_NodesOrder.size(); ++u32_Position)
+      {
+         const uint32_t u32_NodeIndex = orc_NodesOrder[u32_Position];
+
+         if (this->mpc_SystemDefinition->c_Nodes[u32_NodeIndex].c_Properties.e_FlashLoader ==
+             C_OscNodeProperties::eFL_OPEN_SYDE)
+         {
+            std::set<uint32_t> c_NodesOnRoute;
+            uint32_t u32_TargetLane = u32_NO_LANE;
+
+            this->m_GetNodesOnRoute(u32_NodeIndex, c_NodesOnRoute);
+
+            //join all lanes sharing a node with this route
+            for (u32_Lane = 0U; u32_Lane < c_NodesOfLanes.size(); ++u32_Lane)
+            {
+               bool q_Shared = false;
+               for (std::set<uint32_t>::const_iterator c_It = c_NodesOnRoute.begin(); c_It != c_NodesOnRoute.end();
+                    ++c_It)
+               {
+                  if (c_NodesOfLanes[u32_Lane].count(*c_It) > 0U)
+                  {
+                     q_Shared = true;
+                     break;
+                  }
+               }
+
+               if (q_Shared == true)
+               {
+                  if (u32_TargetLane == u32_NO_LANE)
+                  {
+                     u32_TargetLane = u32_Lane;
+                  }
+                  else
+                  {
+                     //merge into the first lane found
+                     c_NodesOfLanes[u32_TargetLane].insert(c_NodesOfLanes[u32_Lane].begin(),
+                                                           c_NodesOfLanes[u32_Lane].end());
+                     c_NodesOfLanes[u32_Lane].clear();
+                     for (uint32_t u32_Other = 0U; u32_Other < u32_Position; ++u32_Other)
+                     {
+                        if (c_LaneOfPosition[u32_Other] == u32_Lane)
+                        {
+                           c_LaneOfPosition[u32_Other] = u32_TargetLane;
+                        }
+                     }
+                  }
+               }
+            }
+
+            if (u32_TargetLane == u32_NO_LANE)
+            {
+               u32_TargetLane = static_cast<uint32_t>(c_NodesOfLanes.size());
+               c_NodesOfLanes.push_back(std::set<uint32_t>());
+            }
+            c_NodesOfLanes[u32_TargetLane].insert(c_NodesOnRoute.begin(), c_NodesOnRoute.end());
+            c_LaneOfPosition[u32_Position] = u32_TargetLane;
+         }
+      }
+
+      for (u32_Lane = 0U; u32_Lane < c_NodesOfLanes.size(); ++u32_Lane)
+      {
+         if (c_NodesOfLanes[u32_Lane].size() > 0)
+         {
+            std::vector<uint32_t> c_Lane;
+            for (uint32_t u32_Position = 0U; u32_Position < orc_NodesOrder.size(); ++u32_Position)
+            {
+               if (c_LaneOfPosition[u32_Position] == u32_Lane)
+               {
+                  c_Lane.push_back(orc_NodesOrder[u32_Position]);
+               }
+            }
+            orc_Lanes.push_back(c_Lane);
+         }
+      }
+
+      if (orc_Lanes.size() < 2)
+      {
+         orc_Lanes.clear();
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Update the nodes of independent lanes concurrently
+
+   The lanes are distributed to one worker per IP dispatcher set with SetParallelUpdateIpDispatchers() (the lane
+   goes to the worker with the fewest nodes so far). Each worker is an instance of this class with its own
+   communication driver that only knows the nodes of its lanes. It runs m_UpdateNodesInOrder() in its own thread
+   and reports its progress via this instance's m_ReportProgress() (serialized; see
+   m_ReportParallelUpdateProgress()).
+
+   Our own connections to the nodes of a worker are closed before it starts (the worker opens its own).
+   If a worker cannot be initialized its nodes are not marked as updated and are left for the sequential part.
+
+   \param[in]      orc_ApplicationsToWrite   list of files to flash per node
+   \param[in]      orc_Lanes                 node indices per lane in update order (see m_PlanParallelUpdate())
+   \param[in]      oq_FailOnFirstError       true: stop all workers with the error of the first node that failed
+                                             false: continue with the next node
+   \param[in,out]  orq_AtLeastOneError       set to true if the update of at least one node failed
+   \param[out]     orc_UpdatedNodes          indices of the nodes handled by a worker
+
+   \return
+   C_NO_ERR    all workers finished (oq_FailOnFirstError = false: check orq_AtLeastOneError)
+   C_BUSY      procedure aborted by user
+   else        error of the first node that failed (oq_FailOnFirstError = true; see UpdateSystem())
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscSuSequences::m_UpdateNodesInParallel(
+   const std::vector<C_OscSuSequences::C_DoFlash> & orc_ApplicationsToWrite,
+   const std::vector<std::vector<uint32_t> > & orc_Lanes, const bool oq_FailOnFirstError,
+   bool & orq_AtLeastOneError, std::set<uint32_t> & orc_UpdatedNodes)
+{
+   const uint32_t u32_NumWorkers =
+      static_cast<uint32_t>(std::min(orc_Lanes.size(), this->mc_ParallelUpdateIpDispatchers.size()));
+   std::vector<std::vector<uint32_t> > c_OrderOfWorkers(u32_NumWorkers);
+   std::vector<std::set<uint32_t> > c_NodesOfWorkers(u32_NumWorkers);
+   std::vector<C_OscSuSequences *> c_Workers(u32_NumWorkers, NULL);
+   C_TglThread * const pc_Threads = new C_TglThread[u32_NumWorkers];
+   uint32_t u32_Worker;
+
+   this->mq_ParallelUpdateAbort = false;
+   this->ms32_ParallelUpdateResult = C_NO_ERR;
+
+   for (uint32_t u32_Lane = 0U; u32_Lane < orc_Lanes.size(); ++u32_Lane)
+   {
+      uint32_t u32_Smallest = 0U;
+      for (u32_Worker = 1U; u32_Worker < u32_NumWorkers; ++u32_Worker)
+      {
+         if (c_OrderOfWorkers[u32_Worker].size() < c_OrderOfWorkers[u32_Smallest].size())
+         {
+            u32_Smallest = u32_Worker;
+         }
+      }
+      c_OrderOfWorkers[u32_Smallest].insert(c_OrderOfWorkers[u32_Smallest].end(), orc_Lanes[u32_Lane].begin(),
+                                            orc_Lanes[u32_Lane].end());
+   }
+
+   //set up workers
+   for (u32_Worker = 0U; u32_Worker < u32_NumWorkers; ++u32_Worker)
+   {
+      C_OscSuSequences * const pc_Worker = new C_OscSuSequences();
+      std::vector<uint8_t> c_ActiveNodes(this->mc_ActiveNodes.size(), 0U);
+      int32_t s32_Result;
+
+      for (uint32_t u32_Position = 0U; u32_Position < c_OrderOfWorkers[u32_Worker].size(); ++u32_Position)
+      {
+         this->m_GetNodesOnRoute(c_OrderOfWorkers[u32_Worker][u32_Position], c_NodesOfWorkers[u32_Worker]);
+      }
+      for (std::set<uint32_t>::const_iterator c_It = c_NodesOfWorkers[u32_Worker].begin();
+           c_It != c_NodesOfWorkers[u32_Worker].end(); ++c_It)
+      {
+         c_ActiveNodes[*c_It] = 1U;
+      }
+
+      s32_Result = pc_Worker->Init(*this->mpc_SystemDefinition, this->mu32_ActiveBusIndex, c_ActiveNodes, NULL,
+                                   this->mc_ParallelUpdateIpDispatchers[u32_Worker], this->mpc_SecurityPemDb);
+      if (s32_Result == C_NO_ERR)
+      {
+         pc_Worker->mpc_ParallelUpdateParent = this;
+         pc_Worker->mpc_ParallelUpdateApplications = &orc_ApplicationsToWrite;
+         pc_Worker->mc_ParallelUpdateNodesOrder = c_OrderOfWorkers[u32_Worker];
+         pc_Worker->mq_ParallelUpdateFailOnFirstError = oq_FailOnFirstError;
+         pc_Worker->mc_UpdateStatesNodes = this->mc_UpdateStatesNodes;
+         pc_Worker->mc_ConnectStatesNodes = this->mc_ConnectStatesNodes;
+         pc_Worker->mc_ConnectStatesNodes.resize(this->mc_ActiveNodes.size());
+         pc_Worker->mc_TimeoutNodes = this->mc_TimeoutNodes;
+
+         //the worker opens its own connections
+         for (std::set<uint32_t>::const_iterator c_It = c_NodesOfWorkers[u32_Worker].begin();
+              c_It != c_NodesOfWorkers[u32_Worker].end(); ++c_It)
+         {
+            C_OscNodeProperties::E_FlashLoaderProtocol e_ProtocolType;
+            C_OscProtocolDriverOsyNode c_ServerId;
+            if (this->m_IsNodeActive(*c_It, this->mu32_ActiveBusIndex, e_ProtocolType, c_ServerId) == true)
+            {
+               (void)this->mpc_ComDriver->DisconnectNode(c_ServerId);
+            }
+         }
+
+         orc_UpdatedNodes.insert(c_OrderOfWorkers[u32_Worker].begin(), c_OrderOfWorkers[u32_Worker].end());
+         c_Workers[u32_Worker] = pc_Worker;
+      }
+      else
+      {
+         osc_write_log_warning("System Update",
+                               "Could not initialize parallel update worker " + C_SclString::IntToStr(u32_Worker) +
+                               " (error " + C_SclString::IntToStr(s32_Result) +
+                               "). Its nodes will be updated sequentially.");
+         delete pc_Worker;
+      }
+   }
+
+   //run workers
+   for (u32_Worker = 0U; u32_Worker < u32_NumWorkers; ++u32_Worker)
+   {
+      if (c_Workers[u32_Worker] != NULL)
+      {
+         if (pc_Threads[u32_Worker].Start(&C_OscSuSequences::mh_ParallelUpdateThread,
+                                          c_Workers[u32_Worker]) == false)
+         {
+            osc_write_log_warning("System Update",
+                                  "Could not start thread of parallel update worker " +
+                                  C_SclString::IntToStr(u32_Worker) + ". Running it in the calling thread.");
+            mh_ParallelUpdateThread(c_Workers[u32_Worker]);
+         }
+      }
+   }
+
+   for (u32_Worker = 0U; u32_Worker < u32_NumWorkers; ++u32_Worker)
+   {
+      if (pc_Threads[u32_Worker].IsStarted() == true)
+      {
+         pc_Threads[u32_Worker].WaitForFinished();
+      }
+   }
+
+   //collect results
+   for (u32_Worker = 0U; u32_Worker < u32_NumWorkers; ++u32_Worker)
+   {
+      C_OscSuSequences * const pc_Worker = c_Workers[u32_Worker];
+      if (pc_Worker != NULL)
+      {
+         for (std::set<uint32_t>::const_iterator c_It = c_NodesOfWorkers[u32_Worker].begin();
+              c_It != c_NodesOfWorkers[u32_Worker].end(); ++c_It)
+         {
+            this->mc_UpdateStatesNodes[*c_It] = pc_Worker->mc_UpdateStatesNodes[*c_It];
+            if (*c_It < this->mc_ConnectStatesNodes.size())
+            {
+               this->mc_ConnectStatesNodes[*c_It] = pc_Worker->mc_ConnectStatesNodes[*c_It];
+            }
+            this->mc_TimeoutNodes[*c_It] = pc_Worker->mc_TimeoutNodes[*c_It];
+         }
+
+         if (pc_Worker->mq_ParallelUpdateAtLeastOneError == true)
+         {
+            orq_AtLeastOneError = true;
+         }
+
+         pc_Worker->mpc_ComDriver->DisconnectNodes();
+         delete pc_Worker;
+      }
+   }
+   delete[] pc_Threads;
+
+   return this->ms32_ParallelUpdateResult;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Report progress of a parallel update worker
+
+   Called by the workers (in their threads) instead of reporting themselves.
+   Serializes the reports, publishes the state of the worker's current node and forwards to our m_ReportProgress()
+   so the application sees the reports of all workers.
+   An abort requested by the application stops all workers.
+
+   \param[in]  orc_Worker        reporting worker
+   \param[in]  oe_Step           Step of node configuration
+   \param[in]  os32_Result       Result of service
+   \param[in]  ou8_Progress      Progress of sequence in percentage
+   \param[in]  opc_Server        Affected node (NULL: report without server)
+   \param[in]  orc_Information   Additional text information
+
+   \return
+   Flag for aborting sequence
+   - true   abort sequence
+   - false  continue sequence
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscSuSequences::m_ReportParallelUpdateProgress(const C_OscSuSequences & orc_Worker,
+                                                      const E_ProgressStep oe_Step, const int32_t os32_Result,
+                                                      const uint8_t ou8_Progress,
+                                                      const C_OscProtocolDriverOsyNode * const opc_Server,
+                                                      const C_SclString & orc_Information)
+{
+   bool q_Abort;
+
+   this->mc_ParallelUpdateLock.Acquire();
+
+   this->mu32_CurrentNode = orc_Worker.mu32_CurrentNode;
+   this->mu32_CurrentFile = orc_Worker.mu32_CurrentFile;
+   if (orc_Worker.mu32_CurrentNode < this->mc_UpdateStatesNodes.size())
+   {
+      this->mc_UpdateStatesNodes[orc_Worker.mu32_CurrentNode] =
+         orc_Worker.mc_UpdateStatesNodes[orc_Worker.mu32_CurrentNode];
+   }
+
+   if (opc_Server != NULL)
+   {
+      q_Abort = this->m_ReportProgress(oe_Step, os32_Result, ou8_Progress, *opc_Server, orc_Information);
+   }
+   else
+   {
+      q_Abort = this->m_ReportProgress(oe_Step, os32_Result, ou8_Progress, orc_Information);
+   }
+
+   if (q_Abort == true)
+   {
+      this->mq_ParallelUpdateAbort = true;
+   }
+   else
+   {
+      q_Abort = this->mq_ParallelUpdateAbort;
+   }
+
+   this->mc_ParallelUpdateLock.Release();
+
+   return q_Abort;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check whether a running parallel update shall stop
+
+   \return
+   true    we are a worker and the update was aborted by the user or by a failed worker
+   false   continue (always for the instance running the update itself)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscSuSequences::m_IsParallelUpdateAborted(void)
+{
+   bool q_Return = false;
+
+   if (this->mpc_ParallelUpdateParent != NULL)
+   {
+      this->mpc_ParallelUpdateParent->mc_ParallelUpdateLock.Acquire();
+      q_Return = this->mpc_ParallelUpdateParent->mq_ParallelUpdateAbort;
+      this->mpc_ParallelUpdateParent->mc_ParallelUpdateLock.Release();
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Thread function of a parallel update worker
+
+   Updates the worker's nodes. If the worker stops with an error (fail on first error or abort) the error is
+   recorded as result of the parallel update (unless another worker was first) and all other workers are stopped.
+
+   \param[in]  opv_Worker  worker instance (C_OscSuSequences)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscSuSequences::mh_ParallelUpdateThread(void * const opv_Worker)
+{
+   C_OscSuSequences * const pc_Worker = reinterpret_cast<C_OscSuSequences *>(opv_Worker);
+   C_OscSuSequences * const pc_Parent = pc_Worker->mpc_ParallelUpdateParent;
+   const int32_t s32_Return = pc_Worker->m_UpdateNodesInOrder(*pc_Worker->mpc_ParallelUpdateApplications,
+                                                              pc_Worker->mc_ParallelUpdateNodesOrder,
+                                                              pc_Worker->mq_ParallelUpdateFailOnFirstError,
+                                                              pc_Worker->mq_ParallelUpdateAtLeastOneError);
+
+   if (s32_Return != C_NO_ERR)
+   {
+      pc_Parent->mc_ParallelUpdateLock.Acquire();
+      if (pc_Parent->ms32_ParallelUpdateResult == C_NO_ERR)
+      {
+         pc_Parent->ms32_ParallelUpdateResult = s32_Return;
+      }
+      pc_Parent->mq_ParallelUpdateAbort = true;
+      pc_Parent->mc_ParallelUpdateLock.Release();
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Read information of server nodes
 
@@ -3490,9 +4234,22 @@ int32_t C_OscSuSequences::ReadDeviceInformation(const bool oq_FailOnFirstError)
    * Reports 0..100 for the overall process
    * Reports 0..100 for each file of each individual node being flashed
 
+   Parallel update:
+   If IP dispatchers were set with SetParallelUpdateIpDispatchers() and the client is connected to an Ethernet bus,
+   nodes reached via disjoint routes are updated concurrently before the remaining nodes are updated sequentially
+   (see m_PlanParallelUpdate()). In that case m_ReportProgress() is also called from the worker threads
+   (never concurrently).
+
+   Error handling:
+   * oq_FailOnFirstError = true: the sequence is aborted with the error of the first node that failed
+   * oq_FailOnFirstError = false: the remaining nodes are updated; nodes routed via a node that had a timeout
+     are skipped; the details are available via GetUpdateStates() and the log file
+
    \param[in]  orc_ApplicationsToWrite   list of files to flash per node; must have the same size as the system
                                           definition contains nodes
    \param[in]  orc_NodesOrder            Vector with node update order (index is update position, value is node index)
+   \param[in]  oq_FailOnFirstError       true: abort the update if the update of one node fails
+                                          false: continue with the next node if the update of one node fails
 
    \return
    C_NO_ERR    flashed all files
@@ -3519,10 +4276,13 @@ int32_t C_OscSuSequences::ReadDeviceInformation(const bool oq_FailOnFirstError)
    C_WARN      The file is present but key details of PEM file could not be extracted
    C_CHECKSUM  Security related error (something went wrong while handshaking with the server)
    C_RANGE     At least one feature of the openSYDE Flashloader is not available for NVM writing
+               (all above errors of the node update itself are only reported with oq_FailOnFirstError = true)
+   C_UNKNOWN_ERR  oq_FailOnFirstError = false: update failed for at least one node
+                  (see GetUpdateStates() and log for details)
 */
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_OscSuSequences::UpdateSystem(const std::vector<C_OscSuSequences::C_DoFlash> & orc_ApplicationsToWrite,
-                                       const std::vector<uint32_t> & orc_NodesOrder)
+                                       const std::vector<uint32_t> & orc_NodesOrder, const bool oq_FailOnFirstError)
 {
    int32_t s32_Return = C_NO_ERR;
 
@@ -3544,6 +4304,11 @@ int32_t C_OscSuSequences::UpdateSystem(const std::vector<C_OscSuSequences::C_DoF
       // Reset states
       this->mc_UpdateStatesNodes.clear();
       this->mc_UpdateStatesNodes.resize(this->mc_ActiveNodes.size());
+      if (this->mc_TimeoutNodes.size() != this->mc_ActiveNodes.size())
+      {
+         // In case of not used ActivateFlashloader function
+         this->mc_TimeoutNodes.resize(this->mc_ActiveNodes.size(), 0U);
+      }
 
       //are all nodes supposed to get flashed active ?
       for (uint16_t u16_Node = 0U; u16_Node < this->mpc_SystemDefinition->c_Nodes.size(); u16_Node++)
@@ -3761,217 +4526,39 @@ int32_t C_OscSuSequences::UpdateSystem(const std::vector<C_OscSuSequences::C_DoF
 
    if (s32_Return == C_NO_ERR)
    {
-      (void)m_ReportProgress(eUPDATE_SYSTEM_START, C_NO_ERR, 0U, "Starting System Update ...");
-      for (uint32_t u32_Position = 0U; u32_Position < orc_NodesOrder.size(); u32_Position++)
-      {
-         const uint32_t u32_NodeIndex = orc_NodesOrder[u32_Position];
-         C_OscSuSequencesNodeUpdateStates & rc_NodeUpdateStates = this->mc_UpdateStatesNodes[u32_NodeIndex];
-
-         // Save node index
-         this->mu32_CurrentNode = u32_NodeIndex;
-
-         //flash openSYDE nodes
-         if ((orc_ApplicationsToWrite[u32_NodeIndex].c_FilesToFlash.size() > 0) ||
-             (orc_ApplicationsToWrite[u32_NodeIndex].c_FilesToWriteToNvm.size() > 0) ||
-             (orc_ApplicationsToWrite[u32_NodeIndex].c_PemFile != ""))
-         {
-            uint32_t u32_BusIndex;
-            bool q_RoutingActivated = false;
-
-            s32_Return = this->mpc_ComDriver->GetBusIndexOfRoutingNode(u32_NodeIndex, u32_BusIndex);
-
-            if (s32_Return == C_NOACT)
-            {
-               // No routing necessary
-               u32_BusIndex = this->mu32_ActiveBusIndex;
-               s32_Return = C_NO_ERR;
-            }
-            else if (s32_Return == C_NO_ERR)
-            {
-               uint32_t u32_ErrorIndex = 0U;
-               // Routing necessary
-               s32_Return = this->mpc_ComDriver->StartRouting(u32_NodeIndex, &u32_ErrorIndex);
-
-               if (s32_Return != C_NO_ERR)
-               {
-                  // Handle routing specific errors
-                  this->mc_ConnectStatesNodes[u32_NodeIndex].q_CouldNotReachedDueToRoutingError = true;
-                  if ((s32_Return != C_CONFIG) &&
-                      (s32_Return != C_RANGE))
-                  {
-                     this->mc_ConnectStatesNodes[u32_ErrorIndex].q_RoutingNodeError = true;
-                  }
-
-                  if (s32_Return == C_CHECKSUM)
-                  {
-                     this->mc_ConnectStatesNodes[u32_ErrorIndex].q_AuthenticationError = true;
-                  }
-               }
-
-               q_RoutingActivated = true;
-            }
-            else
-            {
-               // Error case
-            }
-
-            if (s32_Return == C_NO_ERR)
-            {
-               C_OscNodeProperties::E_FlashLoaderProtocol e_ProtocolType;
-
-               const bool q_Return = m_IsNodeActive(u32_NodeIndex, u32_BusIndex, e_ProtocolType, mc_CurrentNode);
-               if (q_Return == true)
-               {
-                  if (e_ProtocolType == C_OscNodeProperties::eFL_OPEN_SYDE)
-                  {
-                     const C_OscDeviceDefinition * const pc_DeviceDefinition =
-                        this->mpc_SystemDefinition->c_Nodes[u32_NodeIndex].pc_DeviceDefinition;
-                     const uint32_t u32_SubDeviceIndex =
-                        this->mpc_SystemDefinition->c_Nodes[u32_NodeIndex].u32_SubDeviceIndex;
-                     (void)m_ReportProgress(eUPDATE_SYSTEM_OSY_NODE_START, C_NO_ERR, 10U, mc_CurrentNode,
-                                            "Starting device update ...");
-                     tgl_assert(pc_DeviceDefinition != NULL);
-                     if (pc_DeviceDefinition != NULL)
-                     {
-                        C_OscProtocolDriverOsy::C_ListOfFeatures c_AvailableFeatures;
-                        bool q_SetProgrammingMode = true;
-
-                        //if connected via Ethernet we might need to reconnect (in case we ran into the session timeout)
-                        s32_Return = this->m_ReconnectToTargetServer();
-                        if (s32_Return != C_NO_ERR)
-                        {
-                           (void)m_ReportProgress(eUPDATE_SYSTEM_OSY_RECONNECT_ERROR, s32_Return, 10U, mc_CurrentNode,
-                                                  "Could not reconnect to node");
-                           if (s32_Return != C_CHECKSUM)
-                           {
-                              s32_Return = C_COM;
-                           }
-                        }
-
-                        if (s32_Return == C_NO_ERR)
-                        {
-                           //check which protocol features are available
-                           s32_Return = this->mpc_ComDriver->SendOsyReadListOfFeatures(this->mc_CurrentNode,
-                                                                                       c_AvailableFeatures);
-                           if (s32_Return != C_NO_ERR)
-                           {
-                              (void)m_ReportProgress(eUPDATE_SYSTEM_OSY_NODE_READ_FEATURE_ERROR, s32_Return, 10U,
-                                                     mc_CurrentNode,
-                                                     "Could not read available openSYDE Flashloader features.");
-                              s32_Return = C_COM;
-                           }
-                        }
+      bool q_AtLeastOneError = false;
 
-                        //files to flash ?
-                        if ((s32_Return == C_NO_ERR) &&
-                            (orc_ApplicationsToWrite[u32_NodeIndex].c_FilesToFlash.size() > 0))
-                        {
-                           tgl_assert(u32_SubDeviceIndex < pc_DeviceDefinition->c_SubDevices.size());
-                           //address based or file based ?
-                           if (pc_DeviceDefinition->c_SubDevices[u32_SubDeviceIndex].q_FlashloaderOpenSydeIsFileBased ==
-                               false)
-                           {
-                              s32_Return = m_FlashNodeOpenSydeHex(
-                                 orc_ApplicationsToWrite[u32_NodeIndex].c_FilesToFlash,
-                                 orc_ApplicationsToWrite[u32_NodeIndex].c_OtherAcceptedDeviceNames,
-                                 pc_DeviceDefinition->c_SubDevices[u32_SubDeviceIndex].u32_FlashloaderOpenSydeRequestDownloadTimeout,
-                                 pc_DeviceDefinition->c_SubDevices[u32_SubDeviceIndex].u32_FlashloaderOpenSydeTransferDataTimeout,
-                                 q_SetProgrammingMode,
-                                 rc_NodeUpdateStates.c_StateHexFiles);
-                           }
-                           else
-                           {
-                              s32_Return = m_FlashNodeOpenSydeFile(
-                                 orc_ApplicationsToWrite[u32_NodeIndex].c_FilesToFlash,
-                                 pc_DeviceDefinition->c_SubDevices[u32_SubDeviceIndex].u32_FlashloaderOpenSydeRequestDownloadTimeout,
-                                 pc_DeviceDefinition->c_SubDevices[u32_SubDeviceIndex].u32_FlashloaderOpenSydeTransferDataTimeout,
-                                 c_AvailableFeatures,
-                                 q_SetProgrammingMode,
-                                 rc_NodeUpdateStates.c_StateOtherFiles);
-                           }
-                        }
-
-                        //files to write to Nvm ?
-                        if ((s32_Return == C_NO_ERR) &&
-                            (orc_ApplicationsToWrite[u32_NodeIndex].c_FilesToWriteToNvm.size() > 0))
-                        {
-                           s32_Return =
-                              m_WriteNvmOpenSyde(orc_ApplicationsToWrite[u32_NodeIndex].c_FilesToWriteToNvm,
-                                                 c_AvailableFeatures,
-                                                 q_SetProgrammingMode,
-                                                 rc_NodeUpdateStates.c_StatePsiFiles);
-                        }
-
-                        // Special case: An other security level is necessary for the next steps.
-                        // The next step must set the programming mode with the other security level again
-                        q_SetProgrammingMode = true;
-
-                        // PEM file to write?
-                        if (s32_Return == C_NO_ERR)
-                        {
-                           s32_Return = m_WritePemOpenSydeFile(orc_ApplicationsToWrite[u32_NodeIndex].c_PemFile,
-                                                               c_AvailableFeatures,
-                                                               q_SetProgrammingMode,
-                                                               rc_NodeUpdateStates.c_StatePemFile);
-                        }
+      std::vector<std::vector<uint32_t> > c_ParallelLanes;
+      std::set<uint32_t> c_NodesUpdatedInParallel;
 
-                        // States to write?
-                        if (s32_Return == C_NO_ERR)
-                        {
-                           s32_Return = m_WriteOpenSydeNodeStates(orc_ApplicationsToWrite[u32_NodeIndex],
-                                                                  c_AvailableFeatures,
-                                                                  q_SetProgrammingMode,
-                                                                  rc_NodeUpdateStates.c_StatePemFile);
-                        }
+      (void)m_ReportProgress(eUPDATE_SYSTEM_START, C_NO_ERR, 0U, "Starting System Update ...");
 
-                        (void)this->m_DisconnectFromTargetServer();
-                     }
-                     if (s32_Return == C_NO_ERR)
-                     {
-                        (void)m_ReportProgress(eUPDATE_SYSTEM_OSY_NODE_FINISHED, C_NO_ERR, 100U, mc_CurrentNode,
-                                               "Finishing device update ...");
-                     }
-                  }
-                  else
-                  {
-                     //flash STW Flashloader nodes
-                     s32_Return = m_FlashNodeXfl(orc_ApplicationsToWrite[u32_NodeIndex].c_FilesToFlash,
-                                                 rc_NodeUpdateStates.c_StateStwFlHexFiles);
+      //nodes behind independent routers can be updated concurrently; everything else keeps the sequential order
+      this->m_PlanParallelUpdate(orc_NodesOrder, c_ParallelLanes);
+      if (c_ParallelLanes.size() > 0)
+      {
+         s32_Return = this->m_UpdateNodesInParallel(orc_ApplicationsToWrite, c_ParallelLanes, oq_FailOnFirstError,
+                                                    q_AtLeastOneError, c_NodesUpdatedInParallel);
+      }
 
-                     if ((s32_Return == C_NO_ERR) &&
-                         ((orc_ApplicationsToWrite[u32_NodeIndex].c_FilesToWriteToNvm.size() > 0) ||
-                          (orc_ApplicationsToWrite[u32_NodeIndex].c_PemFile != "")))
-                     {
-                        //writing to NVM and PEM files are not supported by STW Flashloader
-                        s32_Return = C_CONFIG;
-                     }
-                  }
-               }
-            }
+      if (s32_Return == C_NO_ERR)
+      {
+         std::vector<uint32_t> c_SequentialOrder;
 
-            if (q_RoutingActivated == true)
-            {
-               // Stop routing always to clean up
-               this->mpc_ComDriver->StopRouting(u32_NodeIndex);
-            }
-         }
-         if (s32_Return != C_NO_ERR)
+         for (uint32_t u32_Position = 0U; u32_Position < orc_NodesOrder.size(); u32_Position++)
          {
-            switch (s32_Return)
+            if (c_NodesUpdatedInParallel.count(orc_NodesOrder[u32_Position]) == 0U)
             {
-            case C_TIMEOUT:
-               rc_NodeUpdateStates.q_Timeout = true;
-               break;
-            case C_CHECKSUM:
-               rc_NodeUpdateStates.q_AuthenticationError = true;
-               break;
-            default:
-               // Nothing to do
-               break;
+               c_SequentialOrder.push_back(orc_NodesOrder[u32_Position]);
             }
-
-            break;
          }
+         s32_Return = this->m_UpdateNodesInOrder(orc_ApplicationsToWrite, c_SequentialOrder, oq_FailOnFirstError,
+                                                 q_AtLeastOneError);
+      }
+
+      if ((s32_Return == C_NO_ERR) && (q_AtLeastOneError == true))
+      {
+         s32_Return = C_UNKNOWN_ERR;
       }
    }
 
@@ -4131,6 +4718,23 @@ int32_t C_OscSuSequences::ResetSystem(void)
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set IP dispatchers for updating independent nodes in parallel
+
+   UpdateSystem() uses one worker per dispatcher to update nodes behind independent routers concurrently
+   (see m_PlanParallelUpdate()). The dispatchers must be of the same type as the one passed to Init() and must not be
+   used by anyone else while UpdateSystem() is running. Pass an empty vector to update strictly sequentially (default).
+
+   The caller is responsible to keep the dispatchers valid while UpdateSystem() is running.
+
+   \param[in]  orc_IpDispatchers   additional IP dispatchers (one per worker)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscSuSequences::SetParallelUpdateIpDispatchers(const std::vector<C_OscIpDispatcher *> & orc_IpDispatchers)
+{
+   this->mc_ParallelUpdateIpDispatchers = orc_IpDispatchers;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Returns the node states of the connect process
 
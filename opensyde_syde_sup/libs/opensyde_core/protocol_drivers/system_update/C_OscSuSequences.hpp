@@ -15,7 +15,9 @@
 #define C_OSCSUSEQUENCESH
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <set>
 #include "stwtypes.hpp"
+#include "TglTasks.hpp"
 #include "C_SclString.hpp"
 #include "C_OscSystemDefinition.hpp"
 #include "C_OscComSequencesBase.hpp"
@@ -244,9 +246,11 @@ public:
    int32_t ActivateFlashloader(const bool oq_FailOnFirstError = true);
    int32_t ReadDeviceInformation(const bool oq_FailOnFirstError = true);
    int32_t UpdateSystem(const std::vector<C_DoFlash> & orc_ApplicationsToWrite,
-                        const std::vector<uint32_t> & orc_NodesOrder);
+                        const std::vector<uint32_t> & orc_NodesOrder, const bool oq_FailOnFirstError = true);
    int32_t ResetSystem(void);
 
+   void SetParallelUpdateIpDispatchers(const std::vector<C_OscIpDispatcher *> & orc_IpDispatchers);
+
    virtual int32_t GetConnectStates(std::vector<C_OscSuSequencesNodeConnectStates> & orc_ConnectStatesNodes)
    const;
    virtual int32_t GetUpdateStates(std::vector<C_OscSuSequencesNodeUpdateStates> & orc_UpdateStatesNodes)
@@ -290,6 +294,18 @@ private:
    std::vector<C_OscSuSequencesNodeConnectStates> mc_ConnectStatesNodes;
    std::vector<C_OscSuSequencesNodeUpdateStates> mc_UpdateStatesNodes;
 
+   //parallel system update:
+   std::vector<C_OscIpDispatcher *> mc_ParallelUpdateIpDispatchers; ///< additional dispatchers; one per worker
+   C_OscSuSequences * mpc_ParallelUpdateParent;          ///< worker only: instance running the system update
+   stw::tgl::C_TglCriticalSection mc_ParallelUpdateLock; ///< protects reports, abort flag and result of workers
+   bool mq_ParallelUpdateAbort;                          ///< true: all workers shall stop
+   int32_t ms32_ParallelUpdateResult;                    ///< first error a worker stopped with
+   //worker only: job of the worker thread
+   const std::vector<C_DoFlash> * mpc_ParallelUpdateApplications;
+   std::vector<uint32_t> mc_ParallelUpdateNodesOrder;
+   bool mq_ParallelUpdateFailOnFirstError;
+   bool mq_ParallelUpdateAtLeastOneError;
+
    int32_t m_FlashNodeOpenSydeHex(const std::vector<stw::scl::C_SclString> & orc_FilesToFlash,
                                   const std::vector<stw::scl::C_SclString> & orc_OtherAcceptedDeviceNames,
                                   const uint32_t ou32_RequestDownloadTimeout, const uint32_t ou32_TransferDataTimeout,
@@ -323,6 +339,24 @@ private:
 
    int32_t m_WriteFingerPrintOsy(void);
 
+   int32_t m_UpdateNode(const C_DoFlash & orc_ApplicationToWrite, const uint32_t ou32_NodeIndex);
+   int32_t m_UpdateNodesInOrder(const std::vector<C_DoFlash> & orc_ApplicationsToWrite,
+                                const std::vector<uint32_t> & orc_NodesOrder, const bool oq_FailOnFirstError,
+                                bool & orq_AtLeastOneError);
+   void m_GetNodesOnRoute(const uint32_t ou32_NodeIndex, std::set<uint32_t> & orc_Nodes) const;
+   void m_PlanParallelUpdate(const std::vector<uint32_t> & orc_NodesOrder,
+                             std::vector<std::vector<uint32_t> > & orc_Lanes) const;
+   int32_t m_UpdateNodesInParallel(const std::vector<C_DoFlash> & orc_ApplicationsToWrite,
+                                   const std::vector<std::vector<uint32_t> > & orc_Lanes,
+                                   const bool oq_FailOnFirstError, bool & orq_AtLeastOneError,
+                                   std::set<uint32_t> & orc_UpdatedNodes);
+   bool m_ReportParallelUpdateProgress(const C_OscSuSequences & orc_Worker, const E_ProgressStep oe_Step,
+                                       const int32_t os32_Result, const uint8_t ou8_Progress,
+                                       const C_OscProtocolDriverOsyNode * const opc_Server,
+                                       const stw::scl::C_SclString & orc_Information);
+   bool m_IsParallelUpdateAborted(void);
+   static void mh_ParallelUpdateThread(void * const opv_Worker);
+
    int32_t m_FlashNodeXfl(const std::vector<stw::scl::C_SclString> & orc_FilesToFlash,
                           std::vector<C_OscSuSequencesNodeStwFlHexFileStates> & orc_StateHexFiles);
 
@@ -98,16 +98,79 @@ static const uint32_t mau32_CRC_TABLE[] =
    0xb3667a2eU, 0xc4614ab8U, 0x5d681b02U, 0x2a6f2b94U, 0xb40bbe37U, 0xc30c8ea1U, 0x5a05df1bU, 0x2d02ef8dU
 };
 
+//number of bytes processed per step by the table driven "slice-by-8" algorithms
+static const uint32_t mu32_SLICE_SIZE = 8U;
+
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
+///Lookup tables for processing mu32_SLICE_SIZE bytes per step
+///Table [n] contains the checksum of a byte followed by n zero bytes; table [0] is the regular byte-wise table.
+struct T_CrcSliceTables
+{
+   uint16_t aau16_Crc16[mu32_SLICE_SIZE][256];
+   uint32_t aau32_Crc32[mu32_SLICE_SIZE][256];
+};
+
 /* -- Global Variables ---------------------------------------------------------------------------------------------- */
 
 /* -- Module Global Variables --------------------------------------------------------------------------------------- */
 
 /* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+static T_CrcSliceTables m_CreateCrcSliceTables(void);
+static const T_CrcSliceTables & m_GetCrcSliceTables(void);
 
 /* -- Implementation ------------------------------------------------------------------------------------------------ */
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief    Create lookup tables for "slice-by-8" CRC calculation
+
+   The tables are derived from the byte-wise tables.
+
+   \return
+   Lookup tables
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static T_CrcSliceTables m_CreateCrcSliceTables(void)
+{
+   T_CrcSliceTables c_Tables;
+
+   for (uint32_t u32_Byte = 0U; u32_Byte < 256U; u32_Byte++)
+   {
+      c_Tables.aau16_Crc16[0][u32_Byte] = mau16_CRC_TABLE[u32_Byte];
+      c_Tables.aau32_Crc32[0][u32_Byte] = mau32_CRC_TABLE[u32_Byte];
+   }
+   for (uint32_t u32_Slice = 1U; u32_Slice < mu32_SLICE_SIZE; u32_Slice++)
+   {
+      for (uint32_t u32_Byte = 0U; u32_Byte < 256U; u32_Byte++)
+      {
+         //process one additional zero byte
+         const uint16_t u16_Previous = c_Tables.aau16_Crc16[u32_Slice - 1U][u32_Byte];
+         const uint32_t u32_Previous = c_Tables.aau32_Crc32[u32_Slice - 1U][u32_Byte];
+         c_Tables.aau16_Crc16[u32_Slice][u32_Byte] =
+            static_cast<uint16_t>((static_cast<uint16_t>(u16_Previous << 8U)) ^
+                                  mau16_CRC_TABLE[static_cast<uint8_t>(u16_Previous >> 8U)]);
+         c_Tables.aau32_Crc32[u32_Slice][u32_Byte] = (u32_Previous >> 8U) ^ mau32_CRC_TABLE[u32_Previous & 0xFFU];
+      }
+   }
+   return c_Tables;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief    Get lookup tables for "slice-by-8" CRC calculation
+
+   The tables are created on first use (initialization of local statics is thread safe).
+
+   \return
+   Lookup tables
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static const T_CrcSliceTables & m_GetCrcSliceTables(void)
+{
+   static const T_CrcSliceTables hc_TABLES = m_CreateCrcSliceTables();
+
+   return hc_TABLES;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief    Calculate 16 bit CRC STW style
 
@@ -125,10 +188,31 @@ static const uint32_t mau32_CRC_TABLE[] =
 void C_SclChecksums::CalcCRC16STW(const void * const opv_Start, const uint32_t ou32_NumBytes, uint16_t & oru16_Crc)
 {
    const uint8_t * const pu8_Data = reinterpret_cast<const uint8_t *>(opv_Start); //lint !e925 we need to parse
+   uint32_t u32_Index = 0U;
+
+   if (ou32_NumBytes >= mu32_SLICE_SIZE)
+   {
+      const T_CrcSliceTables & rc_Tables = m_GetCrcSliceTables();
+
+      // 8 bytes per step; the data bytes are added after shifting so only the CRC and the first 6 bytes need lookups
+      for (; (u32_Index + mu32_SLICE_SIZE) <= ou32_NumBytes; u32_Index += mu32_SLICE_SIZE)
+      {
+         const uint8_t * const pu8_Slice = &pu8_Data[u32_Index];
+         oru16_Crc = static_cast<uint16_t>(rc_Tables.aau16_Crc16[7][static_cast<uint8_t>(oru16_Crc >> 8U)] ^
+                                           rc_Tables.aau16_Crc16[6][static_cast<uint8_t>(oru16_Crc)] ^
+                                           rc_Tables.aau16_Crc16[5][pu8_Slice[0]] ^
+                                           rc_Tables.aau16_Crc16[4][pu8_Slice[1]] ^
+                                           rc_Tables.aau16_Crc16[3][pu8_Slice[2]] ^
+                                           rc_Tables.aau16_Crc16[2][pu8_Slice[3]] ^
+                                           rc_Tables.aau16_Crc16[1][pu8_Slice[4]] ^
+                                           rc_Tables.aau16_Crc16[0][pu8_Slice[5]] ^
+                                           (static_cast<uint16_t>(pu8_Slice[6]) << 8U) ^ pu8_Slice[7]);
+      }
+   }
 
-   // byte-by-byte
+   // byte-by-byte for the rest
 
-   for (uint32_t u32_Index = 0U; u32_Index < ou32_NumBytes; u32_Index++)
+   for (; u32_Index < ou32_NumBytes; u32_Index++)
    {
       const uint8_t u8_Index = static_cast<uint8_t>(oru16_Crc >> 8U);
       oru16_Crc = static_cast<uint16_t>((static_cast<uint16_t>(oru16_Crc << 8U)) ^ mau16_CRC_TABLE[u8_Index] ^
@@ -152,10 +236,32 @@ void C_SclChecksums::CalcCRC16STW(const void * const opv_Start, const uint32_t o
 void C_SclChecksums::CalcCRC16(const void * const opv_Start, const uint32_t ou32_NumBytes, uint16_t & oru16_Crc)
 {
    const uint8_t * const pu8_Data = reinterpret_cast<const uint8_t *>(opv_Start); //lint !e925 we need to parse
+   uint32_t u32_Index = 0U;
 
-   // byte-by-byte
+   if (ou32_NumBytes >= mu32_SLICE_SIZE)
+   {
+      const T_CrcSliceTables & rc_Tables = m_GetCrcSliceTables();
+
+      // 8 bytes per step; the current CRC is combined with the first two bytes
+      for (; (u32_Index + mu32_SLICE_SIZE) <= ou32_NumBytes; u32_Index += mu32_SLICE_SIZE)
+      {
+         const uint8_t * const pu8_Slice = &pu8_Data[u32_Index];
+         const uint8_t u8_First = static_cast<uint8_t>(oru16_Crc >> 8U) ^ pu8_Slice[0];
+         const uint8_t u8_Second = static_cast<uint8_t>(oru16_Crc) ^ pu8_Slice[1];
+         oru16_Crc = static_cast<uint16_t>(rc_Tables.aau16_Crc16[7][u8_First] ^
+                                           rc_Tables.aau16_Crc16[6][u8_Second] ^
+                                           rc_Tables.aau16_Crc16[5][pu8_Slice[2]] ^
+                                           rc_Tables.aau16_Crc16[4][pu8_Slice[3]] ^
+                                           rc_Tables.aau16_Crc16[3][pu8_Slice[4]] ^
+                                           rc_Tables.aau16_Crc16[2][pu8_Slice[5]] ^
+                                           rc_Tables.aau16_Crc16[1][pu8_Slice[6]] ^
+                                           rc_Tables.aau16_Crc16[0][pu8_Slice[7]]);
+      }
+   }
+
+   // byte-by-byte for the rest
 
-   for (uint32_t u32_Index = 0U; u32_Index < ou32_NumBytes; u32_Index++)
+   for (; u32_Index < ou32_NumBytes; u32_Index++)
    {
       const uint8_t u8_Index = static_cast<uint8_t>(oru16_Crc >> 8U) ^ pu8_Data[u32_Index];
       oru16_Crc = static_cast<uint16_t>((static_cast<uint16_t>(oru16_Crc << 8U)) ^ mau16_CRC_TABLE[u8_Index]);
@@ -176,10 +282,36 @@ void C_SclChecksums::CalcCRC16(const void * const opv_Start, const uint32_t ou32
 void C_SclChecksums::CalcCRC32(const void * const opv_Start, const uint32_t ou32_NumBytes, uint32_t & oru32_Crc)
 {
    const uint8_t * const pu8_Data = reinterpret_cast<const uint8_t *>(opv_Start); //lint !e925 we need to parse
+   uint32_t u32_Index = 0U;
+
+   if (ou32_NumBytes >= mu32_SLICE_SIZE)
+   {
+      const T_CrcSliceTables & rc_Tables = m_GetCrcSliceTables();
+
+      // 8 bytes per step; the current CRC is combined with the first four bytes
+      // (assembled byte by byte to stay independent of the endianness of the target)
+      for (; (u32_Index + mu32_SLICE_SIZE) <= ou32_NumBytes; u32_Index += mu32_SLICE_SIZE)
+      {
+         const uint8_t * const pu8_Slice = &pu8_Data[u32_Index];
+         const uint32_t u32_Value = oru32_Crc ^
+                                    (static_cast<uint32_t>(pu8_Slice[0]) |
+                                     (static_cast<uint32_t>(pu8_Slice[1]) << 8U) |
+                                     (static_cast<uint32_t>(pu8_Slice[2]) << 16U) |
+                                     (static_cast<uint32_t>(pu8_Slice[3]) << 24U));
+         oru32_Crc = rc_Tables.aau32_Crc32[7][u32_Value & 0xFFU] ^
+                     rc_Tables.aau32_Crc32[6][(u32_Value >> 8U) & 0xFFU] ^
+                     rc_Tables.aau32_Crc32[5][(u32_Value >> 16U) & 0xFFU] ^
+                     rc_Tables.aau32_Crc32[4][u32_Value >> 24U] ^
+                     rc_Tables.aau32_Crc32[3][pu8_Slice[4]] ^
+                     rc_Tables.aau32_Crc32[2][pu8_Slice[5]] ^
+                     rc_Tables.aau32_Crc32[1][pu8_Slice[6]] ^
+                     rc_Tables.aau32_Crc32[0][pu8_Slice[7]];
+      }
+   }
 
-   // byte-by-byte
+   // byte-by-byte for the rest
 
-   for (uint32_t u32_Index = 0U; u32_Index < ou32_NumBytes; u32_Index++)
+   for (; u32_Index < ou32_NumBytes; u32_Index++)
    {
       oru32_Crc = (mau32_CRC_TABLE[((oru32_Crc) ^ (pu8_Data[u32_Index])) & 0xFFU] ^ ((oru32_Crc) >> 8U));
    }
@@ -104,24 +104,9 @@ int32_t C_OscSecurityPem::LoadFromFile(const std::string & orc_FileName, std::st
 
    if (TglFileExists(orc_FileName.c_str()))
    {
-      stw::scl::C_SclString c_FileContent;
-      C_OscUtils::h_FileToString(orc_FileName.c_str(), c_FileContent);
-      {
-         const std::string c_PemFileContent(c_FileContent.c_str());
-
-         std::vector<uint8_t> c_BufferFile;
-         c_BufferFile.resize(c_PemFileContent.size());
-         memcpy(&c_BufferFile[0], c_PemFileContent.data(), c_PemFileContent.size());
-         s32_Retval = this->m_ReadPublicKey(c_BufferFile, orc_ErrorMessage);
-         if (s32_Retval == C_NO_ERR)
-         {
-            s32_Retval = this->m_ReadMetaInfos(c_BufferFile, orc_ErrorMessage);
-         }
-         if (s32_Retval == C_NO_ERR)
-         {
-            s32_Retval = this->m_ReadPrivateKey(c_BufferFile, orc_ErrorMessage);
-         }
-      }
+      std::vector<uint8_t> c_BufferFile;
+      C_OscSecurityPem::h_ReadFileContent(orc_FileName, c_BufferFile);
+      s32_Retval = this->LoadFromContent(c_BufferFile, orc_ErrorMessage);
    }
    else
    {
@@ -131,6 +116,61 @@ int32_t C_OscSecurityPem::LoadFromFile(const std::string & orc_FileName, std::st
    return s32_Retval;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Load from already read file content
+
+   \param[in]      orc_FileContent     Content of PEM file (see h_ReadFileContent)
+   \param[in,out]  orc_ErrorMessage    Error message (does not include file name)
+
+   \return
+   STW error codes
+
+   \retval   C_NO_ERR   Information extracted
+   \retval   C_CONFIG   Invalid file content
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscSecurityPem::LoadFromContent(const std::vector<uint8_t> & orc_FileContent,
+                                          std::string & orc_ErrorMessage)
+{
+   int32_t s32_Retval;
+
+   this->Clear();
+
+   s32_Retval = this->m_ReadPublicKey(orc_FileContent, orc_ErrorMessage);
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = this->m_ReadMetaInfos(orc_FileContent, orc_ErrorMessage);
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = this->m_ReadPrivateKey(orc_FileContent, orc_ErrorMessage);
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Read content of PEM file
+
+   \param[in]   orc_FileName      File name
+   \param[out]  orc_FileContent   File content (empty if file could not be read)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscSecurityPem::h_ReadFileContent(const std::string & orc_FileName, std::vector<uint8_t> & orc_FileContent)
+{
+   stw::scl::C_SclString c_FileContent;
+
+   C_OscUtils::h_FileToString(orc_FileName.c_str(), c_FileContent);
+   {
+      const std::string c_PemFileContent(c_FileContent.c_str());
+
+      orc_FileContent.resize(c_PemFileContent.size());
+      if (c_PemFileContent.size() > 0UL)
+      {
+         memcpy(&orc_FileContent[0], c_PemFileContent.data(), c_PemFileContent.size());
+      }
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Read modulus and exponent from file
 
@@ -9,6 +9,7 @@
 #define C_OSCSECURITYPEMDATABASE_HPP
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <map>
 #include <string>
 #include <vector>
 
@@ -38,14 +39,37 @@ public:
    int32_t ParseFolder(const std::string & orc_FolderPath);
 
 private:
+   ///Parse result of one PEM file
+   class C_PemFileResult
+   {
+   public:
+      std::vector<uint8_t> c_Content;   ///< file content the result was parsed from
+      int32_t s32_Result;               ///< result of parsing
+      std::string c_ErrorMessage;       ///< error message of parsing
+      C_OscSecurityPemKeyInfo c_KeyInfo; ///< parsed key information
+   };
+
+   ///PEM files to be parsed in parallel
+   class C_PemFileParseJobs
+   {
+   public:
+      const std::map<std::string, C_PemFileResult> * pc_PreviousResults; ///< results of previous folder parsing
+      std::vector<std::string> c_FilePaths;                              ///< path of PEM file per job
+      std::vector<C_PemFileResult> c_Results;                            ///< parse result per job
+   };
+
    bool mq_StoredLevel7PemInformationValid;
    C_OscSecurityPemKeyInfo mc_StoredLevel7PemInformation;
    std::vector<C_OscSecurityPemKeyInfo> mc_StoredPemFiles;
+   std::map<std::vector<uint8_t>, uint32_t> mc_SerialNumberIndex;   ///< serial number to index in mc_StoredPemFiles
+   std::map<std::string, C_PemFileResult> mc_ParsedFiles;            ///< parse results of last folder per file path
 
    int32_t m_TryAddKeyFromPath(const std::string & orc_Path, const bool oq_AddToList);
    int32_t m_TryAddKey(const C_OscSecurityPemKeyInfo & orc_NewKey, std::string & orc_ErrorMessage,
                        const bool oq_AddToList);
    static std::vector<std::string> mh_GetPemFiles(const std::string & orc_FolderPath);
+   static void mh_ParsePemFiles(C_PemFileParseJobs & orc_Jobs);
+   static void mh_ParsePemFileJob(void * const opv_Jobs, const uint32_t ou32_Job);
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
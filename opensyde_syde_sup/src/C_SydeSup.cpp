@@ -59,6 +59,7 @@ C_SydeSup::C_SydeSup(void) :
    mpc_EthDispatcher(NULL),
    mq_Quiet(false),
    mq_OnlyNecessaryFiles(false),
+   mq_ContinueOnError(false),
    me_OperationMode(eMODE_UPDATE),
    mc_OperationMode(""),
    mc_SupFilePath(""),
@@ -144,6 +145,9 @@ C_SydeSup::E_Result C_SydeSup::ParseCommandLine(const int32_t os32_Argc, char_t
       {
          "necessaryfiles",    no_argument,         NULL,    'n'
       },
+      {
+         "continueonerror",   no_argument,         NULL,    'k'
+      },
       {
          "operationmode",     required_argument,   NULL,    'o'
       },
@@ -179,7 +183,7 @@ C_SydeSup::E_Result C_SydeSup::ParseCommandLine(const int32_t os32_Argc, char_t
    do
    {
       int32_t s32_Index;
-      s32_Result = getopt_long(os32_Argc, oppcn_Argv, "hmvqnp:o:i:z:l:c:s:w:d:", &ac_Options[0], &s32_Index);
+      s32_Result = getopt_long(os32_Argc, oppcn_Argv, "hmvqnkp:o:i:z:l:c:s:w:d:", &ac_Options[0], &s32_Index);
       if (s32_Result != -1)
       {
          switch (s32_Result)
@@ -200,6 +204,9 @@ C_SydeSup::E_Result C_SydeSup::ParseCommandLine(const int32_t os32_Argc, char_t
          case 'n':
             mq_OnlyNecessaryFiles = true;
             break;
+         case 'k':
+            mq_ContinueOnError = true;
+            break;
          case 'o':
             mc_OperationMode = optarg;
             break;
@@ -391,6 +398,7 @@ C_SydeSup::E_Result C_SydeSup::SelectModeAndStart(void)
    eERR_UPDATE_C_NOACT
    eERR_UPDATE_C_COM
    eERR_UPDATE_SYSDEF
+   eERR_UPDATE_NODES_FAILED
 
    //results from c_Sequence.ResetSystem
    eERR_RESET_C_COM
@@ -546,6 +554,7 @@ C_SydeSup::E_Result C_SydeSup::Update(void)
          // initialize sequence
          s32_Return = c_Sequence.Init(c_SystemDefinition, u32_ActiveBusIndex, c_ActiveNodes, mpc_CanDispatcher,
                                       mpc_EthDispatcher, &this->mc_PemDatabase);
+         c_Sequence.SetParallelUpdateIpDispatchers(mc_ParallelUpdateEthDispatchers);
          // tell report methods to not print to console
          c_Sequence.SetQuiet(mq_Quiet);
       }
@@ -653,6 +662,11 @@ C_SydeSup::E_Result C_SydeSup::Update(void)
       case C_CHECKSUM:
          e_Result = eERR_UPDATE_AUTHENTICATION;
          break;
+      case C_UNKNOWN_ERR:
+         // only reported in continue on error mode
+         e_Result = eERR_UPDATE_NODES_FAILED;
+         q_ResetSystem = true;
+         break;
       default:
          e_Result = eERR_UNKNOWN;
          break;
@@ -857,6 +871,8 @@ void C_SydeSup::m_PrintInformation(const bool oq_Detailed) const
       "-n     --necessaryfiles    Only transfer files if necessary.                               -n\n"
       "                           Files already on address based target will \n"
       "                           be skipped.            \n"
+      "-k     --continueonerror   Continue with the next node if the update of                    -k\n"
+      "                           one node fails.\n"
       "-p     --packagefile       Path to Service Update Package file             <none>          -p ." <<
       c_PathDelimiter.c_str() << "MyPackage.syde_sup\n"
       "-i     --caninterface      CAN interface                                   <none>          " <<
@@ -1107,6 +1123,10 @@ void C_SydeSup::m_PrintStringFromError(const E_Result & ore_Result) const
       c_Activity = "Load Certificates";
       c_Error = "Could not load certificates (PEM files) at path \"" + this->mc_CertFolderPath + "\"";
       break;
+   case eERR_UPDATE_NODES_FAILED: //C_UNKNOWN_ERR
+      c_Activity = "Update System";
+      c_Error = "Update failed for at least one node. The remaining nodes were updated. See log for details.";
+      break;
    case eERR_UPDATE_AUTHENTICATION:
       c_Activity = "Update System";
       c_Error = "Authentication between sydesup and device(s) has failed. Access denied."
@@ -1449,7 +1469,7 @@ int32_t C_SydeSup::m_UpdateSystem(C_SupSuSequences & orc_Sequence, const C_OscSy
 
    if ((s32_Result == C_NO_ERR) || (s32_Result == C_WARN))
    {
-      s32_Result = orc_Sequence.UpdateSystem(orc_ApplicationsToWrite, orc_NodesUpdateOrder);
+      s32_Result = orc_Sequence.UpdateSystem(orc_ApplicationsToWrite, orc_NodesUpdateOrder, !mq_ContinueOnError);
    }
    return s32_Result;
 }
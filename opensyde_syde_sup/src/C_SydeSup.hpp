@@ -69,6 +69,7 @@ public:
       eERR_ACTIVATE_FLASHLOADER_C_COM  = 52,
       eERR_ACTIVATE_FLASHLOADER_SYSDEF = 53,
 
+      eERR_UPDATE_NODES_FAILED         = 59,
       eERR_UPDATE_ABORTED              = 60,
       eERR_UPDATE_C_OVERFLOW           = 61,
       eERR_UPDATE_C_RD_RW              = 62,
@@ -109,8 +110,11 @@ protected:
 
    stw::can::C_Can * mpc_CanDispatcher;
    stw::opensyde_core::C_OscIpDispatcher * mpc_EthDispatcher;
+   ///additional Ethernet dispatchers for updating independent nodes in parallel (optional)
+   std::vector<stw::opensyde_core::C_OscIpDispatcher *> mc_ParallelUpdateEthDispatchers;
    bool mq_Quiet;
    bool mq_OnlyNecessaryFiles;
+   bool mq_ContinueOnError;
    E_OperationMode me_OperationMode;
    stw::scl::C_SclString mc_OperationMode;
    stw::scl::C_SclString mc_SupFilePath;
@@ -125,6 +129,8 @@ protected:
 
    C_SydeSup::E_Result m_InitOptionalParameters(void);
 
+   static const uint32_t mhu32_NUM_PARALLEL_UPDATE_WORKERS = 4U; ///< maximum number of nodes updated in parallel
+
 private:
    // Update system with service update package
    virtual void m_CloseCan(void) = 0;
@@ -298,6 +298,7 @@ void C_SydeSupLinux::m_CloseCan(void)
    * initialize a specific implementation of C_OSCIpDispatcher
    * do whatever is required to set that dispatcher up (nothing in most cases)
    * set mpc_EthDispatcher to point to that dispatcher
+   * set mc_ParallelUpdateEthDispatchers to point to further instances for updating nodes in parallel (optional)
 
    \return  error code
    eOK                        driver initialized
@@ -307,6 +308,11 @@ void C_SydeSupLinux::m_CloseCan(void)
 C_SydeSup::E_Result C_SydeSupLinux::m_OpenEthernet(void)
 {
    mpc_EthDispatcher = &mc_EthDispatcher;
+   mc_ParallelUpdateEthDispatchers.clear();
+   for (uint32_t u32_Worker = 0U; u32_Worker < mhu32_NUM_PARALLEL_UPDATE_WORKERS; ++u32_Worker)
+   {
+      mc_ParallelUpdateEthDispatchers.push_back(&mac_ParallelUpdateEthDispatchers[u32_Worker]);
+   }
    return eOK;
 }
 
@@ -41,6 +41,7 @@ private:
    bool mq_CanDllLoaded;
    stw::can::C_Can mc_CanDispatcher;
    stw::opensyde_core::C_OscIpDispatcherWinSock mc_EthDispatcher;
+   stw::opensyde_core::C_OscIpDispatcherWinSock mac_ParallelUpdateEthDispatchers[mhu32_NUM_PARALLEL_UPDATE_WORKERS];
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
@@ -14,6 +14,7 @@
 
 #include "stwtypes.hpp"
 #include "stwerrors.hpp"
+#include "C_OscLoggingHandler.hpp"
 #include "C_SydeSupLinux.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
@@ -55,5 +56,7 @@ int32_t main(const int32_t os32_Argc, char_t * const oppcn_Argv[])
       e_Return = c_SydeServiceUpdater.SelectModeAndStart();
    }
 
+   stw::opensyde_core::C_OscLoggingHandler::h_Exit();
+
    return static_cast<int32_t>(e_Return);
 }
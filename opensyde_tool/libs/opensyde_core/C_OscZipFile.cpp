@@ -12,6 +12,8 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "precomp_headers.hpp"
 
+#include <cstdio>
+#include <ctime>
 #include <fstream>
 
 #include "TglFile.hpp"
@@ -40,9 +42,49 @@ using namespace std;
 /* -- Module Global Variables --------------------------------------------------------------------------------------- */
 
 /* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+static int32_t m_GetFileLength(std::FILE * const opc_File, uint64_t & oru64_FileLength);
 
 /* -- Implementation ------------------------------------------------------------------------------------------------ */
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get length of open file
+
+   Uses 64bit file positions, so files of 2 GB and more are supported on Windows too.
+   Afterwards the file position is at the start of the file.
+
+   \param[in]   opc_File          open file
+   \param[out]  oru64_FileLength  length of file in bytes
+
+   \return
+   C_NO_ERR    length determined
+   C_RD_WR     could not determine file position
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static int32_t m_GetFileLength(std::FILE * const opc_File, uint64_t & oru64_FileLength)
+{
+   int32_t s32_Return = C_RD_WR;
+   int64_t s64_Position = -1;
+
+#ifdef _WIN32
+   if (_fseeki64(opc_File, 0, SEEK_END) == 0)
+   {
+      s64_Position = _ftelli64(opc_File);
+   }
+#else
+   if (fseeko(opc_File, 0, SEEK_END) == 0)
+   {
+      s64_Position = static_cast<int64_t>(ftello(opc_File));
+   }
+#endif
+   if (s64_Position >= 0)
+   {
+      oru64_FileLength = static_cast<uint64_t>(s64_Position);
+      std::rewind(opc_File);
+      s32_Return = C_NO_ERR;
+   }
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Create ZIP archive from files
 
@@ -57,10 +99,11 @@ using namespace std;
    If the zip file already exists behavior is undefined
    (technically the function will probably add to the existing file but this has not been tested).
 
+   The archive is opened once, all files are streamed into it in chunks and the central directory is
+   written once when finalizing the archive.
+
    Assumptions:
    * consistent data
-   * moderate file sizes to zip
-    (is not zipping files by chunk, with files greater than 0.5 GB there can occur problems)
 
    \param[in]  orc_SourcePath                path of folder containing files to add to archive
                                               (needs trailing path terminator)
@@ -72,8 +115,10 @@ using namespace std;
    \return
    C_NO_ERR    success
    C_CONFIG    at least one input file does not exist
-   C_RD_WR     could not open input file
+   C_RD_WR     could not open input file or determine its size
    C_NOACT     could not add data to zip file (does the path to the file exist ?)
+   In case of C_RD_WR or C_NOACT a partially written zip file is deleted if it was created by this call.
+   An existing archive that was appended to is left as it is.
 */
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_OscZipFile::h_CreateZipFile(const C_SclString & orc_SourcePath, const std::set<C_SclString> & orc_SupFiles,
@@ -102,75 +147,121 @@ int32_t C_OscZipFile::h_CreateZipFile(const C_SclString & orc_SourcePath, const
 
    if (s32_Return == C_NO_ERR)
    {
-      mz_bool x_MzStatus = MZ_TRUE; //lint !e8080  //using type to match library interface
-      // go through all files and store in zip archive
-      for (c_Iter = orc_SupFiles.begin(); (c_Iter != orc_SupFiles.end()) && (x_MzStatus == MZ_TRUE); ++c_Iter)
+      mz_zip_archive c_ZipArchive;
+      mz_bool x_MzStatus; //lint !e8080  //using type to match library interface
+      bool q_ArchiveCreated = false;
+
+      // open the archive once for all files; an existing archive is appended to (as before)
+      (void)memset(&c_ZipArchive, 0, sizeof(c_ZipArchive));
+      if (TglFileExists(orc_ZipArchivePath) == true)
       {
-         C_SclString c_FileName = *c_Iter;
-         const C_SclString c_AbsPath = orc_SourcePath + c_FileName;                  // absolute path
-         ifstream c_FileStream(c_AbsPath.c_str(), ifstream::binary | ifstream::ate); // open file and set pos
-                                                                                     // to the end of file
-         if (c_FileStream.is_open() == true)
+         x_MzStatus = mz_zip_reader_init_file(&c_ZipArchive, orc_ZipArchivePath.c_str(), 0);
+         if (x_MzStatus == MZ_TRUE)
          {
-            C_SclString c_FilePathWithSlashes;
-            // get file length, position is at the end of the input sequence
-            const streampos c_FileLength = c_FileStream.tellg();
-            // set position to the beginning of the input sequence
-            c_FileStream.seekg(0LL, ifstream::beg);
-
-            // allocate memory
-            char_t * const pcn_FileData = new char_t[c_FileLength];
-            const C_SclString c_Comment = "Zipping file: " + c_FileName; // set filename as comment
+            x_MzStatus = mz_zip_writer_init_from_reader(&c_ZipArchive, orc_ZipArchivePath.c_str());
+         }
+      }
+      else
+      {
+         x_MzStatus = mz_zip_writer_init_file(&c_ZipArchive, orc_ZipArchivePath.c_str(), 0U);
+         q_ArchiveCreated = (x_MzStatus == MZ_TRUE);
+      }
+      if (x_MzStatus == MZ_FALSE)
+      {
+         if (opc_ErrorText != NULL)
+         {
+            (*opc_ErrorText) = "Could not create zip file \"" + orc_ZipArchivePath + "\".";
+         }
+         s32_Return = C_NOACT;
+      }
 
-            // read file content
-            c_FileStream.read(pcn_FileData, static_cast<streamsize>(c_FileLength));
+      // go through all files and store in zip archive
+      for (c_Iter = orc_SupFiles.begin(); (c_Iter != orc_SupFiles.end()) && (s32_Return == C_NO_ERR); ++c_Iter)
+      {
+         const C_SclString & rc_FileName = *c_Iter;
+         const C_SclString c_AbsPath = orc_SourcePath + rc_FileName; // absolute path
+         std::FILE * const pc_File = std::fopen(c_AbsPath.c_str(), "rb");
 
-            // close file
-            c_FileStream.close();
+         if (pc_File != NULL)
+         {
+            C_SclString c_FilePathWithSlashes;
+            const C_SclString c_Comment = "Zipping file: " + rc_FileName; // set filename as comment
+            const time_t x_Now = std::time(NULL);                          //lint !e8080 //type of library interface
+            uint64_t u64_FileLength = 0U;
 
             // miniz cannot handle windows '\\' directories
             // therefore change to '/'
-            for (uint32_t u32_Pos = 1U; u32_Pos <= c_FileName.Length(); u32_Pos++)
+            for (uint32_t u32_Pos = 1U; u32_Pos <= rc_FileName.Length(); u32_Pos++)
             {
-               if (c_FileName[u32_Pos] == '\\')
+               if (rc_FileName[u32_Pos] == '\\')
                {
                   c_FilePathWithSlashes += '/';
                }
                else
                {
-                  c_FilePathWithSlashes += c_FileName[u32_Pos];
+                  c_FilePathWithSlashes += rc_FileName[u32_Pos];
                }
             }
 
-            // store file content to zip archive
-            // mz_zip_add_mem_to_archive_file_in_place is creating, appending and always finalizing the archive
-            // after successful operation
-            x_MzStatus = mz_zip_add_mem_to_archive_file_in_place(
-               orc_ZipArchivePath.c_str(), c_FilePathWithSlashes.c_str(),
-               pcn_FileData, static_cast<size_t>(c_FileLength),
-               c_Comment.c_str(), static_cast<uint16_t>(c_Comment.Length()),
-               MZ_BEST_COMPRESSION);
-            if (x_MzStatus == MZ_FALSE)
+            // get file length and go back to the start; the data itself is read and compressed in chunks by miniz
+            if (m_GetFileLength(pc_File, u64_FileLength) == C_NO_ERR)
+            {
+               // stream file content into the open archive;
+               // the central directory is only written once at the end
+               x_MzStatus = mz_zip_writer_add_cfile(&c_ZipArchive, c_FilePathWithSlashes.c_str(), pc_File,
+                                                    u64_FileLength, &x_Now,
+                                                    c_Comment.c_str(), static_cast<uint16_t>(c_Comment.Length()),
+                                                    MZ_BEST_COMPRESSION, NULL, 0U, NULL, 0U);
+               if (x_MzStatus == MZ_FALSE)
+               {
+                  if (opc_ErrorText != NULL)
+                  {
+                     (*opc_ErrorText) = "Could not create zip file \"" + rc_FileName + "\".";
+                  }
+                  s32_Return = C_NOACT;
+               }
+            }
+            else
             {
                if (opc_ErrorText != NULL)
                {
-                  (*opc_ErrorText) = "Could not create zip file \"" + c_FileName + "\".";
+                  (*opc_ErrorText) = "Could not get size of file \"" + rc_FileName + "\" for zipping into archive.";
                }
-               s32_Return = C_NOACT;
+               s32_Return = C_RD_WR;
             }
-
-            // free memory
-            delete[] pcn_FileData;
+            (void)std::fclose(pc_File);
          }
          else
          {
             if (opc_ErrorText != NULL)
             {
-               (*opc_ErrorText) = "Could not open file \"" + c_FileName + "\" for zipping into archive.";
+               (*opc_ErrorText) = "Could not open file \"" + rc_FileName + "\" for zipping into archive.";
             }
             s32_Return = C_RD_WR;
          }
       }
+
+      if (s32_Return == C_NO_ERR)
+      {
+         x_MzStatus = mz_zip_writer_finalize_archive(&c_ZipArchive);
+         if (x_MzStatus == MZ_FALSE)
+         {
+            if (opc_ErrorText != NULL)
+            {
+               (*opc_ErrorText) = "Could not finalize zip file \"" + orc_ZipArchivePath + "\".";
+            }
+            s32_Return = C_NOACT;
+         }
+      }
+
+      // free resources and close the archive file
+      (void)mz_zip_end(&c_ZipArchive);
+
+      // do not leave a partially written archive behind
+      if ((s32_Return != C_NO_ERR) && (q_ArchiveCreated == true))
+      {
+         (void)std::remove(orc_ZipArchivePath.c_str());
+      }
    }
 
    return s32_Return;
@@ -248,79 +339,56 @@ int32_t C_OscZipFile::h_UnpackZipFile(const C_SclString & orc_SourcePath, const
       vector<mz_zip_archive_file_stat>::const_iterator c_Iter;
       for (c_Iter = c_Files.begin(); (c_Iter != c_Files.end()) && (s32_Return == C_NO_ERR); ++c_Iter)
       {
-         //lint -e{8080} //using type expected by the library for compatibility
-         size_t x_UncompFileSize;
-         void * const pv_Data = mz_zip_reader_extract_file_to_heap(&c_ZipArchive, &c_Iter->m_filename[0],
-                                                                   &x_UncompFileSize, 0);
-         if (pv_Data != NULL)
-         {
-            // get complete file path of current file
-            const C_SclString c_CompleteFilePath = TglFileIncludeTrailingDelimiter(orc_TargetUnzipPath) +
-                                                   c_Iter->m_filename;
+         // get complete file path of current file
+         const C_SclString c_CompleteFilePath = TglFileIncludeTrailingDelimiter(orc_TargetUnzipPath) +
+                                                c_Iter->m_filename;
 
-            // check if we have to create a subfolder
-            const C_SclString c_Path = TglExtractFilePath(c_CompleteFilePath);
-            if (TglDirectoryExists(c_Path) == false)
+         // check if we have to create a subfolder
+         const C_SclString c_Path = TglExtractFilePath(c_CompleteFilePath);
+         if (TglDirectoryExists(c_Path) == false)
+         {
+            // create subfolder
+            s32_Return = C_OscUtils::h_CreateFolderRecursively(c_Path);
+            if ((s32_Return != C_NO_ERR) && (opc_ErrorText != NULL))
             {
-               // create subfolder
-               s32_Return = C_OscUtils::h_CreateFolderRecursively(c_Path);
-               if ((s32_Return != C_NO_ERR) && (opc_ErrorText != NULL))
-               {
-                  (*opc_ErrorText) = "Could not create subfolder \"" + c_Path + "\".";
-               }
+               (*opc_ErrorText) = "Could not create subfolder \"" + c_Path + "\".";
             }
-            // is it a file or just the folder itself ?
-            if (c_Iter->m_is_directory == MZ_FALSE)
+         }
+         // is it a file or just the folder itself ?
+         if ((c_Iter->m_is_directory == MZ_FALSE) && (s32_Return == C_NO_ERR))
+         {
+            //it's a file -> more to do
+            // create new empty file
+            std::FILE * const pc_File = std::fopen(c_CompleteFilePath.c_str(), "wb");
+            if (pc_File != NULL)
             {
-               //it's a file -> more to do
-               // create new empty file
-               if (s32_Return == C_NO_ERR)
+               // decompress in chunks directly into the target file; the file is never held in RAM as a whole
+               x_MzStatus = mz_zip_reader_extract_to_cfile(&c_ZipArchive, c_Iter->m_file_index, pc_File, 0U);
+               if (std::fclose(pc_File) != 0)
                {
-                  std::FILE * const pc_File = std::fopen(c_CompleteFilePath.c_str(), "wb");
-                  // write data
-                  if (pc_File != NULL)
-                  {
-                     //lint -e{8080} //using type expected by the library for compatibility
-                     const size_t x_SIZE_OF_ELEMENT = sizeof(char_t);
-                     //lint -e{8080} //using type expected by the library for compatibility
-                     const size_t x_NumOfBytesWritten = std::fwrite(pv_Data, x_SIZE_OF_ELEMENT, x_UncompFileSize,
-                                                                    pc_File);
-                     if (x_NumOfBytesWritten != x_UncompFileSize)
-                     {
-                        // data not written completely
-                        if (opc_ErrorText != NULL)
-                        {
-                           (*opc_ErrorText) = "Could not unpack file \"" +
-                                              c_CompleteFilePath + "\" of zip archive \"" + orc_SourcePath + "\".";
-                        }
-                        s32_Return = C_RD_WR;
-                     }
-                     std::fclose(pc_File);
-                  }
-                  else
+                  x_MzStatus = MZ_FALSE;
+               }
+               if (x_MzStatus == MZ_FALSE)
+               {
+                  if (opc_ErrorText != NULL)
                   {
-                     if (opc_ErrorText != NULL)
-                     {
-                        (*opc_ErrorText) = "Could not create file \"" +
-                                           c_CompleteFilePath + "\" to unpack from zip archive \"" + orc_SourcePath +
-                                           "\".";
-                     }
-                     s32_Return = C_RD_WR;
+                     (*opc_ErrorText) = "Could not unpack file \"" +
+                                        c_CompleteFilePath + "\" of zip archive \"" + orc_SourcePath + "\".";
                   }
+                  s32_Return = C_RD_WR;
                }
             }
-         }
-         else
-         {
-            if (opc_ErrorText != NULL)
+            else
             {
-               (*opc_ErrorText) = static_cast<C_SclString>("Could not read file \"") +
-                                  c_Iter->m_filename + "\" from zip archive \"" + orc_SourcePath + "\".";
+               if (opc_ErrorText != NULL)
+               {
+                  (*opc_ErrorText) = "Could not create file \"" +
+                                     c_CompleteFilePath + "\" to unpack from zip archive \"" + orc_SourcePath +
+                                     "\".";
+               }
+               s32_Return = C_RD_WR;
             }
-            s32_Return = C_RD_WR;
          }
-         // we're done, get next file content in case of no error
-         mz_free(pv_Data);
       }
    }
    // Close the archive, freeing any resources it was using
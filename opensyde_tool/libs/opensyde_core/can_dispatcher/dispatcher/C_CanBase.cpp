@@ -48,6 +48,7 @@ void C_CanBase::m_InitClassBase(void)
    mu8_CANOpened = 0U;
    mu8_CommChannel = 0U;
    mq_XTDAvailable = false;
+   mq_FDAvailable = false;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -86,6 +87,13 @@ bool C_CanBase::GetXTDAvailable(void) const
 
 //----------------------------------------------------------------------------------------------------------------------
 
+bool C_CanBase::GetFDAvailable(void) const
+{
+   return mq_FDAvailable;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 uint8_t C_CanBase::GetCommChannel(void) const
 {
    return mu8_CommChannel;
@@ -35,6 +35,7 @@ protected:
    uint8_t mu8_CANOpened;
    uint8_t mu8_CommChannel;
    bool mq_XTDAvailable;
+   bool mq_FDAvailable;
 
 public:
    C_CanBase(void);
@@ -150,6 +151,7 @@ public:
    uint8_t GetCommChannel(void) const;
 
    bool GetXTDAvailable(void) const;
+   bool GetFDAvailable(void) const;
 };
 
 /* -- Global Variables ---------------------------------------------------------------------------------------------- */
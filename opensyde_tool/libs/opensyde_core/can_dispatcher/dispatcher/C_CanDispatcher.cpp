@@ -114,46 +114,55 @@ bool C_CanRxFilter::DoesMessagePass(const T_STWCAN_Msg_RX & orc_Message) const
    Init instance.
 */
 //----------------------------------------------------------------------------------------------------------------------
-C_CanRxQueue::C_CanRxQueue(void)
+C_CanRxQueue::C_CanRxQueue(void) :
+   mu32_IndexMask(0U),
+   mu32_MaxSize(0U),
+   mc_WriteIndex(0U),
+   mu32_ProducerCachedReadIndex(0U),
+   mc_NumOverflows(0U),
+   mc_Status(C_NO_ERR),
+   mc_ReadIndex(0U),
+   mu32_ConsumerCachedWriteIndex(0U)
 {
    //set a default that should be fine for many application cases:
-   mu32_MaxSize = mu32_CAN_QUEUE_DEFAULT_MAX_SIZE;
-   ms32_Status = C_NO_ERR;
+   this->SetMaxSize(mu32_CAN_QUEUE_DEFAULT_MAX_SIZE);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   add element to queue
 
    Add one more element to queue.
+   Must only be called by the producer.
 
    \param[in]   orc_Message   message to add
 
    \return
    C_NO_ERR    element added                                 \n
-   C_OVERFLOW  maximum configured size reached -> not added  \n
-   C_NOACT     could not add new element -> not added
+   C_OVERFLOW  maximum configured size reached -> not added
 */
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_CanRxQueue::Push(const T_STWCAN_Msg_RX & orc_Message)
 {
    int32_t s32_Return = C_NO_ERR;
+   const uint32_t u32_WriteIndex = mc_WriteIndex.load(std::memory_order_relaxed);
 
-   if (mc_Messages.size() >= mu32_MaxSize)
+   //only look at the consumer's index if our cached copy says we are full (saves cache line transfers)
+   if ((u32_WriteIndex - mu32_ProducerCachedReadIndex) >= mu32_MaxSize)
+   {
+      mu32_ProducerCachedReadIndex = mc_ReadIndex.load(std::memory_order_acquire);
+   }
+
+   if ((u32_WriteIndex - mu32_ProducerCachedReadIndex) >= mu32_MaxSize)
    {
       s32_Return = C_OVERFLOW;
+      mc_NumOverflows.fetch_add(1U, std::memory_order_relaxed);
+      mc_Status.store(C_OVERFLOW, std::memory_order_relaxed);
    }
    else
    {
-      try
-      {
-         mc_Messages.push_back(orc_Message);
-      }
-      catch (...)
-      {
-         s32_Return = C_NOACT; //probably out of memory
-      }
+      mc_Messages[u32_WriteIndex & mu32_IndexMask] = orc_Message;
+      mc_WriteIndex.store(u32_WriteIndex + 1U, std::memory_order_release);
    }
-   ms32_Status = s32_Return;
    return s32_Return;
 }
 
@@ -161,6 +170,7 @@ int32_t C_CanRxQueue::Push(const T_STWCAN_Msg_RX & orc_Message)
 /*! \brief   get oldest element from queue
 
    Get oldest element from queue.
+   Must only be called by the consumer.
 
    \param[out]   orc_Message   read message
 
@@ -171,36 +181,78 @@ int32_t C_CanRxQueue::Push(const T_STWCAN_Msg_RX & orc_Message)
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_CanRxQueue::Pop(T_STWCAN_Msg_RX & orc_Message)
 {
-   int32_t s32_Return = C_NO_ERR;
+   return (this->PopMany(&orc_Message, 1U) == 1U) ? C_NO_ERR : C_NOACT;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   get multiple elements from queue
+
+   Get up to ou32_MaxMessages oldest elements from queue in one go.
+   Must only be called by the consumer.
+
+   \param[out]  opc_Messages       buffer for read messages (at least ou32_MaxMessages entries)
+   \param[in]   ou32_MaxMessages   maximum number of messages to read
 
-   if (mc_Messages.size() < 1U)
+   \return
+   number of messages placed in opc_Messages (0 = queue was empty)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_CanRxQueue::PopMany(T_STWCAN_Msg_RX * const opc_Messages, const uint32_t ou32_MaxMessages)
+{
+   const uint32_t u32_ReadIndex = mc_ReadIndex.load(std::memory_order_relaxed);
+   uint32_t u32_NumAvailable = mu32_ConsumerCachedWriteIndex - u32_ReadIndex;
+
+   //only look at the producer's index if our cached copy does not provide enough elements
+   if (u32_NumAvailable < ou32_MaxMessages)
    {
-      s32_Return = C_NOACT;
+      mu32_ConsumerCachedWriteIndex = mc_WriteIndex.load(std::memory_order_acquire);
+      u32_NumAvailable = mu32_ConsumerCachedWriteIndex - u32_ReadIndex;
    }
-   else
+
+   if (u32_NumAvailable > ou32_MaxMessages)
    {
-      orc_Message = mc_Messages.front(); //get element from queue
-      mc_Messages.pop_front();           //delete element from queue
+      u32_NumAvailable = ou32_MaxMessages;
    }
-   return s32_Return;
+   for (uint32_t u32_Message = 0U; u32_Message < u32_NumAvailable; u32_Message++)
+   {
+      opc_Messages[u32_Message] = mc_Messages[(u32_ReadIndex + u32_Message) & mu32_IndexMask];
+   }
+   if (u32_NumAvailable > 0U)
+   {
+      mc_ReadIndex.store(u32_ReadIndex + u32_NumAvailable, std::memory_order_release);
+   }
+   return u32_NumAvailable;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Set maximum queue size
 
    Set the maximum possible number of queue entries.
-   If the queue already contains more entries than the new maximum value it is downsized.
+   The storage is (re-)allocated here so no allocations are necessary while receiving.
+   All entries currently in the queue are discarded.
+
+   Not thread safe: must only be called while neither producer nor consumer are accessing the queue.
 
    \param[in]   ou32_MaxSize  maximum number of entries in queue
 */
 //----------------------------------------------------------------------------------------------------------------------
 void C_CanRxQueue::SetMaxSize(const uint32_t ou32_MaxSize)
 {
-   mu32_MaxSize = ou32_MaxSize;
-   if (mc_Messages.size() > mu32_MaxSize)
+   uint32_t u32_Capacity = 1U;
+
+   //ring storage size must be a power of two so we can use a mask to wrap the free-running indexes
+   while ((u32_Capacity < ou32_MaxSize) && (u32_Capacity < 0x80000000UL))
    {
-      mc_Messages.resize(mu32_MaxSize);
+      u32_Capacity <<= 1U;
    }
+   mu32_MaxSize = (ou32_MaxSize > u32_Capacity) ? u32_Capacity : ou32_MaxSize;
+   mu32_IndexMask = u32_Capacity - 1U;
+   mc_Messages.resize(u32_Capacity);
+
+   mc_WriteIndex.store(0U);
+   mc_ReadIndex.store(0U);
+   mu32_ProducerCachedReadIndex = 0U;
+   mu32_ConsumerCachedWriteIndex = 0U;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -221,6 +273,7 @@ uint32_t C_CanRxQueue::GetMaxSize(void) const
 /*! \brief   Get actual queue size
 
    Get the actual queue size (i.e. number of entries in the queue).
+   If called while producer or consumer are active the result is only a snapshot.
 
    \return
    Actual queue size
@@ -228,18 +281,22 @@ uint32_t C_CanRxQueue::GetMaxSize(void) const
 //----------------------------------------------------------------------------------------------------------------------
 uint32_t C_CanRxQueue::GetSize(void) const
 {
-   return static_cast<uint32_t>(mc_Messages.size());
+   const uint32_t u32_ReadIndex = mc_ReadIndex.load(std::memory_order_acquire);
+
+   return mc_WriteIndex.load(std::memory_order_acquire) - u32_ReadIndex;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Clear all queue entries
 
    Clear all queue entries.
+   Must only be called by the consumer.
 */
 //----------------------------------------------------------------------------------------------------------------------
 void C_CanRxQueue::Clear(void)
 {
-   mc_Messages.clear();
+   mu32_ConsumerCachedWriteIndex = mc_WriteIndex.load(std::memory_order_acquire);
+   mc_ReadIndex.store(mu32_ConsumerCachedWriteIndex, std::memory_order_release);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -247,19 +304,42 @@ void C_CanRxQueue::Clear(void)
 
    Read queue status.
    Will reset status to C_NO_ERR.
+   Must only be called by the consumer.
 
    \return
    C_NO_ERR   -> no problems          \n
-   C_OVERFLOW -> overflow in queue    \n
-   C_NOACT    -> internal problem (e.g. out of memory)
+   C_OVERFLOW -> overflow in queue since last call
 */
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_CanRxQueue::GetStatus(void)
 {
-   const int32_t s32_Return = ms32_Status;
+   return mc_Status.exchange(C_NO_ERR, std::memory_order_relaxed);
+}
 
-   ms32_Status = C_NO_ERR;
-   return s32_Return;
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of overflows
+
+   Get the number of messages that were dropped because the queue was full.
+   The counter is never reset for the lifetime of the queue (wraps around at 2^32).
+
+   \return
+   Number of dropped messages
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_CanRxQueue::GetOverflowCount(void) const
+{
+   return mc_NumOverflows.load(std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   constructor
+
+   Init instance.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CanDispatchClient::C_CanDispatchClient(void) :
+   u16_Handle(0U)
+{
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -269,7 +349,9 @@ int32_t C_CanRxQueue::GetStatus(void)
 */
 //----------------------------------------------------------------------------------------------------------------------
 C_CanDispatcher::C_CanDispatcher(void) :
-   C_CanBase()
+   C_CanBase(),
+   mpc_ClientsByHandle(NULL),
+   mu32_NumTableReaders(0U)
 {
    //nothing to do yet
 }
@@ -283,7 +365,9 @@ C_CanDispatcher::C_CanDispatcher(void) :
 */
 //----------------------------------------------------------------------------------------------------------------------
 C_CanDispatcher::C_CanDispatcher(const uint8_t ou8_CommChannel) :
-   C_CanBase(ou8_CommChannel)
+   C_CanBase(ou8_CommChannel),
+   mpc_ClientsByHandle(NULL),
+   mu32_NumTableReaders(0U)
 {
    //nothing to do yet
 }
@@ -296,8 +380,11 @@ C_CanDispatcher::C_CanDispatcher(const uint8_t ou8_CommChannel) :
 //----------------------------------------------------------------------------------------------------------------------
 C_CanDispatcher::~C_CanDispatcher(void)
 {
-   //nothing more than base class destrcutor to do yet ...
-   //RX-queue will clean up itself
+   for (int32_t s32_Index = 0; s32_Index < mc_InstalledClients.GetLength(); s32_Index++)
+   {
+      delete mc_InstalledClients[s32_Index];
+   }
+   m_DeleteClientTables();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -315,26 +402,28 @@ C_CanDispatcher::~C_CanDispatcher(void)
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_CanDispatcher::DispatchIncoming(void)
 {
-   T_STWCAN_Msg_RX t_Msg;
+   T_STWCAN_Msg_RX at_Msgs[mu32_CAN_DISPATCH_BATCH_SIZE];
    int32_t s32_Return = C_NO_ERR;
    int32_t s32_NumMessages = 0;
    int32_t s32_Loop;
 
    while (s32_Return == C_NO_ERR)
    {
-      // Need to lock the read of the message too, because of the order of pushing the messages in the queue
+      uint32_t u32_NumRead = 0U;
+
+      // Need to lock the read of the messages too, because of the order of pushing the messages in the queue
       // by at least two threads is not guaranteed if only the push is locked.
       // An older message could be pushed into the queue after a newer message.
       mc_CriticalSection.Acquire();
-      s32_Return = m_CAN_Read_Msg(t_Msg);
-      if (s32_Return == C_NO_ERR)
+      s32_Return = m_CAN_Read_Msgs(&at_Msgs[0], mu32_CAN_DISPATCH_BATCH_SIZE, u32_NumRead);
+      for (uint32_t u32_Msg = 0U; u32_Msg < u32_NumRead; u32_Msg++)
       {
          s32_NumMessages++;
          for (s32_Loop = 0; s32_Loop < mc_InstalledClients.GetLength(); s32_Loop++)
          {
-            if (mc_InstalledClients[s32_Loop].c_RXFilter.DoesMessagePass(t_Msg) == true)
+            if (mc_InstalledClients[s32_Loop]->c_RXFilter.DoesMessagePass(at_Msgs[u32_Msg]) == true)
             {
-               (void)mc_InstalledClients[s32_Loop].c_RXQueue.Push(t_Msg);
+               (void)mc_InstalledClients[s32_Loop]->c_RXQueue.Push(at_Msgs[u32_Msg]);
             }
          }
       }
@@ -344,6 +433,64 @@ int32_t C_CanDispatcher::DispatchIncoming(void)
    return s32_NumMessages;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read a batch of incoming CAN messages
+
+   Default implementation: read messages one by one with m_CAN_Read_Msg until no more messages are available
+   or the provided buffer is full.
+   Drivers that can fetch multiple messages with one call to the underlying driver (e.g. SocketCAN with recvmmsg)
+   shall override this function to reduce the number of driver calls per message.
+
+   \param[out]  opc_Messages      buffer for read messages (at least ou32_MaxMessages entries)
+   \param[in]   ou32_MaxMessages  maximum number of messages to read
+   \param[out]  oru32_NumRead     number of messages placed in opc_Messages
+
+   \return
+   C_NO_ERR   buffer was filled completely; more messages might be available
+   else       no more messages available (oru32_NumRead messages were read nonetheless) or error
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_CanDispatcher::m_CAN_Read_Msgs(T_STWCAN_Msg_RX * const opc_Messages, const uint32_t ou32_MaxMessages,
+                                         uint32_t & oru32_NumRead)
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   oru32_NumRead = 0U;
+   while ((s32_Return == C_NO_ERR) && (oru32_NumRead < ou32_MaxMessages))
+   {
+      s32_Return = m_CAN_Read_Msg(opc_Messages[oru32_NumRead]);
+      if (s32_Return == C_NO_ERR)
+      {
+         oru32_NumRead++;
+      }
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wait for incoming CAN messages
+
+   Put the calling thread to sleep until the driver has received messages or the timeout expired.
+   Can be overridden by CAN drivers that provide a blocking wait primitive.
+   Default implementation: not supported.
+
+   \param[in]  ou32_TimeoutMs   maximum time to wait in milliseconds
+
+   \return
+   C_NO_ERR   -> messages available to be dispatched     \n
+   C_TIMEOUT  -> no message received within timeout       \n
+   C_NOACT    -> waiting not supported by driver          \n
+   C_CONFIG   -> driver not initialized                   \n
+   C_COM      -> error waiting for messages
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_CanDispatcher::m_CAN_WaitForRx(const uint32_t ou32_TimeoutMs)
+{
+   (void)ou32_TimeoutMs;
+   return C_NOACT;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Register RX client.
 
@@ -367,27 +514,41 @@ int32_t C_CanDispatcher::RegisterClient(uint16_t & oru16_Handle, const C_CanRxFi
 {
    uint16_t u16_Handle;
    bool q_Found = false;
+   C_CanDispatchClient * pc_Client;
+   const C_CanDispatchClientTable * pc_Table;
+   int32_t s32_NumHandles = 0;
 
    if (mc_InstalledClients.GetHigh() >= 0xFFFF)
    {
       return C_OVERFLOW;
    }
 
-   mc_InstalledClients.IncLength(1);
+   //prepare client completely before making it visible to DispatchIncoming:
+   pc_Client = new C_CanDispatchClient();
    if (opc_RXFilter != NULL)
    {
-      mc_InstalledClients[mc_InstalledClients.GetHigh()].c_RXFilter = *opc_RXFilter;
+      pc_Client->c_RXFilter = *opc_RXFilter;
    }
    else
    {
-      mc_InstalledClients[mc_InstalledClients.GetHigh()].c_RXFilter.PassAll();
+      pc_Client->c_RXFilter.PassAll();
+   }
+   pc_Client->c_RXQueue.SetMaxSize(oru32_BufferSize);
+
+   mc_CriticalSection.Acquire();
+   pc_Table = mpc_ClientsByHandle.load();
+   if (pc_Table != NULL)
+   {
+      s32_NumHandles = pc_Table->c_ClientsByHandle.GetLength();
    }
-   mc_InstalledClients[mc_InstalledClients.GetHigh()].c_RXQueue.SetMaxSize(oru32_BufferSize);
+   mc_InstalledClients.IncLength(1);
+   mc_InstalledClients[mc_InstalledClients.GetHigh()] = pc_Client;
 
    //is there a free one ?
-   for (u16_Handle = 0U; u16_Handle < mc_ClientsByHandle.GetLength(); u16_Handle++)
+   for (u16_Handle = 0U; u16_Handle < s32_NumHandles; u16_Handle++)
    {
-      if (mc_ClientsByHandle[u16_Handle] == NULL)
+      //lint -e{613} //table is present if there are handles
+      if (pc_Table->c_ClientsByHandle[u16_Handle] == NULL)
       {
          q_Found = true;
          break;
@@ -397,15 +558,15 @@ int32_t C_CanDispatcher::RegisterClient(uint16_t & oru16_Handle, const C_CanRxFi
    if (q_Found == true)
    {
       //insert here !
-      mc_InstalledClients[mc_InstalledClients.GetHigh()].u16_Handle = u16_Handle;
+      mc_InstalledClients[mc_InstalledClients.GetHigh()]->u16_Handle = u16_Handle;
    }
    else
    {
-      mc_InstalledClients[mc_InstalledClients.GetHigh()].u16_Handle =
-         static_cast<uint16_t>(mc_ClientsByHandle.GetLength());
+      mc_InstalledClients[mc_InstalledClients.GetHigh()]->u16_Handle = static_cast<uint16_t>(s32_NumHandles);
    }
 
    m_ResyncShortcutPointers();
+   mc_CriticalSection.Release();
    oru16_Handle = u16_Handle;
    return C_NO_ERR;
 }
@@ -414,6 +575,7 @@ int32_t C_CanDispatcher::RegisterClient(uint16_t & oru16_Handle, const C_CanRxFi
 /*! \brief   De-register RX client.
 
    Remove client from list of registered clients.
+   The handle must not be used for reading by another thread while or after it is removed.
 
    \param[in]  ou16_Handle   Handle of the client to remove.
 
@@ -425,27 +587,29 @@ int32_t C_CanDispatcher::RegisterClient(uint16_t & oru16_Handle, const C_CanRxFi
 int32_t C_CanDispatcher::RemoveClient(const uint16_t ou16_Handle)
 {
    uint16_t u16_Index;
+   const C_CanDispatchClient * pc_Client;
 
-   if (ou16_Handle >= mc_ClientsByHandle.GetLength())
-   {
-      return C_NOACT;
-   }
-   if (mc_ClientsByHandle[ou16_Handle] == NULL)
+   mc_CriticalSection.Acquire();
+   pc_Client = m_GetClient(ou16_Handle);
+   if (pc_Client == NULL)
    {
       //nothing installed there ...
+      mc_CriticalSection.Release();
       return C_NOACT;
    }
 
    //find it in the list:
    for (u16_Index = 0U; u16_Index < mc_InstalledClients.GetLength(); u16_Index++)
    {
-      if (mc_ClientsByHandle[ou16_Handle] == &mc_InstalledClients[u16_Index])
+      if (pc_Client == mc_InstalledClients[u16_Index])
       {
+         delete mc_InstalledClients[u16_Index];
          mc_InstalledClients.Delete(u16_Index);
          break;
       }
    }
    m_ResyncShortcutPointers();
+   mc_CriticalSection.Release();
    return C_NO_ERR;
 }
 
@@ -456,10 +620,13 @@ void C_CanDispatcher::m_ResyncShortcutPointers(void)
    uint16_t u16_Index;
    uint16_t u16_Handle;
    uint16_t u16_Max;
+   C_CanDispatchClientTable * pc_Table;
 
    if (mc_InstalledClients.GetLength() == 0)
    {
-      mc_ClientsByHandle.SetLength(0);
+      //no client left that could still read from an older table
+      mpc_ClientsByHandle.store(NULL);
+      m_DeleteClientTables();
       return;
    }
 
@@ -467,29 +634,103 @@ void C_CanDispatcher::m_ResyncShortcutPointers(void)
    u16_Max = 0U;
    for (u16_Index = 0U; u16_Index < mc_InstalledClients.GetLength(); u16_Index++)
    {
-      if (mc_InstalledClients[u16_Index].u16_Handle > u16_Max)
+      if (mc_InstalledClients[u16_Index]->u16_Handle > u16_Max)
       {
-         u16_Max = mc_InstalledClients[u16_Index].u16_Handle;
+         u16_Max = mc_InstalledClients[u16_Index]->u16_Handle;
       }
    }
-   mc_ClientsByHandle.SetLength(static_cast<int32_t>(u16_Max) + 1);
+
+   //set up the complete new table before publishing it:
+   pc_Table = new C_CanDispatchClientTable();
+   pc_Table->c_ClientsByHandle.SetLength(static_cast<int32_t>(u16_Max) + 1);
 
    //preset all pointers to zero:
-   for (u16_Handle = 0U; u16_Handle < mc_ClientsByHandle.GetLength(); u16_Handle++)
+   for (u16_Handle = 0U; u16_Handle < pc_Table->c_ClientsByHandle.GetLength(); u16_Handle++)
    {
-      mc_ClientsByHandle[u16_Handle] = NULL;
+      pc_Table->c_ClientsByHandle[u16_Handle] = NULL;
    }
 
    for (u16_Index = 0U; u16_Index < mc_InstalledClients.GetLength(); u16_Index++)
    {
       //find client with this handle
-      u16_Handle = mc_InstalledClients[u16_Index].u16_Handle;
-      if (u16_Handle > mc_ClientsByHandle.GetHigh())
+      u16_Handle = mc_InstalledClients[u16_Index]->u16_Handle;
+      pc_Table->c_ClientsByHandle[u16_Handle] = mc_InstalledClients[u16_Index];
+   }
+
+   mc_ClientTables.IncLength(1);
+   mc_ClientTables[mc_ClientTables.GetHigh()] = pc_Table;
+   mpc_ClientsByHandle.store(pc_Table);
+
+   m_DeleteSupersededClientTables();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Free all published handle tables
+
+   Only call when no client can use a table anymore (no registered clients or destruction).
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CanDispatcher::m_DeleteClientTables(void)
+{
+   for (int32_t s32_Index = 0; s32_Index < mc_ClientTables.GetLength(); s32_Index++)
+   {
+      delete mc_ClientTables[s32_Index];
+   }
+   mc_ClientTables.SetLength(0);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Free all handle tables except the current one if no reader uses them
+
+   Readers register in mu32_NumTableReaders before loading the current table.
+   A reader that registers after the check below is guaranteed to load the current table;
+   so if there is no registered reader no older table can be in use.
+   Otherwise the tables are kept and freed with a later change.
+   Caller must hold mc_CriticalSection.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CanDispatcher::m_DeleteSupersededClientTables(void)
+{
+   if ((mc_ClientTables.GetLength() > 1) && (mu32_NumTableReaders.load() == 0U))
+   {
+      C_CanDispatchClientTable * const pc_Current = mc_ClientTables[mc_ClientTables.GetHigh()];
+
+      for (int32_t s32_Index = 0; s32_Index < mc_ClientTables.GetHigh(); s32_Index++)
       {
-         return; //internal problem
+         delete mc_ClientTables[s32_Index];
       }
-      mc_ClientsByHandle[u16_Handle] = &mc_InstalledClients[u16_Index];
+      mc_ClientTables.SetLength(1);
+      mc_ClientTables[0] = pc_Current;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get client by handle
+
+   Does not lock the dispatcher: the handle table is never modified once published.
+   While looking at the table the caller is counted as reader so the table is not freed
+   (see m_DeleteSupersededClientTables()).
+   The client itself stays valid until its handle is removed by its user.
+
+   \param[in]  ou16_Handle   Handle of the client
+
+   \return
+   Client (NULL if handle is invalid)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CanDispatchClient * C_CanDispatcher::m_GetClient(const uint16_t ou16_Handle) const
+{
+   C_CanDispatchClient * pc_Client = NULL;
+   const C_CanDispatchClientTable * pc_Table;
+
+   (void)mu32_NumTableReaders.fetch_add(1U);
+   pc_Table = mpc_ClientsByHandle.load();
+   if ((pc_Table != NULL) && (ou16_Handle < pc_Table->c_ClientsByHandle.GetLength()))
+   {
+      pc_Client = pc_Table->c_ClientsByHandle[ou16_Handle];
    }
+   (void)mu32_NumTableReaders.fetch_sub(1U);
+   return pc_Client;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -497,6 +738,8 @@ void C_CanDispatcher::m_ResyncShortcutPointers(void)
 
    Pop newest message from queue.
    Will not dispatch incoming messages.
+   Does not lock the dispatcher: the client's queue is a single-producer/single-consumer queue.
+   So for each handle there must only be one thread reading from the queue.
 
    \param[in]  ou16_Handle   Handle of the client
    \param[out] orc_Message   new message
@@ -510,19 +753,47 @@ void C_CanDispatcher::m_ResyncShortcutPointers(void)
 int32_t C_CanDispatcher::ReadFromQueue(const uint16_t ou16_Handle, T_STWCAN_Msg_RX & orc_Message)
 {
    int32_t s32_Return;
+   C_CanDispatchClient * const pc_Client = m_GetClient(ou16_Handle);
 
-   if (ou16_Handle >= mc_ClientsByHandle.GetLength())
+   if (pc_Client == NULL)
    {
       return C_RANGE;
    }
-   if (mc_ClientsByHandle[ou16_Handle] == NULL)
+
+   s32_Return = pc_Client->c_RXQueue.Pop(orc_Message);
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read multiple messages from queue
+
+   Pop up to ou32_MaxMessages oldest messages from queue in one go.
+   Will not dispatch incoming messages.
+   For each handle there must only be one thread reading from the queue (see ReadFromQueue()).
+
+   \param[in]  ou16_Handle        Handle of the client
+   \param[out] opc_Messages       buffer for read messages (at least ou32_MaxMessages entries)
+   \param[in]  ou32_MaxMessages   maximum number of messages to read
+   \param[out] oru32_NumRead      number of messages placed in opc_Messages
+
+   \return
+   C_NO_ERR   -> at least one message read      \n
+   C_RANGE    -> invalid ou16_Handle            \n
+   C_NOACT    -> no new message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_CanDispatcher::ReadFromQueue(const uint16_t ou16_Handle, T_STWCAN_Msg_RX * const opc_Messages,
+                                       const uint32_t ou32_MaxMessages, uint32_t & oru32_NumRead)
+{
+   int32_t s32_Return = C_RANGE;
+   C_CanDispatchClient * const pc_Client = m_GetClient(ou16_Handle);
+
+   oru32_NumRead = 0U;
+   if (pc_Client != NULL)
    {
-      return C_RANGE;
+      oru32_NumRead = pc_Client->c_RXQueue.PopMany(opc_Messages, ou32_MaxMessages);
+      s32_Return = (oru32_NumRead > 0U) ? C_NO_ERR : C_NOACT;
    }
-
-   mc_CriticalSection.Acquire();
-   s32_Return = mc_ClientsByHandle[ou16_Handle]->c_RXQueue.Pop(orc_Message);
-   mc_CriticalSection.Release();
    return s32_Return;
 }
 
@@ -530,6 +801,7 @@ int32_t C_CanDispatcher::ReadFromQueue(const uint16_t ou16_Handle, T_STWCAN_Msg_
 /*! \brief   Clear receive queue
 
    Dump all messages of receive queue
+   Must be called by the thread reading from the queue (see ReadFromQueue()).
 
    \param[in]  ou16_Handle   Handle of the client
 
@@ -541,14 +813,79 @@ int32_t C_CanDispatcher::ReadFromQueue(const uint16_t ou16_Handle, T_STWCAN_Msg_
 int32_t C_CanDispatcher::ClearQueue(const uint16_t ou16_Handle)
 {
    int32_t s32_Return = C_RANGE;
+   C_CanDispatchClient * const pc_Client = m_GetClient(ou16_Handle);
 
-   if ((ou16_Handle < mc_ClientsByHandle.GetLength()) &&
-       (mc_ClientsByHandle[ou16_Handle] != NULL))
+   if (pc_Client != NULL)
    {
       s32_Return = C_NO_ERR;
-      mc_CriticalSection.Acquire();
-      mc_ClientsByHandle[ou16_Handle]->c_RXQueue.Clear();
-      mc_CriticalSection.Release();
+      pc_Client->c_RXQueue.Clear();
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get receive queue status
+
+   Report whether messages were dropped because the client's queue was full.
+   Will reset the status to C_NO_ERR.
+
+   \param[in]  ou16_Handle          Handle of the client
+   \param[out] oru32_NumOverflows   total number of messages dropped for this client since registration
+
+   \return
+   C_NO_ERR   -> no overflow since last call   \n
+   C_OVERFLOW -> overflow since last call      \n
+   C_RANGE    -> invalid ou16_Handle
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_CanDispatcher::GetQueueStatus(const uint16_t ou16_Handle, uint32_t & oru32_NumOverflows)
+{
+   int32_t s32_Return = C_RANGE;
+   C_CanDispatchClient * const pc_Client = m_GetClient(ou16_Handle);
+
+   oru32_NumOverflows = 0U;
+   if (pc_Client != NULL)
+   {
+      oru32_NumOverflows = pc_Client->c_RXQueue.GetOverflowCount();
+      s32_Return = pc_Client->c_RXQueue.GetStatus();
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wait for incoming messages
+
+   Put the calling thread to sleep until messages are available for the client or the timeout expired.
+   Returns immediately if there already are messages in the client's queue.
+   Otherwise waits for the driver to report received messages; those still need to be dispatched by calling
+    DispatchIncoming() (and might not pass the client's filter).
+
+   \param[in]  ou16_Handle      Handle of the client
+   \param[in]  ou32_TimeoutMs   maximum time to wait in milliseconds
+
+   \return
+   C_NO_ERR   -> messages available                      \n
+   C_TIMEOUT  -> no message received within timeout      \n
+   C_NOACT    -> waiting not supported by driver          \n
+   C_RANGE    -> invalid ou16_Handle                      \n
+   else       -> error waiting for messages (see m_CAN_WaitForRx())
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_CanDispatcher::WaitForIncoming(const uint16_t ou16_Handle, const uint32_t ou32_TimeoutMs)
+{
+   int32_t s32_Return = C_RANGE;
+   const C_CanDispatchClient * const pc_Client = m_GetClient(ou16_Handle);
+
+   if (pc_Client != NULL)
+   {
+      if (pc_Client->c_RXQueue.GetSize() > 0U)
+      {
+         s32_Return = C_NO_ERR;
+      }
+      else
+      {
+         s32_Return = this->m_CAN_WaitForRx(ou32_TimeoutMs);
+      }
    }
    return s32_Return;
 }
@@ -595,15 +932,15 @@ int32_t C_CanDispatcher::CAN_Read_Msg(T_STWCAN_Msg_RX & orc_Message)
    if (s32_Return == C_NO_ERR)
    {
       //dispatch to installed clients:
+      mc_CriticalSection.Acquire();
       for (s32_Loop = 0; s32_Loop < mc_InstalledClients.GetLength(); s32_Loop++)
       {
-         if (mc_InstalledClients[s32_Loop].c_RXFilter.DoesMessagePass(orc_Message) == true)
+         if (mc_InstalledClients[s32_Loop]->c_RXFilter.DoesMessagePass(orc_Message) == true)
          {
-            mc_CriticalSection.Acquire();
-            (void)mc_InstalledClients[s32_Loop].c_RXQueue.Push(orc_Message);
-            mc_CriticalSection.Release();
+            (void)mc_InstalledClients[s32_Loop]->c_RXQueue.Push(orc_Message);
          }
       }
+      mc_CriticalSection.Release();
    }
    else
    {
@@ -629,15 +966,16 @@ int32_t C_CanDispatcher::CAN_Read_Msg(T_STWCAN_Msg_RX & orc_Message)
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_CanDispatcher::SetRXFilter(const uint16_t ou16_Handle, const C_CanRxFilter & orc_RXFilter)
 {
-   if (ou16_Handle >= mc_ClientsByHandle.GetLength())
-   {
-      return C_RANGE;
-   }
-   if (mc_ClientsByHandle[ou16_Handle] == NULL)
+   C_CanDispatchClient * const pc_Client = m_GetClient(ou16_Handle);
+
+   if (pc_Client == NULL)
    {
       return C_RANGE;
    }
 
-   mc_ClientsByHandle[ou16_Handle]->c_RXFilter = orc_RXFilter;
+   //filter is evaluated by DispatchIncoming():
+   mc_CriticalSection.Acquire();
+   pc_Client->c_RXFilter = orc_RXFilter;
+   mc_CriticalSection.Release();
    return C_NO_ERR;
 }
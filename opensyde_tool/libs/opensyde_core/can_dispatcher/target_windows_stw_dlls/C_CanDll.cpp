@@ -535,14 +535,25 @@ int32_t C_CanDll::CANext_Bitrate(const uint8_t ou8_Channel, const int32_t os32_B
 int32_t C_CanDll::CANext_Read_Msg(const uint8_t ou8_Channel, T_STWCAN_Msg_RX & orc_Message)
 {
    int32_t s32_Return;
+   T_STWCAN_ClassicMsg_RX t_Message;
 
    if (mpr_CANext_Read_Msg == NULL)
    {
       return C_NOACT;
    }
    EnterCriticalSection(&mt_Lock);
-   s32_Return = (*mpr_CANext_Read_Msg)(ou8_Channel, &orc_Message);
+   s32_Return = (*mpr_CANext_Read_Msg)(ou8_Channel, &t_Message);
    LeaveCriticalSection(&mt_Lock);
+   if (s32_Return == C_NO_ERR)
+   {
+      orc_Message.u32_ID = t_Message.u32_ID;
+      orc_Message.u8_XTD = t_Message.u8_XTD;
+      orc_Message.u8_DLC = t_Message.u8_DLC;
+      orc_Message.u8_RTR = t_Message.u8_RTR;
+      orc_Message.u8_FDF = 0U;
+      (void)memcpy(orc_Message.au8_Data, t_Message.au8_Data, 8U);
+      orc_Message.u64_TimeStamp = t_Message.u64_TimeStamp;
+   }
    return s32_Return;
 }
 
@@ -551,13 +562,21 @@ int32_t C_CanDll::CANext_Read_Msg(const uint8_t ou8_Channel, T_STWCAN_Msg_RX & o
 int32_t C_CanDll::CANext_Send_Msg(const uint8_t ou8_Channel, const T_STWCAN_Msg_TX & orc_Message)
 {
    int32_t s32_Return;
+   T_STWCAN_ClassicMsg_TX t_Message;
 
    if (mpr_CANext_Send_Msg == NULL)
    {
       return C_NOACT;
    }
+   //the DLL interface uses the classic CAN message layout
+   t_Message.u32_ID = orc_Message.u32_ID;
+   t_Message.u8_XTD = orc_Message.u8_XTD;
+   t_Message.u8_DLC = orc_Message.u8_DLC;
+   t_Message.u8_RTR = orc_Message.u8_RTR;
+   t_Message.u8_Align = 0U;
+   (void)memcpy(t_Message.au8_Data, orc_Message.au8_Data, 8U);
    EnterCriticalSection(&mt_Lock);
-   s32_Return = (*mpr_CANext_Send_Msg)(ou8_Channel, &orc_Message);
+   s32_Return = (*mpr_CANext_Send_Msg)(ou8_Channel, &t_Message);
    LeaveCriticalSection(&mt_Lock);
    return s32_Return;
 }
@@ -828,7 +847,7 @@ void C_CanDll::STWCANMSG_to_CANMSGRX(T_STWCAN_Msg_RX & orc_Target, const STW_CAN
    orc_Target.u8_XTD = 0U;
    orc_Target.u8_DLC = orc_Source.length;
    orc_Target.u8_RTR = 0U;
-   orc_Target.u8_Align = 0U;
+   orc_Target.u8_FDF = 0U;
    (void)memcpy(orc_Target.au8_Data, orc_Source.msg, 8U);
    orc_Target.u64_TimeStamp = 0U;
 }
@@ -841,7 +860,7 @@ void C_CanDll::STWCANEXTMSG_to_CANMSGRX(T_STWCAN_Msg_RX & orc_Target, const STW_
    orc_Target.u8_XTD = static_cast<uint8_t>((orc_Source.id & mu32_XTD_ID) >> 31);
    orc_Target.u8_DLC = orc_Source.length;
    orc_Target.u8_RTR = 0U;
-   orc_Target.u8_Align = 0U;
+   orc_Target.u8_FDF = 0U;
    (void)memcpy(orc_Target.au8_Data, orc_Source.msg, 8U);
    orc_Target.u64_TimeStamp = 0U;
 }
@@ -62,9 +62,9 @@ typedef int32_t (WINAPI * PR_CANext_Exit)(const uint8_t ou8_Channel);
 typedef int32_t (WINAPI * PR_CANext_Bitrate)(const uint8_t ou8_Channel,
                                              const int32_t os32_Bitrate);
 typedef int32_t (WINAPI * PR_CANext_Read_Msg)(const uint8_t ou8_Channel,
-                                              T_STWCAN_Msg_RX * const opt_Message);
+                                              T_STWCAN_ClassicMsg_RX * const opt_Message);
 typedef int32_t (WINAPI * PR_CANext_Send_Msg)(const uint8_t ou8_Channel,
-                                              const T_STWCAN_Msg_TX * const opt_Message);
+                                              const T_STWCAN_ClassicMsg_TX * const opt_Message);
 typedef int32_t (WINAPI * PR_CANext_InterfaceSetup)(const uint8_t ou8_Channel);
 typedef int32_t (WINAPI * PR_CANext_Status)(const uint8_t ou8_Channel,
                                             T_STWCAN_Status * const opt_Status);
@@ -21,6 +21,8 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "precomp_headers.hpp"
 
+#include <algorithm>
+
 #include "stwtypes.hpp"
 #include "stwerrors.hpp"
 #include "TglFile.hpp"
@@ -186,6 +188,7 @@ int32_t C_OscDataDealerNvmSafe::NvmSafeCheckCrcs(const C_OscNode & orc_Node) con
    C_CONFIG    no node or diagnostic protocol are known (was this class properly Initialized ?)
                protocol driver reported configuration error (was the protocol driver properly initialized ?)
    C_OVERFLOW  At least one value lies outside of the defined minimum and maximum range. (checked by client side)
+               Too much data to write in one datapool transaction (checked by client side)
    C_BUSY      No changed value found and no additional lists specified (checked by client side)
    C_TIMEOUT   Expected server response not received within timeout
    C_NOACT     Could not send request (e.g. Tx buffer full)
@@ -259,113 +262,117 @@ int32_t C_OscDataDealerNvmSafe::NvmSafeWriteChangedValues(
             if ((pc_DataPool->e_Type == C_OscNodeDataPool::eNVM) ||
                 (pc_DataPool->e_Type == C_OscNodeDataPool::eHALC_NVM))
             {
-               uint32_t u32_ListCounter;
-               uint32_t u32_Elementcounter;
-               uint16_t u16_AccessCount = 0U;
+               std::vector<C_NvmWriteBlock> c_Blocks;
+               bool q_RangeValid = true;
 
-               // Count the changed elements
-               for (u32_ListCounter = 0U; u32_ListCounter < pc_DataPool->c_Lists.size(); ++u32_ListCounter)
+               // Collect the changed elements
+               for (uint32_t u32_ListCounter = 0U; (u32_ListCounter < pc_DataPool->c_Lists.size()) &&
+                    (q_RangeValid == true); ++u32_ListCounter)
                {
-                  for (u32_Elementcounter = 0U;
-                       u32_Elementcounter < pc_DataPool->c_Lists[u32_ListCounter].c_Elements.size();
+                  const C_OscNodeDataPoolList & rc_List = pc_DataPool->c_Lists[u32_ListCounter];
+
+                  c_ElementId.u32_ListIndex = u32_ListCounter;
+
+                  for (uint32_t u32_Elementcounter = 0U; u32_Elementcounter < rc_List.c_Elements.size();
                        ++u32_Elementcounter)
                   {
-                     if (pc_DataPool->c_Lists[u32_ListCounter].c_Elements[u32_Elementcounter].q_NvmValueChanged == true)
-                     {
-                        // Element was changed and must be written.
-                        ++u16_AccessCount;
-                     }
-                  }
-               }
+                     const C_OscNodeDataPoolListElement & rc_Element = rc_List.c_Elements[u32_Elementcounter];
 
-               if (u16_AccessCount > 0U)
-               {
-                  // Prepare the transaction for this datapool
-                  s32_Return = this->mpc_DiagProtocol->NvmWriteStartTransaction(
-                     static_cast<uint8_t>(u32_DataPoolCounter),
-                     u16_AccessCount);
-                  if (s32_Return == C_NO_ERR)
-                  {
-                     // Write the concrete elements
-                     for (u32_ListCounter = 0U; u32_ListCounter < pc_DataPool->c_Lists.size(); ++u32_ListCounter)
+                     // Check range if value was changed
+                     if (rc_Element.q_NvmValueChanged == true)
                      {
-                        C_OscNodeDataPoolList * const pc_List = &pc_DataPool->c_Lists[u32_ListCounter];
-                        C_OscNodeDataPoolListId c_ListId;
-
-                        c_ElementId.u32_ListIndex = u32_ListCounter;
-                        c_ListId = c_ElementId;
-
-                        for (u32_Elementcounter = 0U;
-                             u32_Elementcounter < pc_List->c_Elements.size();
-                             ++u32_Elementcounter)
+                        if (rc_Element.CheckNvmValueRange() == C_NO_ERR)
                         {
-                           C_OscNodeDataPoolListElement * const pc_Element = &pc_List->c_Elements[u32_Elementcounter];
+                           C_NvmWriteBlock c_Block;
 
-                           // Check range if value was changed
-                           if (pc_Element->q_NvmValueChanged == true)
+                           //convert to native endianness depending on the type ...
+                           //no possible problem we did not check for already ...
+                           if (this->mpc_DiagProtocol->GetEndianness() ==
+                               C_OscDiagProtocolBase::mhu8_ENDIANNESS_BIG)
                            {
-                              if (pc_Element->CheckNvmValueRange() == C_NO_ERR)
-                              {
-                                 std::vector<uint8_t> c_ElementData;
-
-                                 //convert to native endianness depending on the type ...
-                                 //no possible problem we did not check for already ...
-                                 if (this->mpc_DiagProtocol->GetEndianness() ==
-                                     C_OscDiagProtocolBase::mhu8_ENDIANNESS_BIG)
-                                 {
-                                    pc_Element->c_NvmValue.GetValueAsBigEndianBlob(c_ElementData);
-                                 }
-                                 else
-                                 {
-                                    pc_Element->c_NvmValue.GetValueAsLittleEndianBlob(c_ElementData);
-                                 }
-
-                                 // Element value was changed and is valid
-                                 s32_Return =
-                                    this->mpc_DiagProtocol->NvmWrite(pc_Element->u32_NvmStartAddress, c_ElementData,
-                                                                     opu8_NrCode);
-                                 // Adapt errorcode
-                                 s32_Return = C_OscDataDealerNvm::mh_AdaptProtocolReturnValue(s32_Return);
-
-                                 if (s32_Return == C_NO_ERR)
-                                 {
-                                    // Element written
-                                    // Return the entire element id
-                                    c_ElementId.u32_ElementIndex = u32_Elementcounter;
-                                    orc_ChangedElements.push_back(c_ElementId);
-
-                                    // Reset the flag
-                                    pc_Element->q_NvmValueChanged = false;
-
-                                    // Save the list index as changed list. Will be used by NvmSafeReadValues.
-                                    this->mc_ChangedLists.insert(c_ListId);
-                                 }
-                              }
-                              else
-                              {
-                                 s32_Return = C_OVERFLOW;
-                              }
+                              rc_Element.c_NvmValue.GetValueAsBigEndianBlob(c_Block.c_Data);
                            }
-
-                           if (s32_Return != C_NO_ERR)
+                           else
                            {
-                              // Service failed. Abort writing.
-                              break;
+                              rc_Element.c_NvmValue.GetValueAsLittleEndianBlob(c_Block.c_Data);
                            }
+                           c_Block.u32_StartAddress = rc_Element.u32_NvmStartAddress;
+                           c_ElementId.u32_ElementIndex = u32_Elementcounter;
+                           c_Block.c_ElementIds.push_back(c_ElementId);
+                           c_Blocks.push_back(c_Block);
                         }
-
-                        if (s32_Return != C_NO_ERR)
+                        else
                         {
-                           // Service failed. Abort writing.
+                           // Do not write anything if any value is invalid
+                           q_RangeValid = false;
                            break;
                         }
                      }
                   }
+               }
+
+               if (q_RangeValid == false)
+               {
+                  s32_Return = C_OVERFLOW;
+               }
+               else if (c_Blocks.size() > 0U)
+               {
+                  uint32_t u32_AccessCount;
+
+                  // Write adjacent elements with one service each
+                  mh_MergeNvmWriteBlocks(c_Blocks);
+                  u32_AccessCount = mh_GetNvmWriteAccessCount(c_Blocks);
+
+                  if (u32_AccessCount > 0xFFFFUL)
+                  {
+                     // Too many accesses for one transaction. Do not write anything.
+                     s32_Return = C_OVERFLOW;
+                  }
                   else
                   {
-                     // Start service failed. Adapt errorcode
+                     // Prepare the transaction for this datapool
+                     s32_Return = this->mpc_DiagProtocol->NvmWriteStartTransaction(
+                        static_cast<uint8_t>(u32_DataPoolCounter),
+                        static_cast<uint16_t>(u32_AccessCount));
+                     // Adapt errorcode
                      s32_Return = C_OscDataDealerNvm::mh_AdaptProtocolReturnValue(s32_Return);
                   }
+                  if (s32_Return == C_NO_ERR)
+                  {
+                     // Write the blocks
+                     for (uint32_t u32_BlockCounter = 0U; u32_BlockCounter < c_Blocks.size(); ++u32_BlockCounter)
+                     {
+                        const C_NvmWriteBlock & rc_Block = c_Blocks[u32_BlockCounter];
+
+                        s32_Return = this->mpc_DiagProtocol->NvmWrite(rc_Block.u32_StartAddress, rc_Block.c_Data,
+                                                                      opu8_NrCode);
+                        // Adapt errorcode
+                        s32_Return = C_OscDataDealerNvm::mh_AdaptProtocolReturnValue(s32_Return);
+
+                        if (s32_Return != C_NO_ERR)
+                        {
+                           // Service failed. Abort writing.
+                           break;
+                        }
+
+                        for (uint32_t u32_ItElement = 0U; u32_ItElement < rc_Block.c_ElementIds.size();
+                             ++u32_ItElement)
+                        {
+                           // Element written
+                           // Return the entire element id
+                           const C_OscNodeDataPoolListElementId & rc_WrittenId = rc_Block.c_ElementIds[u32_ItElement];
+                           const C_OscNodeDataPoolListId c_ListId = rc_WrittenId;
+                           C_OscNodeDataPoolList & rc_WrittenList = pc_DataPool->c_Lists[rc_WrittenId.u32_ListIndex];
+                           orc_ChangedElements.push_back(rc_WrittenId);
+
+                           // Reset the flag
+                           rc_WrittenList.c_Elements[rc_WrittenId.u32_ElementIndex].q_NvmValueChanged = false;
+
+                           // Save the list index as changed list. Will be used by NvmSafeReadValues.
+                           this->mc_ChangedLists.insert(c_ListId);
+                        }
+                     }
+                  }
 
                   if (s32_Return == C_NO_ERR)
                   {
@@ -375,6 +382,10 @@ int32_t C_OscDataDealerNvmSafe::NvmSafeWriteChangedValues(
                      s32_Return = C_OscDataDealerNvm::mh_AdaptProtocolReturnValue(s32_Return);
                   }
                }
+               else
+               {
+                  //nothing to write in this datapool
+               }
 
                //Stop if service failure, continue with C_BUSY (don't stop if no elements found in first datapool)
                if ((s32_Return != C_NO_ERR) && (s32_Return != C_BUSY))
@@ -1330,11 +1341,22 @@ int32_t C_OscDataDealerNvmSafe::NvmSafeWriteParameterSetFile(const C_SclString &
                tgl_assert(pc_Node != NULL);
                if (pc_Node != NULL)
                {
-                  //write the actual values:
+                  std::vector<C_NvmWriteBlock> c_Blocks;
+
+                  //combine adjacent entries to write them with one service each
+                  c_Blocks.resize(pc_Node->c_Entries.size());
                   for (uint32_t u32_ItEntry = 0; u32_ItEntry < pc_Node->c_Entries.size(); u32_ItEntry++)
                   {
-                     const C_OscParamSetRawEntry & rc_Entry = pc_Node->c_Entries[u32_ItEntry];
-                     s32_Retval = this->mpc_DiagProtocol->NvmWrite(rc_Entry.u32_StartAddress, rc_Entry.c_Bytes, NULL);
+                     c_Blocks[u32_ItEntry].u32_StartAddress = pc_Node->c_Entries[u32_ItEntry].u32_StartAddress;
+                     c_Blocks[u32_ItEntry].c_Data = pc_Node->c_Entries[u32_ItEntry].c_Bytes;
+                  }
+                  mh_MergeNvmWriteBlocks(c_Blocks);
+
+                  //write the actual values:
+                  for (uint32_t u32_ItBlock = 0; u32_ItBlock < c_Blocks.size(); u32_ItBlock++)
+                  {
+                     const C_NvmWriteBlock & rc_Block = c_Blocks[u32_ItBlock];
+                     s32_Retval = this->mpc_DiagProtocol->NvmWrite(rc_Block.u32_StartAddress, rc_Block.c_Data, NULL);
                      //Map error codes
                      switch (s32_Retval)
                      {
@@ -1396,6 +1418,88 @@ int32_t C_OscDataDealerNvmSafe::NvmSafeWriteParameterSetFile(const C_SclString &
    return s32_Retval;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Combine adjacent NVM write blocks
+
+   Sorts the blocks by address (keeping the original order of blocks with the same start address) and appends each
+   block to its predecessor if it starts directly after it.
+   Areas that are not directly adjacent stay separate blocks, as the NVM content between them is not known.
+   The protocol driver takes care of splitting blocks exceeding the maximum service size.
+
+   \param[in,out]  orc_Blocks   in: blocks to write (one per element or entry)
+                               out: combined blocks sorted by address
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDataDealerNvmSafe::mh_MergeNvmWriteBlocks(std::vector<C_NvmWriteBlock> & orc_Blocks)
+{
+   std::stable_sort(orc_Blocks.begin(), orc_Blocks.end());
+
+   if (orc_Blocks.size() > 1UL)
+   {
+      uint32_t u32_LastBlock = 0UL;
+      for (uint32_t u32_ItBlock = 1UL; u32_ItBlock < orc_Blocks.size(); ++u32_ItBlock)
+      {
+         C_NvmWriteBlock & rc_LastBlock = orc_Blocks[u32_LastBlock];
+         C_NvmWriteBlock & rc_Block = orc_Blocks[u32_ItBlock];
+         if ((rc_LastBlock.u32_StartAddress + static_cast<uint32_t>(rc_LastBlock.c_Data.size())) ==
+             rc_Block.u32_StartAddress)
+         {
+            rc_LastBlock.c_Data.insert(rc_LastBlock.c_Data.end(), rc_Block.c_Data.begin(), rc_Block.c_Data.end());
+            rc_LastBlock.c_ElementIds.insert(rc_LastBlock.c_ElementIds.end(), rc_Block.c_ElementIds.begin(),
+                                             rc_Block.c_ElementIds.end());
+         }
+         else
+         {
+            ++u32_LastBlock;
+            if (u32_LastBlock != u32_ItBlock)
+            {
+               orc_Blocks[u32_LastBlock] = rc_Block;
+            }
+         }
+      }
+      orc_Blocks.resize(static_cast<size_t>(u32_LastBlock) + 1U);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of NVM write accesses to announce for blocks
+
+   Protocols with secured NVM write transactions (KEFEX) count every write service of up to two bytes
+   and check the announced number at the end of the transaction.
+   So each block counts with the number of two byte services it is written with.
+
+   \param[in]  orc_Blocks   blocks to write
+
+   \return
+   Number of write accesses
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscDataDealerNvmSafe::mh_GetNvmWriteAccessCount(const std::vector<C_NvmWriteBlock> & orc_Blocks)
+{
+   uint32_t u32_Count = 0UL;
+
+   for (uint32_t u32_ItBlock = 0UL; u32_ItBlock < orc_Blocks.size(); ++u32_ItBlock)
+   {
+      u32_Count += (static_cast<uint32_t>(orc_Blocks[u32_ItBlock].c_Data.size()) + 1UL) / 2UL;
+   }
+   return u32_Count;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check if this block starts before the other block
+
+   \param[in]  orc_Cmp  Compared instance
+
+   \return
+   true     Current smaller than orc_Cmp
+   false    Equal or orc_Cmp bigger
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscDataDealerNvmSafe::C_NvmWriteBlock::operator <(const C_NvmWriteBlock & orc_Cmp) const
+{
+   return (this->u32_StartAddress < orc_Cmp.u32_StartAddress);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Create interpreted list
 
@@ -490,6 +490,11 @@ int32_t C_OscIpDispatcherWinSock::m_ConfigureUdpSocket(const bool oq_ServerPort,
       c_UdpService.sin_addr.s_addr = htonl(ou32_IpToBindTo);
       if (oq_ServerPort == true)
       {
+         // Make port 13400 reusable to be able to run more than one dispatcher instance simultaneously
+         // (e.g. the workers of a parallel system update)
+         const char_t cn_REUSE = 'a';
+         (void)setsockopt(orx_Socket, SOL_SOCKET, SO_REUSEADDR, &cn_REUSE, sizeof(cn_REUSE));
+
          c_UdpService.sin_port = htons(mhu16_UDP_TCP_PORT); //provide port
       }
       else
@@ -1105,6 +1110,51 @@ int32_t C_OscIpDispatcherWinSock::ReadTcpBuffer(const uint8_t ou8_ClientBusIdent
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wait for incoming data on TCP socket
+
+   Put the calling thread to sleep until data is available on the TCP socket or the timeout expired.
+
+   \param[in]  ou32_Handle      handle obtained by InitTcp()
+   \param[in]  ou32_TimeoutMs   maximum time to wait in milliseconds
+
+   \return
+   C_NO_ERR   data available (or connection closed by peer; will be reported by ReadTcp())
+   C_TIMEOUT  no data received within timeout
+   C_CONFIG   required socket not initialized
+   C_RANGE    handle invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscIpDispatcherWinSock::WaitForTcpData(const uint32_t ou32_Handle, const uint32_t ou32_TimeoutMs)
+{
+   int32_t s32_Return;
+
+   if (ou32_Handle >= this->mc_SocketsTcp.size())
+   {
+      s32_Return = C_RANGE;
+   }
+   else if (this->mc_SocketsTcp[ou32_Handle].x_Socket == m_WsInvalidSocket())
+   {
+      s32_Return = C_CONFIG;
+   }
+   else
+   {
+      fd_set c_SocketReadSet;
+      timeval c_TimeOut;
+      int x_Return; //lint !e8080 !e970 //using type to match library interface
+
+      c_SocketReadSet.fd_array[0] = this->mc_SocketsTcp[ou32_Handle].x_Socket; //watch this socket ...
+      c_SocketReadSet.fd_count = 1;                                            //only one socket
+      c_TimeOut.tv_sec = static_cast<long>(ou32_TimeoutMs / 1000U);            //lint !e970 !e8080 //library type
+      c_TimeOut.tv_usec = static_cast<long>((ou32_TimeoutMs % 1000U) * 1000U); //lint !e970 !e8080 //library type
+
+      x_Return = select(0, &c_SocketReadSet, NULL, NULL, &c_TimeOut);
+      //on error let the caller check the socket by reading
+      s32_Return = (x_Return == 0) ? C_TIMEOUT : C_NO_ERR;
+   }
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Send broadcast package on UDP request socket
 
@@ -107,6 +107,7 @@ public:
    virtual int32_t ReadTcpBuffer(const uint8_t ou8_ClientBusIdentifier, const uint8_t ou8_ClientNodeIdentifier,
                                  const uint8_t ou8_ServerBusIdentifier, const uint8_t ou8_ServerNodeIdentifier,
                                  std::vector<uint8_t> & orc_Data);
+   virtual int32_t WaitForTcpData(const uint32_t ou32_Handle, const uint32_t ou32_TimeoutMs);
    virtual int32_t SendUdp(const std::vector<uint8_t> & orc_Data);
    virtual int32_t ReadUdp(std::vector<uint8_t> &orc_Data, uint8_t(&orau8_Ip)[4]);
 
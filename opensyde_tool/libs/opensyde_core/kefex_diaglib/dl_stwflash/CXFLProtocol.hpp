@@ -265,7 +265,8 @@ protected:
    int32_t m_CANSendMessage(const stw::can::T_STWCAN_Msg_TX & orc_MSG);
    int32_t m_CANGetResponse(stw::can::T_STWCAN_Msg_RX & orc_MSG);
    int32_t m_WaitForResponse(const uint8_t ou8_ExpectedLocalID, const uint32_t ou32_TimeOutMS,
-                             const uint8_t (&orau8_Match)[8], const uint8_t ou8_NumExpectedToMatch,
+                             const uint8_t (&orau8_Match)[stw::can::STWCAN_FD_MAX_DLC],
+                             const uint8_t ou8_NumExpectedToMatch,
                              stw::can::T_STWCAN_Msg_RX * const opc_MSG, const int16_t os16_CheckDLC = -1);
    int32_t m_GetDeviceIDBlock(const uint8_t ou8_BlockIndex, char_t(&oracn_Data)[4]);
 
@@ -283,8 +284,9 @@ protected:
 
    //Functions affecting timing and multithreading behaviour. Have default implementations suitable for most cases
    // but can be overloaded for special requirements.
-   virtual void TRG_WaitMicroSeconds(const uint32_t ou32_NumUs); //active waiting
-   virtual void TRG_HandleSystemMessages(void);                  //perform operating system message handling
+   virtual void TRG_WaitMicroSeconds(const uint32_t ou32_NumUs);            //waiting (mostly sleeping)
+   virtual void TRG_WaitUntilMicroSeconds(const uint64_t ou64_DeadlineUs); //waiting up to point in time
+   virtual void TRG_HandleSystemMessages(void);                             //perform operating system message handling
 
    static uint8_t mh_BCD2DEC(const uint8_t ou8_BCDValue);
    static uint8_t mh_DEC2BCD(const uint8_t ou8_DECValue);
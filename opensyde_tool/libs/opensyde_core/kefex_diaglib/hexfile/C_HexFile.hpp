@@ -179,6 +179,7 @@ protected:
    static uint32_t mh_GetWord(const char_t * const opcn_String, const uint32_t ou32_Index, uint32_t & oru32_Word);
    static void mh_SetWord(char_t * const opcn_String, const uint32_t ou32_Index, const uint32_t ou32_Data);
 
+   static int32_t mh_FindBlock(const C_HexDataDump & orc_Dump, const uint32_t ou32_Address);
    static int32_t mh_FindPattern(const uint8_t * const opu8_Buffer, const uint8_t * const opu8_Pattern,
                                  const uint32_t ou32_BufSize, const uint16_t ou16_PatternLength);
 };
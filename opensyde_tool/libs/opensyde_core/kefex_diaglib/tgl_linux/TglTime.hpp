@@ -6,6 +6,7 @@
    DiagLib Target Glue Layer module containing time functions:
    - system timestamps
    - active delays
+   - delays up to an absolute deadline (for pacing periodic transmissions)
 
    \copyright   Copyright 2017 Sensor-Technik Wiedemann GmbH. All rights reserved.
 */
@@ -39,6 +40,7 @@ public:
 
 void TglGetDateTimeNow(C_TglDateTime & orc_DateTime);
 void TglDelayUs(const uint32_t ou32_NumberUs);
+void TglDelayUntilUs(const uint64_t ou64_DeadlineUs);
 void TglSleep(const uint32_t ou32_NumberMs);
 uint32_t TglGetTickCount(void);
 uint64_t TglGetTickCountUs(void);
@@ -12,8 +12,11 @@
 #define C_OSCLOGGINGHANDLER_H
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <atomic>
 #include <fstream>
 #include <map>
+#include <string>
+#include <vector>
 #include "C_SclString.hpp"
 #include "TglUtils.hpp"
 #include "TglTime.hpp"
@@ -44,6 +47,37 @@ namespace opensyde_core
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
+///Fixed capacity multi-producer/multi-consumer queue for formatted log entries.
+//Push and Pop are lock-free; Push never blocks and reports a full queue instead.
+class C_OscLoggingQueue
+{
+private:
+   //this class can not be copied:
+   C_OscLoggingQueue(const C_OscLoggingQueue & orc_Source);
+   C_OscLoggingQueue & operator = (const C_OscLoggingQueue & orc_Source);
+
+   class C_Cell
+   {
+   public:
+      C_Cell(void);
+
+      std::atomic<uint32_t> c_Sequence; ///< position the cell is ready for (written resp. read)
+      std::string c_Entry;
+   };
+
+   std::vector<C_Cell> mc_Cells; ///< ring storage; size is a power of two
+   const uint32_t mu32_IndexMask;
+   std::atomic<uint32_t> mc_WriteIndex;
+   std::atomic<uint32_t> mc_ReadIndex;
+
+public:
+   C_OscLoggingQueue(const uint32_t ou32_Capacity);
+
+   bool Push(std::string & orc_Entry);
+   bool Pop(std::string & orc_Entry);
+};
+
+//----------------------------------------------------------------------------------------------------------------------
 ///Handler class for logging operations
 class C_OscLoggingHandler
 {
@@ -54,6 +88,8 @@ public:
    static void h_SetMeasurePerformanceActive(const bool oq_Active);
    static void h_SetCompleteLogFileLocation(const stw::scl::C_SclString & orc_CompleteLogFileLocation);
    static const stw::scl::C_SclString & h_GetCompleteLogFileLocation(void);
+   static void h_SetMaxFileSize(const uint32_t ou32_MaxFileSize);
+   static uint32_t h_GetNumDroppedEntries(void);
 
    //Logging call
    static void h_WriteLogInfo(const stw::scl::C_SclString & orc_Activity, const stw::scl::C_SclString & orc_Message,
@@ -66,10 +102,17 @@ public:
                                      const char_t * const opcn_Class = NULL, const char_t * const opcn_Function = NULL);
 
    static uint16_t h_StartPerformanceTimer(void);
+
+   //Deferring the output of the calling thread (e.g. for jobs running in parallel)
+   static void h_StartCapture(std::vector<std::string> & orc_Entries);
+   static void h_StopCapture(void);
+   static void h_WriteCapturedEntries(const std::vector<std::string> & orc_Entries);
+
    static stw::scl::C_SclString h_StwError(const int32_t os32_Error);
 
    //Utility functions
    static void h_Flush(void);
+   static void h_Exit(void);
    static std::string h_UtilConvertDateTimeToString(const stw::tgl::C_TglDateTime & orc_DateTime);
 
 private:
@@ -81,11 +124,32 @@ private:
    static stw::tgl::C_TglCriticalSection mhc_ConsoleCriticalSection;
    static stw::tgl::C_TglCriticalSection mhc_FileCriticalSection;
    static std::ofstream mhc_File;
+   static uint32_t mhu32_MaxFileSize; ///< 0: no rotation
+   static uint64_t mhu64_FileSize;
+
+   //background writing of the log file (file members above are protected by mhc_FileCriticalSection):
+   static const uint32_t mhu32_QUEUE_CAPACITY;
+   static C_OscLoggingQueue mhc_Queue;
+   static std::atomic<uint32_t> mhc_NumDroppedEntries;
+   static uint32_t mhu32_NumReportedDroppedEntries;
+   static std::atomic<bool> mhc_WriterRunning;
+   static std::atomic<uint32_t> mhc_NumProducers; ///< threads currently handing over an entry (see mh_CloseFile())
+   static std::atomic<bool> mhc_StopWriter;
+   static stw::tgl::C_TglEvent mhc_WriterEvent; ///< signaled when entries were queued or on stop request
+   static stw::tgl::C_TglThread mhc_WriterThread;
+
+   static thread_local std::vector<std::string> * mhpc_CapturedEntries; ///< not NULL: thread captures its entries
 
    static void mh_WriteLog(const stw::scl::C_SclString & orc_Type, const stw::scl::C_SclString & orc_Activity,
                            const stw::scl::C_SclString & orc_Message, const char_t * const opcn_Class = NULL,
                            const char_t * const opcn_Function = NULL);
+   static void mh_OutputEntry(const std::string & orc_Entry);
    static void mh_OpenFile(void);
+   static bool mh_OpenFileStream(void);
+   static void mh_CloseFile(void);
+   static void mh_WriterThread(void * const opv_Instance);
+   static void mh_WriteQueuedEntries(void);
+   static void mh_RotateFile(void);
    //Avoid calling
    C_OscLoggingHandler(void);
    virtual ~C_OscLoggingHandler(void);
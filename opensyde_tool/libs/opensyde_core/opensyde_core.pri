@@ -83,21 +83,22 @@ contains(opensyde_core_skip_modules, opensyde_core_skip_zipping) {
    message("opensyde_core_skip_zipping not detected ... dragging in package")
 
    INCLUDEPATH += \
-               $${PWD}/aes \
                $${PWD}/miniz
 
+   # C_OscAesFile uses the OpenSSL EVP API (libcrypto)
+   # the including project provides the OpenSSL include and library directories
+   LIBS += -lcrypto
+
    SOURCES += \
     $${PWD}/C_OscAesFile.cpp \
     $${PWD}/C_OscZipData.cpp \
     $${PWD}/C_OscZipFile.cpp \
-    $${PWD}/aes/AES.cpp \
     $${PWD}/miniz/miniz.c
 
    HEADERS += \
     $${PWD}/C_OscAesFile.hpp \
     $${PWD}/C_OscZipData.hpp \
     $${PWD}/C_OscZipFile.hpp \
-    $${PWD}/aes/AES.h \
     $${PWD}/miniz/miniz.h
 }
 
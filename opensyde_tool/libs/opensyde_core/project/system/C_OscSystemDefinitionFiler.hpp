@@ -12,6 +12,8 @@
 #define C_OSCSYSTEMDEFINITIONFILER_HPP
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <atomic>
+#include <string>
 #include "stwtypes.hpp"
 #include "C_SclString.hpp"
 #include "C_OscNode.hpp"
@@ -43,7 +45,8 @@ public:
                                              const stw::scl::C_SclString * const opc_ExpectedNodeName = NULL);
    static int32_t h_SaveSystemDefinitionFile(const C_OscSystemDefinition & orc_SystemDefinition,
                                              const stw::scl::C_SclString & orc_Path,
-                                             std::vector<stw::scl::C_SclString> * const opc_CreatedFiles = NULL);
+                                             std::vector<stw::scl::C_SclString> * const opc_CreatedFiles = NULL,
+                                             const std::vector<uint8_t> * const opc_NodesToSave = NULL);
    static int32_t h_LoadNodes(std::vector<C_OscNode> & orc_Nodes, C_OscXmlParserBase & orc_XmlParser,
                               const C_OscDeviceManager & orc_DeviceDefinitions,
                               const stw::scl::C_SclString & orc_BasePath, const bool oq_UseDeviceDefinitions = true,
@@ -54,7 +57,8 @@ public:
    static int32_t h_LoadBuses(std::vector<C_OscSystemBus> & orc_Buses, C_OscXmlParserBase & orc_XmlParser);
    static int32_t h_SaveNodes(const std::vector<C_OscNode> & orc_Nodes, C_OscXmlParserBase & orc_XmlParser,
                               const stw::scl::C_SclString & orc_BasePath,
-                              std::vector<stw::scl::C_SclString> * const opc_CreatedFiles);
+                              std::vector<stw::scl::C_SclString> * const opc_CreatedFiles,
+                              const std::vector<uint8_t> * const opc_NodesToSave = NULL);
    static void h_SaveBuses(const std::vector<C_OscSystemBus> & orc_Buses, C_OscXmlParserBase & orc_XmlParser);
    static int32_t h_LoadSystemDefinition(C_OscSystemDefinition & orc_SystemDefinition,
                                          C_OscXmlParserBase & orc_XmlParser,
@@ -67,7 +71,8 @@ public:
                                          const stw::scl::C_SclString * const opc_ExpectedNodeName = NULL);
    static int32_t h_SaveSystemDefinition(const C_OscSystemDefinition & orc_SystemDefinition,
                                          C_OscXmlParserBase & orc_XmlParser, const stw::scl::C_SclString & orc_BasePath,
-                                         std::vector<stw::scl::C_SclString> * const opc_CreatedFiles);
+                                         std::vector<stw::scl::C_SclString> * const opc_CreatedFiles,
+                                         const std::vector<uint8_t> * const opc_NodesToSave = NULL);
 
    static void h_SplitDeviceType(const stw::scl::C_SclString & orc_CompleteType, stw::scl::C_SclString & orc_MainType,
                                  stw::scl::C_SclString & orc_SubType);
@@ -79,7 +84,22 @@ public:
    static const uint16_t hu16_FILE_VERSION_LATEST = hu16_FILE_VERSION_3;
 
 private:
+   ///Node files to be loaded in parallel
+   class C_NodeFileLoadJobs
+   {
+   public:
+      std::vector<C_OscNode> * pc_Nodes;               ///< nodes to load into (already with final size)
+      bool q_SkipContent;                              ///< flag to skip loading the node content
+      std::vector<uint32_t> c_NodeIndices;             ///< index of node to load per job
+      std::vector<stw::scl::C_SclString> c_FilePaths; ///< path of node file per job
+      std::vector<int32_t> c_Results;                  ///< load result per job
+      std::atomic<uint32_t> c_FirstFailedJob;          ///< index of first failed job (number of jobs if none)
+      std::vector<std::vector<std::string> > c_LogEntries; ///< log output captured per job
+   };
+
    static std::map<uint32_t, stw::scl::C_SclString> mh_MapNodeIndicesToName(const std::vector<C_OscNode> & orc_Nodes);
+   static void mh_LoadNodeFiles(C_NodeFileLoadJobs & orc_Jobs);
+   static void mh_LoadNodeFileJob(void * const opv_Jobs, const uint32_t ou32_Job);
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
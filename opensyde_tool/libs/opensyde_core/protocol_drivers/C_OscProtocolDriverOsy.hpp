@@ -13,6 +13,17 @@
    - call Cycle function of installed transport protocol
    - inbetween calls rescind CPU time to other threads
    - "wait" until we get a response or reach the timeout
+   - inbetween calls put the calling thread to sleep on the transport protocol until data is received
+
+   Data pool read and write services are also available as asynchronous variants:
+   - requests are placed in a queue and the function returns immediately
+   - one request is in flight at any time (the server handles services strictly sequentially)
+   - responses are matched by service ID and data identifier; negative responses to a service ID a synchronous
+     request is also waiting for are assigned in the order the requests were sent
+   - after a timeout or cancellation of the request in flight late responses to it are discarded for
+     mhu32_ASYNC_DISCARD_TIME_MS before the next request is sent
+   - results are reported via callback from HandleAsyncRequests() resp. Cycle()
+   This allows to keep requests for many nodes in flight from one thread (see h_HandleAsyncRequests()).
 
    \copyright   Copyright 2017 Sensor-Technik Wiedemann GmbH. All rights reserved.
 */
@@ -23,6 +34,7 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <vector>
 #include <map>
+#include <deque>
 
 #include "stwtypes.hpp"
 #include "C_OscProtocolSerialNumber.hpp"
@@ -40,13 +52,40 @@ namespace opensyde_core
 
 class C_OscProtocolDriverOsy
 {
+public:
+   ///result report of asynchronous requests (see OsyReadDataPoolDataAsync(), OsyWriteDataPoolDataAsync())
+   typedef void (* PR_OsyServiceFinished)(void * const opv_Instance, const uint32_t ou32_RequestId,
+                                          const int32_t os32_Result, const std::vector<uint8_t> & orc_ReadData,
+                                          const uint8_t ou8_NrCode);
+
 private:
    typedef void (* PR_OsyTunnelCanMessageReceived)(void * const opv_Instance, const uint8_t ou8_CanChannel,
                                                    const stw::can::T_STWCAN_Msg_RX & orc_CanMessage);
    typedef void (* PR_OsyHandleWaitTime)(void * const opv_Instance);
 
+   ///one queued asynchronous service request
+   class C_AsyncRequest
+   {
+   public:
+      C_AsyncRequest(void);
+
+      C_OscProtocolDriverOsyService c_Request; ///< request to send
+      PR_OsyServiceFinished pr_OnFinished;     ///< function to report result to
+      void * pv_Instance;                      ///< instance pointer passed to pr_OnFinished
+      uint32_t u32_RequestId;                  ///< ID reported to caller when queuing the request
+      int32_t s32_Result;                      ///< result (when finished)
+      uint8_t u8_NrCode;                       ///< negative response code (when finished with C_WARN)
+      std::vector<uint8_t> c_ReadData;         ///< read data (when finished)
+   };
+
    stw::tgl::C_TglCriticalSection mc_LockReception; ///< for locking reception handling
 
+   //synchronous polling (all protected by mc_LockReception):
+   bool mq_SyncPollActive;                         ///< true: a synchronous request waits for its response
+   uint8_t mu8_SyncPollServiceId;                  ///< service ID the synchronous request waits for
+   bool mq_SyncResponseReceived;                   ///< true: mc_SyncResponse was received by another thread
+   C_OscProtocolDriverOsyService mc_SyncResponse;  ///< response handed over to the waiting synchronous request
+
    PR_OsyTunnelCanMessageReceived mpr_OnOsyTunnelCanMessageReceived;
    void * mpv_OnAsyncTunnelCanMessageInstance;
    PR_OsyHandleWaitTime mpr_OnOsyWaitTime;
@@ -66,6 +105,19 @@ private:
    std::map<uint8_t, uint8_t> mc_DataPoolMappingClientToServer;
    std::map<uint8_t, uint8_t> mc_DataPoolMappingServerToClient;
 
+   //asynchronous requests:
+   stw::tgl::C_TglCriticalSection mc_LockAsyncRequests;  ///< for locking access to async request queues
+   std::deque<C_AsyncRequest> mc_AsyncRequests;          ///< pending requests; first one is in flight (if flagged)
+   std::deque<C_AsyncRequest> mc_AsyncRequestsFinished;  ///< finished requests waiting to be reported
+   bool mq_AsyncRequestInFlight;                         ///< true: first pending request was sent to server
+   uint32_t mu32_AsyncRequestStartTimeMs;                ///< time the request in flight was sent
+   uint32_t mu32_NextAsyncRequestId;                     ///< ID of next async request to be queued
+   bool mq_AsyncRequestSentBeforeSyncRequest;            ///< true: request in flight was sent before the last
+                                                         ///< synchronous data pool request
+   bool mq_AsyncDiscardActive;                           ///< true: discarding responses to a cancelled request
+   uint32_t mu32_AsyncDiscardStartTimeMs;                ///< time the cancelled request was given up
+   std::vector<uint8_t> mc_AsyncDiscardRequest;          ///< service ID and data identifier of cancelled request
+
    void m_LogServiceError(const stw::scl::C_SclString & orc_Service, const int32_t os32_ReturnCode,
                           const uint8_t ou8_NrCode) const;
 
@@ -103,6 +155,21 @@ private:
    int32_t m_HandleAsyncOsyReadDataPoolDataErrorEvent(const C_OscProtocolDriverOsyService & orc_ReceivedService);
    int32_t m_HandleAsyncOsyTunnelCanMessagesEvent(const C_OscProtocolDriverOsyService & orc_ReceivedService);
 
+   int32_t m_AddAsyncRequest(const C_OscProtocolDriverOsyService & orc_Request,
+                             const PR_OsyServiceFinished opr_OnFinished, void * const opv_Instance,
+                             uint32_t * const opu32_RequestId);
+   int32_t m_CycleAsyncRequests(void);
+   void m_StartNextAsyncRequest(void);
+   bool m_HandleAsyncRequestResponse(const C_OscProtocolDriverOsyService & orc_ReceivedService,
+                                     const bool oq_SyncRequestPending, const uint8_t ou8_SyncServiceId);
+   void m_CheckAsyncRequestTimeout(void);
+   void m_DiscardAsyncRequestInFlight(void);
+   void m_NoteSyncDataPoolRequestSent(void);
+   void m_FinishAsyncRequest(const int32_t os32_Result, const uint8_t ou8_NrCode,
+                             const std::vector<uint8_t> & orc_ReadData);
+   void m_ReportFinishedAsyncRequests(void);
+   void m_WaitForTransport(const uint32_t ou32_MaxWaitTimeMs);
+
    uint8_t m_GetDataPoolIndexClientToServer(const uint8_t ou8_ClientDataPoolIndex) const;
    uint8_t m_GetDataPoolIndexServerToClient(const uint8_t ou8_ServerDataPoolIndex) const;
 
@@ -188,6 +255,13 @@ private:
    static const uint8_t mhu8_OSY_MAX_NUM_DATA_POOL_LISTS = 128U;
    static const uint16_t mhu16_OSY_MAX_NUM_DATA_POOL_LIST_ELEMENTS = 2048U;
 
+   //maximum time to block on the transport protocol in one go; limits the latency if another thread
+   // handles the incoming communication of the same driver
+   static const uint32_t mhu32_TRANSPORT_WAIT_SLICE_MS = 5U;
+
+   //time to discard late responses to a timed out or cancelled asynchronous request before sending the next one
+   static const uint32_t mhu32_ASYNC_DISCARD_TIME_MS = 200U;
+
 protected:
    void m_LogErrorWithHeader(const stw::scl::C_SclString & orc_Activity, const stw::scl::C_SclString & orc_Information,
                              const char_t * const opcn_Function, const bool oq_AsError = true) const;
@@ -270,6 +344,12 @@ public:
    int32_t Disconnect(void);
    int32_t Cycle(void);
 
+   int32_t HandleAsyncRequests(const uint32_t ou32_MaxWaitTimeMs);
+   uint32_t GetNumPendingAsyncRequests(void);
+   void CancelAsyncRequests(void);
+   static int32_t h_HandleAsyncRequests(const std::vector<C_OscProtocolDriverOsy *> & orc_Drivers,
+                                        const uint32_t ou32_MaxWaitTimeMs);
+
    int32_t SetTransportProtocol(C_OscProtocolDriverOsyTpBase * const opc_TransportProtocol);
    int32_t SetNodeIdentifiers(const C_OscProtocolDriverOsyNode & orc_ClientId,
                               const C_OscProtocolDriverOsyNode & orc_ServerId);
@@ -354,6 +434,13 @@ public:
    int32_t OsyWriteDataPoolData(const uint8_t ou8_DataPoolIndex, const uint16_t ou16_ListIndex,
                                 const uint16_t ou16_ElementIndex, const std::vector<uint8_t> & orc_DataToWrite,
                                 uint8_t * const opu8_NrCode = NULL);
+   int32_t OsyReadDataPoolDataAsync(const uint8_t ou8_DataPoolIndex, const uint16_t ou16_ListIndex,
+                                    const uint16_t ou16_ElementIndex, const PR_OsyServiceFinished opr_OnFinished,
+                                    void * const opv_Instance, uint32_t * const opu32_RequestId = NULL);
+   int32_t OsyWriteDataPoolDataAsync(const uint8_t ou8_DataPoolIndex, const uint16_t ou16_ListIndex,
+                                     const uint16_t ou16_ElementIndex, const std::vector<uint8_t> & orc_DataToWrite,
+                                     const PR_OsyServiceFinished opr_OnFinished, void * const opv_Instance,
+                                     uint32_t * const opu32_RequestId = NULL);
    int32_t OsyWriteDataPoolEventDataRate(const uint8_t ou8_TransmissionRail, const uint16_t ou16_DataRate,
                                          uint8_t * const opu8_NrCode = NULL);
    int32_t OsyReadDataPoolDataCyclic(const uint8_t ou8_DataPoolIndex, const uint16_t ou16_ListIndex,
@@ -56,10 +56,16 @@ private:
       // timeout
       uint32_t u32_SendCfTimeout; ///< Tx:time at which sending all CFs should have been finished; set upon
       ///< reception of FC
+      uint8_t u8_BlockSize;          ///< Tx: BS as received in FC; Rx: BS as sent in FC; 0 = no limit
+      uint8_t u8_BlockCounter;       ///< number of CFs sent resp. received in current block
+      uint32_t u32_SeparationTimeUs; ///< Tx: minimum time between two CFs as received in FC
+      uint64_t u64_NextCfTimeUs;     ///< Tx: earliest time at which the next CF may be sent
+      uint8_t u8_DataLength;         ///< TX_DL resp. RX_DL: CAN frame data length of segmented transfer
+      bool q_CanFd;                  ///< true: transfer uses CAN FD frames
    };
 
    ///CAN-TP PCI types:
-   static const uint8_t mhu8_ISO15765_N_PCI_SF  = 0x00U; // single frame <=8bytes
+   static const uint8_t mhu8_ISO15765_N_PCI_SF  = 0x00U; // single frame <=8bytes (CAN FD: <=64bytes)
    static const uint8_t mhu8_ISO15765_N_PCI_FF  = 0x10U; // first frame <=4095bytes
    static const uint8_t mhu8_ISO15765_N_PCI_CF  = 0x20U; // consecutive frame
    static const uint8_t mhu8_ISO15765_N_PCI_FC  = 0x30U; // flow control
@@ -68,6 +74,11 @@ private:
    static const uint8_t mhu8_ISO15765_N_PCI_OMF = 0xE0U; // openSYDE multi frame
    // (no flow control, SN 0, SN 15->1)
 
+   ///CAN-TP flow status of flow control frames (lower nibble of PCI):
+   static const uint8_t mhu8_ISO15765_FS_CTS      = 0x00U; // continue to send
+   static const uint8_t mhu8_ISO15765_FS_WAIT     = 0x01U; // wait for next flow control
+   static const uint8_t mhu8_ISO15765_FS_OVERFLOW = 0x02U; // receiver buffer overflow; abort
+
    ///openSYDE single frame message types (lower nibble)
    static const uint8_t mhu8_OSY_OSF_TYPE_EVENT_DRIVEN_DP_SINGLE_FRAME = 0x01U; // openSYDE single frame
    // without response SID=0xFA
@@ -88,6 +99,13 @@ private:
 
    ///timeout when waiting for flow control; lower but more realistic than the 1s specified in 15765
    static const uint16_t mhu16_NBS_TIMEOUTS_MS = 100U;
+   ///time to wait before retrying to send a CF if the CAN driver's Tx buffer is full
+   static const uint32_t mhu32_CF_TX_RETRY_TIME_US = 1000U;
+   ///CAN frame data lengths (TX_DL/RX_DL)
+   static const uint8_t mhu8_CAN_DL_CLASSIC = 8U;
+   static const uint8_t mhu8_CAN_DL_FD_MAX = 64U;
+   ///value used to pad CAN FD frames to the next valid length (as recommended by ISO 15765-2)
+   static const uint8_t mhu8_ISO15765_PADDING = 0xCCU;
 
    stw::can::C_CanDispatcher * mpc_CanDispatcher; ///< CAN dispatcher to use for communication
    uint16_t mu16_DispatcherClientHandle;          ///< our handle for dispatcher interaction
@@ -95,6 +113,10 @@ private:
    C_ServiceState mc_TxService; ///< status of Tx service currently ongoing
    C_ServiceState mc_RxService; ///< status of Rx service currently ongoing
 
+   uint8_t mu8_RxBlockSize;      ///< BS to send in our flow control frames
+   uint8_t mu8_RxSeparationTime; ///< STmin to send in our flow control frames (ISO 15765-2 encoding)
+   uint8_t mu8_TxDataLength;     ///< configured TX_DL; > 8: use CAN FD frames if supported by dispatcher
+
    int32_t m_SetRxFilter(const bool oq_ForBroadcast);
    uint32_t m_GetTxIdentifier(void) const;
    uint32_t m_GetTxBroadcastIdentifier(void) const;
@@ -108,9 +130,17 @@ private:
    int32_t m_BroadcastSendDiagnosticSessionControl(const uint8_t ou8_Session) const;
 
    int32_t m_SendNextConsecutiveFrames(void);
+   int32_t m_SendFlowControl(void) const;
+
+   static uint32_t mh_GetSeparationTimeUs(const uint8_t ou8_SeparationTime);
+   uint8_t m_GetTxDataLength(void) const;
+   static uint8_t mh_GetCanFdFrameLength(const uint8_t ou8_NumBytes);
+   static void mh_PadCanFdFrame(stw::can::T_STWCAN_Msg_TX & orc_CanMessage);
 
    static void mh_ComposeSingleFrame(const C_OscProtocolDriverOsyService & orc_Service, const uint32_t ou32_Identifier,
                                      stw::can::T_STWCAN_Msg_TX & orc_CanMessage);
+   static void mh_ComposeCanFdSingleFrame(const C_OscProtocolDriverOsyService & orc_Service,
+                                          const uint32_t ou32_Identifier, stw::can::T_STWCAN_Msg_TX & orc_CanMessage);
 
    int32_t m_HandleBroadcastSetNodeIdBySerialNumberResponse(const uint8_t ou8_RoutineIdMsb,
                                                             const uint8_t ou8_RoutineIdLsb,
@@ -148,11 +178,14 @@ public:
    virtual ~C_OscProtocolDriverOsyTpCan(void);
 
    virtual int32_t Cycle(void);
+   virtual int32_t WaitForIncoming(const uint32_t ou32_TimeoutMs);
    virtual int32_t SetNodeIdentifiers(const C_OscProtocolDriverOsyNode & orc_ClientIdentifier,
                                       const C_OscProtocolDriverOsyNode & orc_ServerIdentifier);
    int32_t SetNodeIdentifiersForBroadcasts(const C_OscProtocolDriverOsyNode & orc_ClientIdentifier);
 
    int32_t SetDispatcher(stw::can::C_CanDispatcher * const opc_Dispatcher);
+   int32_t SetFlowControlParameters(const uint8_t ou8_BlockSize, const uint8_t ou8_SeparationTime);
+   int32_t SetTxDataLength(const uint8_t ou8_TxDataLength);
 
    //Tp-specific broadcast services:
    int32_t BroadcastReadSerialNumber(std::vector<C_BroadcastReadEcuSerialNumberResults> & orc_Responses,
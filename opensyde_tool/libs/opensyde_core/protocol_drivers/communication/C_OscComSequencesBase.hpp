@@ -65,6 +65,7 @@ protected:
    uint32_t mu32_ActiveBusIndex;
    std::vector<uint8_t> mc_ActiveNodes;
    std::vector<uint8_t> mc_TimeoutNodes; // Flag if a node had a timeout and is not reachable
+   C_OscSecurityPemDatabase * mpc_SecurityPemDb; // PEM database passed to Init() (optional; not owned)
 
    bool mq_OpenSydeDevicesActive;
    bool mq_StwFlashloaderDevicesActive;
@@ -39,6 +39,8 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 
 #include <string>
+#include <vector>
+#include <unordered_map>
 #include "stwtypes.hpp"
 #include "C_SclString.hpp"
 #include "C_SclStringList.hpp"
@@ -95,15 +97,32 @@ private:
    // Utility Methods
    static void mh_GetNextPair(const C_SclString & orc_CommandLine, C_SclString & orc_Key, C_SclString & orc_Value);
 
+   ///Case insensitive lookup table for the keys of one section
+   class C_KeyIndex
+   {
+   public:
+      C_KeyIndex(void);
+
+      bool q_Valid;                                  ///< false: needs to be rebuilt before use
+      std::unordered_map<std::string, int32_t> c_Map; ///< upper case key -> index of first key with this name
+   };
+
    // Returns the requested key (if found) from the requested Section. Returns NULL otherwise.
    C_SclIniKey * m_GetKey(const C_SclString & orc_Key, const C_SclString & orc_Section);
 
    //shortcut if we already have a valid section
-   C_SclIniKey * m_GetKey(const C_SclString & orc_Key, C_SclIniSection * const opc_Section);
+   C_SclIniKey * m_GetKey(const C_SclString & orc_Key, const int32_t os32_SectionIndex);
+
+   // Returns the index of the requested section (if found), -1 otherwise.
+   int32_t m_GetSectionIndex(const C_SclString & orc_Section);
 
    // Returns the requested section (if found), NULL otherwise.
    C_SclIniSection * m_GetSection(const C_SclString & orc_Section);
 
+   // Lookup table handling
+   void m_RebuildSectionIndex(void);
+   static std::string mh_GetIndexName(const C_SclString & orc_Name);
+
    // Our default access method. Returns a const reference to the raw C_SclString value.
    // Note that this returns keys specific to the given section only.
    const C_SclString & m_GetValue(const C_SclString & orc_Key, const C_SclString & orc_Section);
@@ -127,10 +146,12 @@ private:
    // exist. Section is created with no keys.
    C_SclIniSection * m_CreateSection(const C_SclString & orc_Section);
 
-   C_SclDynamicArray<C_SclIniSection> mc_Sections; ///< Our list of sections
+   C_SclDynamicArray<C_SclIniSection> mc_Sections; ///< Our list of sections (in file order)
    bool mq_Dirty;                                  ///< Tracks whether or not data has changed.
-   int32_t ms32_PreviousSectionIndex;              ///< for speeding up searching for a section
-   int32_t ms32_PreviousKeyIndex;                  ///< for speeding up searching for a key
+   ///upper case section name -> index of first section with this name
+   std::unordered_map<std::string, int32_t> mc_SectionIndex;
+   std::vector<C_KeyIndex> mc_KeyIndices; ///< key lookup tables; same order as mc_Sections
+   bool mq_SectionIndexValid;             ///< false: lookup tables need to be rebuilt before use
 
    // Methods
 
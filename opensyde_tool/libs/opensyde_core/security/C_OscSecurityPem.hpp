@@ -34,6 +34,8 @@ public:
    const std::string & GetMetaInfos(void) const;
 
    int32_t LoadFromFile(const std::string & orc_FileName, std::string & orc_ErrorMessage);
+   int32_t LoadFromContent(const std::vector<uint8_t> & orc_FileContent, std::string & orc_ErrorMessage);
+   static void h_ReadFileContent(const std::string & orc_FileName, std::vector<uint8_t> & orc_FileContent);
 
    static int32_t h_ExtractModulusAndExponentFromFile(const std::string & orc_FileName,
                                                       std::vector<uint8_t> & orc_Modulus,
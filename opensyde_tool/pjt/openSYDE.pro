@@ -27,7 +27,6 @@ include(../libs/opensyde_core/opensyde_core.pri)
 
 SOURCES += ../src/main.cpp \
     ../libs/opensyde_core/C_OscAesFile.cpp \
-    ../libs/opensyde_core/aes/AES.cpp \
     ../libs/opensyde_core/C_OscZipData.cpp \
     ../libs/opensyde_core/C_OscZipFile.cpp \
     ../src/com_import_export/C_CieConverter.cpp \
@@ -930,7 +929,6 @@ PRECOMPILED_HEADER = ../src/precompiled_headers/gui/precomp_headers.hpp
 
 HEADERS  += \
     ../libs/opensyde_core/C_OscAesFile.hpp \
-    ../libs/opensyde_core/aes/AES.h \
     ../libs/opensyde_core/C_OscZipData.hpp \
     ../libs/opensyde_core/C_OscZipFile.hpp \
     ../libs/opensyde_core/miniz/miniz.h \
@@ -2052,7 +2050,6 @@ INCLUDEPATH += ../src \
                ../src/gettext \
                ../src/util \
                ../src/precompiled_headers/gui \
-               ../libs/opensyde_core/aes \
                ../libs/opensyde_core/miniz \
                ../libs/gettext \
                ../libs/flexlexer \
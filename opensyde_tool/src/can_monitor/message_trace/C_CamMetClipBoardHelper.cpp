@@ -205,15 +205,15 @@ void C_CamMetClipBoardHelper::mh_AddMessage(QString & orc_Text, const C_OscComMe
    s32_LineLength = c_Line.length();
    if (oq_DisplayTimestampRelative == true)
    {
-      c_Line += orc_MessageData.c_TimeStampRelative.c_str();
+      c_Line += orc_MessageData.GetTimeStampRelative().c_str();
    }
    else if (oq_DisplayTimestampAbsoluteTimeOfDay == false)
    {
-      c_Line += orc_MessageData.c_TimeStampAbsoluteStart.c_str();
+      c_Line += orc_MessageData.GetTimeStampAbsoluteStart().c_str();
    }
    else
    {
-      c_Line += orc_MessageData.c_TimeStampAbsoluteTimeOfDay.c_str();
+      c_Line += orc_MessageData.GetTimeStampAbsoluteTimeOfDay().c_str();
    }
    c_Line = c_Line.leftJustified(s32_LineLength + os32_WidthTime, ' ');
 
@@ -221,11 +221,11 @@ void C_CamMetClipBoardHelper::mh_AddMessage(QString & orc_Text, const C_OscComMe
    s32_LineLength = c_Line.length();
    if (oq_DisplayAsHex == true)
    {
-      c_Line += orc_MessageData.c_CanIdHex.c_str();
+      c_Line += orc_MessageData.GetCanIdHex().c_str();
    }
    else
    {
-      c_Line += orc_MessageData.c_CanIdDec.c_str();
+      c_Line += orc_MessageData.GetCanIdDec().c_str();
    }
    c_Line = c_Line.leftJustified(s32_LineLength + os32_WidthId, ' ');
 
@@ -254,7 +254,7 @@ void C_CamMetClipBoardHelper::mh_AddMessage(QString & orc_Text, const C_OscComMe
 
    // DLC
    s32_LineLength = c_Line.length();
-   c_Line += orc_MessageData.c_CanDlc.c_str();
+   c_Line += orc_MessageData.GetCanDlc().c_str();
    if (orc_MessageData.q_CanDlcError)
    {
       c_Line += C_GtGetText::h_GetText(" (!= DB)");
@@ -275,7 +275,7 @@ void C_CamMetClipBoardHelper::mh_AddMessage(QString & orc_Text, const C_OscComMe
          }
          else
          {
-            c_Line += orc_MessageData.c_CanDataHex.c_str();
+            c_Line += orc_MessageData.GetCanDataHex().c_str();
          }
       }
       else
@@ -288,14 +288,14 @@ void C_CamMetClipBoardHelper::mh_AddMessage(QString & orc_Text, const C_OscComMe
          }
          else
          {
-            c_Line += orc_MessageData.c_CanDataDec.c_str();
+            c_Line += orc_MessageData.GetCanDataDec().c_str();
          }
       }
    }
    c_Line = c_Line.leftJustified(s32_LineLength + os32_WidthData, ' ');
 
    // Counter
-   c_Line += orc_MessageData.c_Counter.c_str() + static_cast<QString>("\n");
+   c_Line += orc_MessageData.GetCounter().c_str() + static_cast<QString>("\n");
 
    if (oq_IsExtended == true)
    {
@@ -341,7 +341,7 @@ void C_CamMetClipBoardHelper::mh_AddCanSignals(const int32_t os32_LineWidthIniti
 
             if (rc_Signal.q_DlcError == false)
             {
-               s32_MultiplexerValue = rc_Signal.c_RawValueDec.ToInt();
+               s32_MultiplexerValue = C_CamMetUtil::h_GetSignalMultiplexerValue(rc_Signal);
             }
 
             if (c_MultiplexerOrder[u32_Order] == s32_MultiplexerValue)
@@ -450,7 +450,7 @@ void C_CamMetClipBoardHelper::mh_AddCanSignal(const int32_t os32_LineWidthInitia
    {
       // Value
       s32_LineLength = c_LineSignal.length();
-      c_LineSignal += orc_Signal.c_Value.c_str() + static_cast<QString>(" ") + orc_Signal.c_Unit.c_str();
+      c_LineSignal += orc_Signal.GetValue().c_str() + static_cast<QString>(" ") + orc_Signal.c_Unit.c_str();
       c_LineSignal = c_LineSignal.leftJustified(s32_LineLength + 25, ' ');
       // Name could be longer
       c_LineSignal += "   ";
@@ -460,11 +460,11 @@ void C_CamMetClipBoardHelper::mh_AddCanSignal(const int32_t os32_LineWidthInitia
       s32_LineLength = c_LineSignal.length();
       if (oq_DisplayAsHex == true)
       {
-         c_LineSignal += orc_Signal.c_RawValueHex.c_str();
+         c_LineSignal += orc_Signal.GetRawValueHex().c_str();
       }
       else
       {
-         c_LineSignal += orc_Signal.c_RawValueDec.c_str();
+         c_LineSignal += orc_Signal.GetRawValueDec().c_str();
       }
 
       if (orc_Signal.c_Comment != "")
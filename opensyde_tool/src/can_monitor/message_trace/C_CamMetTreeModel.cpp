@@ -14,6 +14,7 @@
 
 #include <sstream>
 #include <iomanip>
+#include <iterator>
 
 #include <QBitArray>
 
@@ -771,32 +772,32 @@ QVariant C_CamMetTreeModel::data(const QModelIndex & orc_Index, const int32_t os
                case eTIME_STAMP:
                   if (this->mq_DisplayTimestampRelative == true)
                   {
-                     c_Retval = pc_CurMessage->c_TimeStampRelative.c_str();
+                     c_Retval = pc_CurMessage->GetTimeStampRelative().c_str();
                   }
                   else if (this->mq_DisplayTimestampAbsoluteTimeOfDay == false)
                   {
-                     c_Retval = pc_CurMessage->c_TimeStampAbsoluteStart.c_str();
+                     c_Retval = pc_CurMessage->GetTimeStampAbsoluteStart().c_str();
                   }
                   else
                   {
-                     c_Retval = pc_CurMessage->c_TimeStampAbsoluteTimeOfDay.c_str();
+                     c_Retval = pc_CurMessage->GetTimeStampAbsoluteTimeOfDay().c_str();
                   }
                   break;
                case eCAN_ID:
                   if (os32_Role == ms32_USER_ROLE_SORT)
                   {
                      //For number the display style is irrelevant
-                     c_Retval = pc_CurMessage->c_CanIdDec.ToInt();
+                     c_Retval = pc_CurMessage->GetCanIdDec().ToInt();
                   }
                   else
                   {
                      if (this->mq_DisplayAsHex == true)
                      {
-                        c_Retval = pc_CurMessage->c_CanIdHex.c_str();
+                        c_Retval = pc_CurMessage->GetCanIdHex().c_str();
                      }
                      else
                      {
-                        c_Retval = pc_CurMessage->c_CanIdDec.c_str();
+                        c_Retval = pc_CurMessage->GetCanIdDec().c_str();
                      }
                   }
                   break;
@@ -821,7 +822,7 @@ QVariant C_CamMetTreeModel::data(const QModelIndex & orc_Index, const int32_t os
                   c_Retval = c_Text;
                   break;
                case eCAN_DLC:
-                  c_Retval = pc_CurMessage->c_CanDlc.c_str();
+                  c_Retval = pc_CurMessage->GetCanDlc().c_str();
                   break;
                case eCAN_DATA:
                   if (pc_CurMessage->c_ProtocolTextDec == "")
@@ -832,11 +833,11 @@ QVariant C_CamMetTreeModel::data(const QModelIndex & orc_Index, const int32_t os
                      {
                         if (this->mq_DisplayAsHex == true)
                         {
-                           c_Retval = pc_CurMessage->c_CanDataHex.c_str();
+                           c_Retval = pc_CurMessage->GetCanDataHex().c_str();
                         }
                         else
                         {
-                           c_Retval = pc_CurMessage->c_CanDataDec.c_str();
+                           c_Retval = pc_CurMessage->GetCanDataDec().c_str();
                         }
                      }
                   }
@@ -855,11 +856,11 @@ QVariant C_CamMetTreeModel::data(const QModelIndex & orc_Index, const int32_t os
                case eCAN_COUNTER:
                   if (os32_Role == ms32_USER_ROLE_SORT)
                   {
-                     c_Retval = pc_CurMessage->c_Counter.ToInt64();
+                     c_Retval = pc_CurMessage->GetCounter().ToInt64();
                   }
                   else
                   {
-                     c_Retval = pc_CurMessage->c_Counter.c_str();
+                     c_Retval = pc_CurMessage->GetCounter().c_str();
                   }
                   break;
                default:
@@ -907,17 +908,17 @@ QVariant C_CamMetTreeModel::data(const QModelIndex & orc_Index, const int32_t os
                   c_List.reserve(5);
                   c_Value = rc_CurSignal.c_Name.c_str();
                   c_List.push_back(c_Value);
-                  c_Value = rc_CurSignal.c_Value.c_str();
+                  c_Value = rc_CurSignal.GetValue().c_str();
                   c_List.push_back(c_Value);
                   c_Value = rc_CurSignal.c_Unit.c_str();
                   c_List.push_back(c_Value);
                   if (this->mq_DisplayAsHex == true)
                   {
-                     c_Value = rc_CurSignal.c_RawValueHex.c_str();
+                     c_Value = rc_CurSignal.GetRawValueHex().c_str();
                   }
                   else
                   {
-                     c_Value = rc_CurSignal.c_RawValueDec.c_str();
+                     c_Value = rc_CurSignal.GetRawValueDec().c_str();
                   }
                   c_List.push_back(c_Value);
                   c_Comment = c_Comment.remove("\n");
@@ -955,7 +956,7 @@ QVariant C_CamMetTreeModel::data(const QModelIndex & orc_Index, const int32_t os
             {
                QBitArray c_Array;
                //Should always be DLC size
-               c_Array.resize(pc_CurMessage->c_CanDlc.ToInt());
+               c_Array.resize(pc_CurMessage->GetCanDlc().ToInt());
                //Check if there is an active selection
                if ((((this->ms32_SelectedParentRow >= 0) && (this->mc_SelectedChildBytes.size() > 0UL)) &&
                     (orc_Index.parent().isValid() == false)) && (orc_Index.row() == this->ms32_SelectedParentRow))
@@ -1066,7 +1067,7 @@ QVariant C_CamMetTreeModel::data(const QModelIndex & orc_Index, const int32_t os
                      {
                         if (rc_Signal.q_DlcError == false)
                         {
-                           s32_MuxValue = rc_Signal.c_RawValueDec.ToInt();
+                           s32_MuxValue = C_CamMetUtil::h_GetSignalMultiplexerValue(rc_Signal);
                         }
                      }
                      else
@@ -1077,7 +1078,7 @@ QVariant C_CamMetTreeModel::data(const QModelIndex & orc_Index, const int32_t os
                            pc_CurMessage->c_Signals[u32_MultiplexerSignalIndex];
                         if (rc_MultiplexerSignal.q_DlcError == false)
                         {
-                           s32_MuxValue = rc_MultiplexerSignal.c_RawValueDec.ToInt();
+                           s32_MuxValue = C_CamMetUtil::h_GetSignalMultiplexerValue(rc_MultiplexerSignal);
                         }
                      }
                      const std::map<int32_t,
@@ -1650,6 +1651,7 @@ std::vector<int32_t> C_CamMetTreeModel::m_AddRowsContinuousMode(const std::list<
       //Check if we need to append any items to reach the max storage size
       else if (this->mc_DataBase.size() < this->mu32_TraceBufferSizeUsed)
       {
+         uint32_t u32_NumEvictedItems = 0UL;
          //Simple model reset notification (if replaced: look at two segments: adding new and queuing mechanism)
          if (this->mq_UniqueMessageMode == false)
          {
@@ -1674,15 +1676,15 @@ std::vector<int32_t> C_CamMetTreeModel::m_AddRowsContinuousMode(const std::list<
             {
                //Shift item
                this->mc_DataBase[this->mu32_OldestItemIndex] = *c_ItData;
-               //Replace tree item
-               delete (this->mpc_RootItemContinuous->c_Children[0UL]);
-               this->mpc_RootItemContinuous->c_Children.erase(this->mpc_RootItemContinuous->c_Children.begin());
+               //Replace tree item (oldest ones are removed after the loop in one step)
                this->mpc_RootItemContinuous->AddChild(pc_Item);
+               ++u32_NumEvictedItems;
                //Iterate
                ++this->mu32_OldestItemIndex;
                this->mu32_OldestItemIndex %= this->mu32_TraceBufferSizeUsed;
             }
          }
+         this->mpc_RootItemContinuous->RemoveFirstChildren(u32_NumEvictedItems);
          //Simple model reset notification
          if (this->mq_UniqueMessageMode == false)
          {
@@ -1701,21 +1703,30 @@ std::vector<int32_t> C_CamMetTreeModel::m_AddRowsContinuousMode(const std::list<
             //this->beginRemoveRows(QModelIndex(), 0, orc_Data.size() - 1);
             //this->beginInsertRows(QModelIndex(), this->rowCount() - (orc_Data.size() - 1), this->rowCount());
          }
+         std::list<C_CamMetTreeLoggerData>::const_iterator c_ItData = orc_Data.begin();
+         uint32_t u32_NumNewItems = static_cast<uint32_t>(orc_Data.size());
+         //Messages which would be replaced again by the same call do not need any tree item
+         if (u32_NumNewItems > this->mu32_TraceBufferSizeUsed)
+         {
+            const uint32_t u32_NumSkipped = u32_NumNewItems - this->mu32_TraceBufferSizeUsed;
+            std::advance(c_ItData, u32_NumSkipped);
+            this->mu32_OldestItemIndex = (this->mu32_OldestItemIndex + u32_NumSkipped) %
+                                         this->mu32_TraceBufferSizeUsed;
+            u32_NumNewItems = this->mu32_TraceBufferSizeUsed;
+         }
          //Shift item in queue
-         for (std::list<C_CamMetTreeLoggerData>::const_iterator c_ItData = orc_Data.begin();
-              c_ItData != orc_Data.end(); ++c_ItData)
+         for (; c_ItData != orc_Data.end(); ++c_ItData)
          {
             C_TblTreSimpleItem * const pc_Item = new C_TblTreSimpleItem();
             this->mc_DataBase[this->mu32_OldestItemIndex] = *c_ItData;
-            //Replace tree item
+            //Replace tree item (oldest ones are removed after the loop in one step)
             m_UpdateTreeItemBasedOnMessage(pc_Item, *c_ItData, false, -1);
-            delete (this->mpc_RootItemContinuous->c_Children[0UL]);
-            this->mpc_RootItemContinuous->c_Children.erase(this->mpc_RootItemContinuous->c_Children.begin());
             this->mpc_RootItemContinuous->AddChild(pc_Item);
             //Iterate
             ++this->mu32_OldestItemIndex;
             this->mu32_OldestItemIndex %= this->mu32_TraceBufferSizeUsed;
          }
+         this->mpc_RootItemContinuous->RemoveFirstChildren(u32_NumNewItems);
          //End queue shift
          if (this->mq_UniqueMessageMode == false)
          {
@@ -1761,7 +1772,7 @@ void C_CamMetTreeModel::m_AddRowsUnique(const std::list<C_CamMetTreeLoggerData>
       {
          const QMap<stw::scl::C_SclString,
                     C_CamMetTreeLoggerData>::const_iterator c_ItMessage = this->mc_UniqueMessages.find(
-            c_ItData->c_CanIdDec);
+            c_ItData->GetCanIdDec());
          const int32_t s32_MuxValue = C_CamMetUtil::h_GetMultiplexerValue(c_ItData->c_Signals);
 
          //Check if there is a new row
@@ -1791,7 +1802,7 @@ void C_CamMetTreeModel::m_HandleNewUniqueMessageForExistingUniqueMessage(const C
 {
    int32_t s32_MessageCounter = 0L;
    bool q_UpdateDataTimeStamp;
-   C_CamMetTreeLoggerData & rc_Message = this->mc_UniqueMessages[orc_Message.c_CanIdDec];
+   C_CamMetTreeLoggerData & rc_Message = this->mc_UniqueMessages[orc_Message.GetCanIdDec()];
    const uint64_t u64_PreviousAbsoluteTimestampValue = rc_Message.u64_TimeStampAbsoluteStart;
    const uint64_t u64_NewAbsoluteTimestampValue = orc_Message.u64_TimeStampAbsoluteStart;
    uint64_t u64_RelativeTimestamp;
@@ -1821,7 +1832,7 @@ void C_CamMetTreeModel::m_HandleNewUniqueMessageForExistingUniqueMessage(const C
    {
       u64_RelativeTimestamp = 0U;
    }
-   rc_Message.c_TimeStampRelative = C_OscComMessageLoggerData::h_GetTimestampAsString(u64_RelativeTimestamp);
+   rc_Message.u64_TimeStampRelative = u64_RelativeTimestamp;
 
    //Search existing item index
    for (QMap<stw::scl::C_SclString,
@@ -1876,7 +1887,7 @@ void C_CamMetTreeModel::m_HandleNewUniqueMessage(const C_CamMetTreeLoggerData &
    QMap<C_SclString, C_CamMetTreeLoggerData>::iterator c_NewPos;
    //Handle begin!
    C_TblTreSimpleItem * const pc_NewItem = new C_TblTreSimpleItem();
-   const int32_t s32_EstimatedPosIndex = this->m_GetPosIndexForUniqueMessage(orc_Message.c_TimeStampAbsoluteStart);
+   const int32_t s32_EstimatedPosIndex = this->m_GetPosIndexForUniqueMessage(orc_Message.GetTimeStampAbsoluteStart());
    //Update tree with known index
    m_UpdateTreeItemBasedOnMessage(pc_NewItem, orc_Message, false, s32_EstimatedPosIndex);
    this->mpc_RootItemStatic->InsertChild(s32_EstimatedPosIndex, pc_NewItem);
@@ -1891,8 +1902,8 @@ void C_CamMetTreeModel::m_HandleNewUniqueMessage(const C_CamMetTreeLoggerData &
    }
 
    //Insert new item
-   this->mc_UniqueMessagesOrdering.insert(orc_Message.c_TimeStampAbsoluteStart, orc_Message.c_CanIdDec);
-   c_NewPos = this->mc_UniqueMessages.insert(orc_Message.c_CanIdDec, orc_Message);
+   this->mc_UniqueMessagesOrdering.insert(orc_Message.GetTimeStampAbsoluteStart(), orc_Message.GetCanIdDec());
+   c_NewPos = this->mc_UniqueMessages.insert(orc_Message.GetCanIdDec(), orc_Message);
    // New message, new data. Update the timestamp of the CAN message data and its bytes
    c_NewPos->c_GreyOutInformation.u32_DataChangedTimeStamp =
       static_cast<uint32_t>(c_NewPos->c_CanMsg.u64_TimeStamp / 1000ULL);
@@ -2442,13 +2453,13 @@ bool C_CamMetTreeModel::m_CheckMessageDataForSearch(const C_CamMetTreeLoggerData
 
       // Check message strings
       if ((orc_Data.c_Name.UpperCase().Pos(c_SearchString) > 0) ||
-          (orc_Data.c_CanDlc.Pos(c_SearchString) > 0) ||
+          (orc_Data.GetCanDlc().Pos(c_SearchString) > 0) ||
           ((this->mq_DisplayTimestampRelative == true) &&
-           (orc_Data.c_TimeStampRelative.Pos(c_SearchString) > 0)) ||
+           (orc_Data.GetTimeStampRelative().Pos(c_SearchString) > 0)) ||
           ((this->mq_DisplayTimestampAbsoluteTimeOfDay == true) &&
-           (orc_Data.c_TimeStampAbsoluteTimeOfDay.Pos(c_SearchString) > 0)) ||
+           (orc_Data.GetTimeStampAbsoluteTimeOfDay().Pos(c_SearchString) > 0)) ||
           ((this->mq_DisplayTimestampAbsoluteTimeOfDay == false) &&
-           (orc_Data.c_TimeStampAbsoluteStart.Pos(c_SearchString) > 0)))
+           (orc_Data.GetTimeStampAbsoluteStart().Pos(c_SearchString) > 0)))
       {
          q_Return = true;
       }
@@ -2457,8 +2468,8 @@ bool C_CamMetTreeModel::m_CheckMessageDataForSearch(const C_CamMetTreeLoggerData
          if (this->mq_DisplayAsHex == true)
          {
             // Check hex display specific strings
-            if ((orc_Data.c_CanIdHex.UpperCase().Pos(c_SearchString) > 0) ||
-                (orc_Data.c_CanDataHex.UpperCase().Pos(c_SearchString) > 0) ||
+            if ((orc_Data.GetCanIdHex().UpperCase().Pos(c_SearchString) > 0) ||
+                (orc_Data.GetCanDataHex().UpperCase().Pos(c_SearchString) > 0) ||
                 (orc_Data.c_ProtocolTextHex.UpperCase().Pos(c_SearchString) > 0))
             {
                q_Return = true;
@@ -2467,8 +2478,8 @@ bool C_CamMetTreeModel::m_CheckMessageDataForSearch(const C_CamMetTreeLoggerData
          else
          {
             // Check decimal display specific strings
-            if ((orc_Data.c_CanIdDec.Pos(c_SearchString) > 0) ||
-                (orc_Data.c_CanDataDec.Pos(c_SearchString) > 0) ||
+            if ((orc_Data.GetCanIdDec().Pos(c_SearchString) > 0) ||
+                (orc_Data.GetCanDataDec().Pos(c_SearchString) > 0) ||
                 (orc_Data.c_ProtocolTextDec.UpperCase().Pos(c_SearchString) > 0))
             {
                q_Return = true;
@@ -2506,7 +2517,7 @@ bool C_CamMetTreeModel::m_CheckSignalDataForSearch(const C_OscComMessageLoggerDa
       if ((orc_SignalData.c_Name.UpperCase().Pos(c_SearchString) > 0) ||
           (orc_SignalData.c_Comment.UpperCase().Pos(c_SearchString) > 0) ||
           (orc_SignalData.c_Unit.UpperCase().Pos(c_SearchString) > 0) ||
-          (orc_SignalData.c_Value.UpperCase().Pos(c_SearchString) > 0))
+          (orc_SignalData.GetValue().UpperCase().Pos(c_SearchString) > 0))
       {
          q_Return = true;
       }
@@ -2515,7 +2526,7 @@ bool C_CamMetTreeModel::m_CheckSignalDataForSearch(const C_OscComMessageLoggerDa
          if (this->mq_DisplayAsHex == true)
          {
             // Check hex display specific strings
-            if (orc_SignalData.c_RawValueHex.UpperCase().Pos(c_SearchString) > 0)
+            if (orc_SignalData.GetRawValueHex().UpperCase().Pos(c_SearchString) > 0)
             {
                q_Return = true;
             }
@@ -2523,7 +2534,7 @@ bool C_CamMetTreeModel::m_CheckSignalDataForSearch(const C_OscComMessageLoggerDa
          else
          {
             // Check decimal display specific strings
-            if (orc_SignalData.c_RawValueDec.Pos(c_SearchString) > 0)
+            if (orc_SignalData.GetRawValueDec().Pos(c_SearchString) > 0)
             {
                q_Return = true;
             }
@@ -2608,7 +2619,7 @@ void C_CamMetTreeModel::m_GetMultiplexedMsgSignalRow(const std::vector<C_OscComM
             }
             else if (rc_OscSginal.e_MultiplexerType == C_OscCanSignal::eMUX_MULTIPLEXER_SIGNAL)
             {
-               const int32_t s32_Value = rc_Signal.c_RawValueDec.ToIntDef(-1);
+               const int32_t s32_Value = C_CamMetUtil::h_GetSignalMultiplexerValue(rc_Signal);
 
                if (s32_Value >= 0)
                {
@@ -2631,7 +2642,8 @@ void C_CamMetTreeModel::m_GetMultiplexedMsgSignalRow(const std::vector<C_OscComM
       else
       {
          // Multiplexer signal
-         const int32_t s32_CheckValue = orc_Signals[ou32_SignalIndexToCheck].c_RawValueDec.ToIntDef(-1);
+         const int32_t s32_CheckValue = C_CamMetUtil::h_GetSignalMultiplexerValue(
+            orc_Signals[ou32_SignalIndexToCheck]);
 
          if (s32_CheckValue >= 0)
          {
@@ -2639,7 +2651,7 @@ void C_CamMetTreeModel::m_GetMultiplexedMsgSignalRow(const std::vector<C_OscComM
             {
                const C_OscComMessageLoggerDataSignal & rc_Signal = orc_Signals[u32_Counter];
                const C_OscCanSignal & rc_OscSginal = rc_Signal.c_OscSignal;
-               const int32_t s32_Value = rc_Signal.c_RawValueDec.ToIntDef(-1);
+               const int32_t s32_Value = C_CamMetUtil::h_GetSignalMultiplexerValue(rc_Signal);
 
                if (s32_Value >= 0)
                {
@@ -2701,7 +2713,7 @@ C_CamMetTreeLoggerDataGreyOutInformation C_CamMetTreeModel::mh_ExtractPreviousGr
       orc_MessagePrev.c_GreyOutInformation.c_MapMultiplexerValueToChangedTimeStamps;
 
    // Check if the CAN message data changed
-   if (orc_MessagePrev.c_CanDataHex != orc_MessageNew.c_CanDataHex)
+   if (orc_MessagePrev.GetCanDataHex() != orc_MessageNew.GetCanDataHex())
    {
       // Old message with changed data. Update the timestamp of the CAN message data
       orq_UpdateDataTimeStamp = true;
@@ -2940,7 +2952,7 @@ void C_CamMetTreeModel::mh_CopyMessageWhileKeepingUniqueSignals(C_CamMetTreeLogg
                // In case of a DLC error the signal will be replaced in any case and avoid getting the invalid value
                // as integer
                if ((rc_Sig.q_DlcError == true) ||
-                   (rc_Sig.c_RawValueDec.ToInt() == static_cast<uint16_t>(os32_MuxValue)))
+                   (rc_Sig.u64_RawValue == static_cast<uint16_t>(os32_MuxValue)))
                {
                   //Will be replaced
                }
@@ -3017,7 +3029,8 @@ uint32_t C_CamMetTreeModel::mh_TranslateTreeRowsToSignalIndex(
             //Multiplexer
             if ((rc_SignalData.c_OscSignal.e_MultiplexerType == C_OscCanSignal::eMUX_MULTIPLEXER_SIGNAL) &&
                 (rc_SignalData.q_DlcError == false) &&
-                (rc_SignalData.c_RawValueDec.ToInt() == c_Order[static_cast<uint32_t>(os32_SignalIndex)]))
+                (C_CamMetUtil::h_GetSignalMultiplexerValue(rc_SignalData) ==
+                 c_Order[static_cast<uint32_t>(os32_SignalIndex)]))
             {
                //Just use first multiplexer
                u32_Retval = u32_ItSigL1;
@@ -3111,7 +3124,7 @@ void C_CamMetTreeModel::mh_SortMultiplexedSignals(std::vector<C_OscComMessageLog
       const C_OscComMessageLoggerDataSignal & rc_MultiplexerSig = orc_Signals[u32_MultiplexerCounter];
       if (rc_MultiplexerSig.c_OscSignal.e_MultiplexerType == C_OscCanSignal::eMUX_MULTIPLEXER_SIGNAL)
       {
-         const int32_t s32_MultiplexerValue = rc_MultiplexerSig.c_RawValueDec.ToIntDef(-1);
+         const int32_t s32_MultiplexerValue = C_CamMetUtil::h_GetSignalMultiplexerValue(rc_MultiplexerSig);
 
          if (s32_MultiplexerValue >= 0)
          {
@@ -3171,8 +3184,8 @@ bool C_CamMetTreeModel::C_LoggerDataComparatorForMultiplexer::operator ()(
        (orc_Data2.c_OscSignal.e_MultiplexerType == C_OscCanSignal::eMUX_MULTIPLEXER_SIGNAL))
    {
       // Both are multiplexer signals, compare the values
-      const int32_t s32_Value1 = orc_Data1.c_RawValueDec.ToIntDef(-1);
-      const int32_t s32_Value2 = orc_Data2.c_RawValueDec.ToIntDef(-1);
+      const int32_t s32_Value1 = C_CamMetUtil::h_GetSignalMultiplexerValue(orc_Data1);
+      const int32_t s32_Value2 = C_CamMetUtil::h_GetSignalMultiplexerValue(orc_Data2);
 
       q_Return = s32_Value1 < s32_Value2;
    }
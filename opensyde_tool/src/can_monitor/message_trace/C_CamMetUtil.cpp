@@ -60,7 +60,7 @@ std::vector<int32_t> C_CamMetUtil::h_GetMultiplexerOrder(
       {
          if (rc_SignalData.q_DlcError == false)
          {
-            c_Order.push_back(rc_SignalData.c_RawValueDec.ToInt());
+            c_Order.push_back(C_CamMetUtil::h_GetSignalMultiplexerValue(rc_SignalData));
          }
          else
          {
@@ -94,13 +94,36 @@ int32_t C_CamMetUtil::h_GetMultiplexerValue(const std::vector<C_OscComMessageLog
       if ((rc_Sig.c_OscSignal.e_MultiplexerType == C_OscCanSignal::eMUX_MULTIPLEXER_SIGNAL) &&
           (rc_Sig.q_DlcError == false))
       {
-         s32_Value = rc_Sig.c_RawValueDec.ToInt();
+         s32_Value = C_CamMetUtil::h_GetSignalMultiplexerValue(rc_Sig);
          break;
       }
    }
    return s32_Value;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get multiplexer value of one multiplexer signal
+
+   Reads the stored raw value directly; multiplexer signals are unsigned integers of at most 16 bit.
+
+   \param[in]  orc_Signal    Multiplexer signal
+
+   \return
+   -1:   invalid (signal not inside the received data bytes)
+   else: multiplexer value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_CamMetUtil::h_GetSignalMultiplexerValue(const C_OscComMessageLoggerDataSignal & orc_Signal)
+{
+   int32_t s32_Value = -1;
+
+   if (orc_Signal.q_DlcError == false)
+   {
+      s32_Value = static_cast<int32_t>(orc_Signal.u64_RawValue);
+   }
+   return s32_Value;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Get row in message for multiplexer value
 
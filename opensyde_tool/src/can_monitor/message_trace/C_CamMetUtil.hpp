@@ -32,6 +32,8 @@ public:
       const std::vector<stw::opensyde_core::C_OscComMessageLoggerDataSignal> & orc_Signals);
    static int32_t h_GetMultiplexerValue(
       const std::vector<stw::opensyde_core::C_OscComMessageLoggerDataSignal> & orc_Signals);
+   static int32_t h_GetSignalMultiplexerValue(
+      const stw::opensyde_core::C_OscComMessageLoggerDataSignal & orc_Signal);
    static int32_t h_GetRowForMultiplexerValue(
       const std::vector<stw::opensyde_core::C_OscComMessageLoggerDataSignal> & orc_Signals,
       const int32_t os32_MultiplexerValue);
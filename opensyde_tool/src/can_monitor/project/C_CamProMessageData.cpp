@@ -90,7 +90,7 @@ stw::can::T_STWCAN_Msg_TX C_CamProMessageData::ToCanMessage(void) const
 {
    stw::can::T_STWCAN_Msg_TX c_Retval;
    c_Retval.u32_ID = this->u32_Id;
-   c_Retval.u8_Align = 0U;
+   c_Retval.u8_FDF = 0U;
    c_Retval.u8_XTD = C_CamProMessageData::h_GetBoolValue(this->q_IsExtended);
    c_Retval.u8_RTR = C_CamProMessageData::h_GetBoolValue(this->q_IsRtr);
    c_Retval.u8_DLC = static_cast<uint8_t>(this->u16_Dlc);
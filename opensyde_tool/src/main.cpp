@@ -95,5 +95,6 @@ int32_t main(int32_t os32_Argc, char_t * opacn_Argv[])
       //lint -e{1705} Working Qt example code
       s32_Result = c_Appl.exec();
    }
+   stw::opensyde_core::C_OscLoggingHandler::h_Exit();
    return s32_Result;
 }
@@ -673,7 +673,7 @@ int32_t C_PuiProject::m_Save(const bool oq_ForceSaveAll, const bool oq_UseDeprec
                {
                   s32_Retval =
                      C_PuiSdHandler::h_GetInstance()->SaveToFile(
-                        c_SystemDefintionPath.toStdString().c_str(), oq_UseDeprecatedFileFormatV2);
+                        c_SystemDefintionPath.toStdString().c_str(), oq_UseDeprecatedFileFormatV2, oq_ForceSaveAll);
                }
                else
                {
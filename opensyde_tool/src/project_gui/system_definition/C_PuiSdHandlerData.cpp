@@ -69,6 +69,9 @@ int32_t C_PuiSdHandlerData::LoadFromFile(const stw::scl::C_SclString & orc_Path,
 
    const uint16_t u16_TimerId = osc_write_log_performance_start();
 
+   //Node files might be of an older version, so write all of them on next save
+   this->mc_SavedNodeFilesPath = "";
+
    if (TglFileExists(orc_Path) == true)
    {
       C_OscXmlParser c_XmlParser;
@@ -218,8 +221,12 @@ int32_t C_PuiSdHandlerData::LoadFromFile(const stw::scl::C_SclString & orc_Path,
 
    Save UI data part of system definition to XML file.
 
+   Node files which did not change since the last save to the same path are not written again
+   (unless oq_ForceSaveAll is set).
+
    \param[in]  orc_Path                      Path to system definition file
    \param[in]  oq_UseDeprecatedFileFormatV2  Flag to enable saving using the deprecated V2 file format
+   \param[in]  oq_ForceSaveAll               Optional flag if all node files should be saved
 
    \return
    C_NO_ERR   data saved
@@ -227,7 +234,8 @@ int32_t C_PuiSdHandlerData::LoadFromFile(const stw::scl::C_SclString & orc_Path,
    C_RD_WR    could not write to file (e.g. missing write permissions; missing folder)
 */
 //----------------------------------------------------------------------------------------------------------------------
-int32_t C_PuiSdHandlerData::SaveToFile(const stw::scl::C_SclString & orc_Path, const bool oq_UseDeprecatedFileFormatV2)
+int32_t C_PuiSdHandlerData::SaveToFile(const stw::scl::C_SclString & orc_Path, const bool oq_UseDeprecatedFileFormatV2,
+                                       const bool oq_ForceSaveAll)
 {
    int32_t s32_Return = C_NO_ERR;
 
@@ -250,6 +258,8 @@ int32_t C_PuiSdHandlerData::SaveToFile(const stw::scl::C_SclString & orc_Path, c
       if (oq_UseDeprecatedFileFormatV2)
       {
          C_OscXmlParser c_XmlParser;
+         //Different files, so nothing known for next save
+         this->mc_SavedNodeFilesPath = "";
          C_OscSystemDefinitionFilerV2::h_SaveSystemDefinition(this->mc_CoreDefinition, c_XmlParser);
          //Reuse same XML parser for deprecated file format
          tgl_assert(c_XmlParser.SelectRoot() == "opensyde-system-definition");
@@ -283,7 +293,17 @@ int32_t C_PuiSdHandlerData::SaveToFile(const stw::scl::C_SclString & orc_Path, c
       }
       else
       {
-         s32_Return = C_OscSystemDefinitionFiler::h_SaveSystemDefinitionFile(this->mc_CoreDefinition, orc_Path);
+         std::vector<uint8_t> c_NodesToSave;
+         if (oq_ForceSaveAll)
+         {
+            c_NodesToSave.resize(this->mc_CoreDefinition.c_Nodes.size(), 1U);
+         }
+         else
+         {
+            this->m_GetNodesToSave(orc_Path, c_NodesToSave);
+         }
+         s32_Return = C_OscSystemDefinitionFiler::h_SaveSystemDefinitionFile(this->mc_CoreDefinition, orc_Path, NULL,
+                                                                             &c_NodesToSave);
          if (s32_Return == C_NO_ERR)
          {
             QString c_FilePath = C_PuiSdHandlerFiler::h_GetSystemDefinitionUiFilePath(orc_Path.c_str());
@@ -316,6 +336,15 @@ int32_t C_PuiSdHandlerData::SaveToFile(const stw::scl::C_SclString & orc_Path, c
          //Only update hash in non deprecated mode
          //calculate the hash value and save it for comparing
          this->mu32_CalculatedHashSystemDefinition = this->CalcHashSystemDefinition();
+         if (s32_Return == C_NO_ERR)
+         {
+            this->m_UpdateSavedNodeFiles(orc_Path);
+         }
+         else
+         {
+            //State of node files unknown
+            this->mc_SavedNodeFilesPath = "";
+         }
       }
    }
 
@@ -403,6 +432,7 @@ void C_PuiSdHandlerData::Clear(void)
 
    //Reset hash
    this->mu32_CalculatedHashSystemDefinition = this->CalcHashSystemDefinition();
+   this->mc_SavedNodeFilesPath = "";
    //signal "node change"
    Q_EMIT this->SigNodesChanged();
    //signal "bus change"
@@ -672,6 +702,66 @@ uint32_t C_PuiSdHandlerData::m_GetHashBus(const uint32_t ou32_BusIndex) const
    return u32_Retval;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get nodes which need to be written on save
+
+   A node file needs to be written if it was not saved to the same path before or the node changed since.
+   Node files reference other nodes by name, so any changed node name or number of nodes requires writing all.
+
+   \param[in]   orc_Path          Path to system definition file
+   \param[out]  orc_NodesToSave   Flag for each node: 1 = write node file, 0 = keep existing node file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_PuiSdHandlerData::m_GetNodesToSave(const stw::scl::C_SclString & orc_Path,
+                                          std::vector<uint8_t> & orc_NodesToSave) const
+{
+   const uint32_t u32_NumNodes = static_cast<uint32_t>(this->mc_CoreDefinition.c_Nodes.size());
+   bool q_SaveAll = ((this->mc_SavedNodeFilesPath.IsEmpty() == true) || (this->mc_SavedNodeFilesPath != orc_Path)) ||
+                    (this->mc_SavedNodeFileHashes.size() != u32_NumNodes);
+
+   for (uint32_t u32_ItNode = 0UL; (u32_ItNode < u32_NumNodes) && (q_SaveAll == false); ++u32_ItNode)
+   {
+      if (this->mc_CoreDefinition.c_Nodes[u32_ItNode].c_Properties.c_Name !=
+          this->mc_SavedNodeFileNodeNames[u32_ItNode])
+      {
+         q_SaveAll = true;
+      }
+   }
+
+   orc_NodesToSave.clear();
+   orc_NodesToSave.resize(u32_NumNodes, 1U);
+   if (q_SaveAll == false)
+   {
+      for (uint32_t u32_ItNode = 0UL; u32_ItNode < u32_NumNodes; ++u32_ItNode)
+      {
+         if (this->m_GetHashNode(u32_ItNode) == this->mc_SavedNodeFileHashes[u32_ItNode])
+         {
+            orc_NodesToSave[u32_ItNode] = 0U;
+         }
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Remember state of all node files after successful save
+
+   \param[in]  orc_Path   Path to system definition file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_PuiSdHandlerData::m_UpdateSavedNodeFiles(const stw::scl::C_SclString & orc_Path)
+{
+   const uint32_t u32_NumNodes = static_cast<uint32_t>(this->mc_CoreDefinition.c_Nodes.size());
+
+   this->mc_SavedNodeFilesPath = orc_Path;
+   this->mc_SavedNodeFileHashes.resize(u32_NumNodes);
+   this->mc_SavedNodeFileNodeNames.resize(u32_NumNodes);
+   for (uint32_t u32_ItNode = 0UL; u32_ItNode < u32_NumNodes; ++u32_ItNode)
+   {
+      this->mc_SavedNodeFileHashes[u32_ItNode] = this->m_GetHashNode(u32_ItNode);
+      this->mc_SavedNodeFileNodeNames[u32_ItNode] = this->mc_CoreDefinition.c_Nodes[u32_ItNode].c_Properties.c_Name;
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Handle data sync for node added
 
@@ -36,7 +36,8 @@ class C_PuiSdHandlerData :
 
 public:
    int32_t LoadFromFile(const stw::scl::C_SclString & orc_Path, uint16_t * const opu16_FileVersion);
-   int32_t SaveToFile(const stw::scl::C_SclString & orc_Path, const bool oq_UseDeprecatedFileFormatV2);
+   int32_t SaveToFile(const stw::scl::C_SclString & orc_Path, const bool oq_UseDeprecatedFileFormatV2,
+                      const bool oq_ForceSaveAll = false);
    bool HasHashChanged(void) const;
    uint32_t CalcHashSystemDefinition(void) const;
    void Clear(void);
@@ -60,12 +61,17 @@ protected:
 
    C_PuiSdSharedDatapools mc_SharedDatapools; ///< UI information for shared datapools
    uint32_t mu32_CalculatedHashSystemDefinition;
+   stw::scl::C_SclString mc_SavedNodeFilesPath;                  ///< Path of last save (empty: no node files known)
+   std::vector<uint32_t> mc_SavedNodeFileHashes;                 ///< Node hashes at last save
+   std::vector<stw::scl::C_SclString> mc_SavedNodeFileNodeNames; ///< Node names at last save
 
    C_PuiSdHandlerData(QObject * const opc_Parent = NULL);
 
    static int32_t mh_SortMessagesByName(stw::opensyde_core::C_OscNode & orc_OscNode, C_PuiSdNode & orc_UiNode);
    uint32_t m_GetHashNode(const uint32_t ou32_NodeIndex) const;
    uint32_t m_GetHashBus(const uint32_t ou32_BusIndex) const;
+   void m_GetNodesToSave(const stw::scl::C_SclString & orc_Path, std::vector<uint8_t> & orc_NodesToSave) const;
+   void m_UpdateSavedNodeFiles(const stw::scl::C_SclString & orc_Path);
    virtual void m_HandleSyncNodeAdded(const uint32_t ou32_Index);
    virtual void m_HandleSyncNodeAboutToBeDeleted(const uint32_t ou32_Index);
 
@@ -25,6 +25,7 @@
 #include "precomp_headers.hpp"
 
 #include <iostream>
+#include <map>
 
 #include "stwtypes.hpp"
 #include "stwerrors.hpp"
@@ -1257,44 +1258,7 @@ void C_PuiSdNodeCanMessageSyncManager::CheckErrorBus(bool * const opq_MessageNam
 
    if ((opq_MessageNameInvalid != NULL) || (opq_MessageIdInvalid != NULL))
    {
-      if (opq_MessageNameInvalid != NULL)
-      {
-         *opq_MessageNameInvalid = false;
-      }
-      if (opq_MessageIdInvalid != NULL)
-      {
-         *opq_MessageIdInvalid = false;
-      }
-      for (uint32_t u32_ItUniqueMessageId = 0; u32_ItUniqueMessageId < c_UniqueMessageIds.size();
-           ++u32_ItUniqueMessageId)
-      {
-         const C_OscCanMessage * const pc_Message =
-            C_PuiSdHandler::h_GetInstance()->GetCanMessage(c_UniqueMessageIds[u32_ItUniqueMessageId]);
-         if (pc_Message != NULL)
-         {
-            if (opq_MessageNameInvalid != NULL)
-            {
-               bool q_MessageNameValid;
-               this->CheckMessageNameBus(pc_Message->c_Name, q_MessageNameValid,
-                                         &c_UniqueMessageIds[u32_ItUniqueMessageId]);
-               if (q_MessageNameValid == false)
-               {
-                  *opq_MessageNameInvalid = true;
-               }
-            }
-            if (opq_MessageIdInvalid != NULL)
-            {
-               bool q_MessageIdValid;
-               this->CheckMessageIdBus(C_OscCanMessageUniqueId(pc_Message->u32_CanId,
-                                                               pc_Message->q_IsExtended), q_MessageIdValid,
-                                       &c_UniqueMessageIds[u32_ItUniqueMessageId]);
-               if (q_MessageIdValid == false)
-               {
-                  *opq_MessageIdInvalid = true;
-               }
-            }
-         }
-      }
+      this->m_CheckMessageNamesAndIdsBus(opq_MessageNameInvalid, opq_MessageIdInvalid);
    }
 
    if (opq_MessagesHaveNoTx != NULL)
@@ -2008,6 +1972,129 @@ uint32_t C_PuiSdNodeCanMessageSyncManager::m_GetMatchingMessageVectorIndex(
    return u32_Retval;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check names and CAN IDs of all unique messages
+
+   Same result as calling CheckMessageNameBus and CheckMessageIdBus for each unique message.
+   The name and CAN ID usage of all messages is counted once,
+   so each message is checked without scanning all other messages again.
+
+   \param[out]  opq_MessageNameInvalid  Optional flag if any message name is invalid or used more than once
+   \param[out]  opq_MessageIdInvalid    Optional flag if any message CAN ID is invalid or used more than once
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_PuiSdNodeCanMessageSyncManager::m_CheckMessageNamesAndIdsBus(bool * const opq_MessageNameInvalid,
+                                                                    bool * const opq_MessageIdInvalid) const
+{
+   const std::vector<C_OscCanMessageIdentificationIndices> c_AllMessageIds = this->m_GetAllUniqueMessages();
+   std::vector<const C_OscCanMessage *> c_AllMessages;
+   std::map<C_SclString, uint32_t> c_NameUsage;
+   std::map<C_OscCanMessageUniqueId, uint32_t> c_IdUsage;
+
+   if (opq_MessageNameInvalid != NULL)
+   {
+      *opq_MessageNameInvalid = false;
+   }
+   if (opq_MessageIdInvalid != NULL)
+   {
+      *opq_MessageIdInvalid = false;
+   }
+
+   //Count usage of names and CAN IDs (only active messages are relevant for CAN IDs)
+   c_AllMessages.reserve(c_AllMessageIds.size());
+   for (uint32_t u32_ItMessage = 0; u32_ItMessage < c_AllMessageIds.size(); ++u32_ItMessage)
+   {
+      const C_OscCanMessage * const pc_Message =
+         C_PuiSdHandler::h_GetInstance()->GetCanMessage(c_AllMessageIds[u32_ItMessage]);
+      c_AllMessages.push_back(pc_Message);
+      if (pc_Message != NULL)
+      {
+         ++c_NameUsage[pc_Message->c_Name];
+         if ((c_AllMessageIds[u32_ItMessage].e_ComProtocol != C_OscCanProtocol::eCAN_OPEN) ||
+             (pc_Message->q_CanOpenManagerMessageActive == true))
+         {
+            ++c_IdUsage[C_OscCanMessageUniqueId(pc_Message->u32_CanId, pc_Message->q_IsExtended)];
+         }
+      }
+   }
+
+   //Check each unique message; the index of the matching message vector is the one to skip (the message itself)
+   for (uint32_t u32_ItMatch = 0; u32_ItMatch < this->mc_MessageMatches.size(); ++u32_ItMatch)
+   {
+      if (this->mc_MessageMatches[u32_ItMatch].size() > 0)
+      {
+         const C_OscCanMessageIdentificationIndices & rc_MessageId = this->mc_MessageMatches[u32_ItMatch][0];
+         const C_OscCanMessage * const pc_Message = C_PuiSdHandler::h_GetInstance()->GetCanMessage(rc_MessageId);
+         const C_OscCanMessage * pc_SkipMessage = NULL;
+         bool q_SkipMessageActive = false;
+
+         if (u32_ItMatch < c_AllMessages.size())
+         {
+            pc_SkipMessage = c_AllMessages[u32_ItMatch];
+            if (pc_SkipMessage != NULL)
+            {
+               q_SkipMessageActive = (c_AllMessageIds[u32_ItMatch].e_ComProtocol != C_OscCanProtocol::eCAN_OPEN) ||
+                                     (pc_SkipMessage->q_CanOpenManagerMessageActive == true);
+            }
+         }
+
+         if ((pc_Message != NULL) && (opq_MessageNameInvalid != NULL) && (*opq_MessageNameInvalid == false))
+         {
+            if (C_OscUtils::h_CheckValidCeName(pc_Message->c_Name) == false)
+            {
+               *opq_MessageNameInvalid = true;
+            }
+            else
+            {
+               const std::map<C_SclString, uint32_t>::const_iterator c_ItName =
+                  c_NameUsage.find(pc_Message->c_Name);
+               uint32_t u32_Usage = (c_ItName != c_NameUsage.end()) ? c_ItName->second : 0U;
+               if ((pc_SkipMessage != NULL) && (pc_SkipMessage->c_Name == pc_Message->c_Name) && (u32_Usage > 0U))
+               {
+                  --u32_Usage;
+               }
+               if (u32_Usage > 0U)
+               {
+                  *opq_MessageNameInvalid = true;
+               }
+            }
+         }
+
+         if ((pc_Message != NULL) && (opq_MessageIdInvalid != NULL) && (*opq_MessageIdInvalid == false))
+         {
+            // Special case CANopen: Message can be deactivated. In this scenario, this message is not relevant
+            // for CAN-ID checks
+            if ((rc_MessageId.e_ComProtocol != C_OscCanProtocol::eCAN_OPEN) ||
+                (pc_Message->q_CanOpenManagerMessageActive == true))
+            {
+               const C_OscCanMessageUniqueId c_CanId(pc_Message->u32_CanId, pc_Message->q_IsExtended);
+               const std::map<C_OscCanMessageUniqueId, uint32_t>::const_iterator c_ItId = c_IdUsage.find(c_CanId);
+               uint32_t u32_Usage = (c_ItId != c_IdUsage.end()) ? c_ItId->second : 0U;
+
+               //Check ECoS
+               if ((rc_MessageId.e_ComProtocol == C_OscCanProtocol::eCAN_OPEN_SAFETY) &&
+                   ((pc_Message->u32_CanId < mu32_PROTOCOL_ECOS_MESSAGE_ID_MIN) ||
+                    (pc_Message->u32_CanId > mu32_PROTOCOL_ECOS_MESSAGE_ID_MAX) ||
+                    ((pc_Message->u32_CanId % 2) == 0)))
+               {
+                  *opq_MessageIdInvalid = true;
+               }
+
+               if ((q_SkipMessageActive == true) && (pc_SkipMessage->u32_CanId == pc_Message->u32_CanId) &&
+                   (pc_SkipMessage->q_IsExtended == pc_Message->q_IsExtended) && (u32_Usage > 0U))
+               {
+                  --u32_Usage;
+               }
+               if (u32_Usage > 0U)
+               {
+                  *opq_MessageIdInvalid = true;
+               }
+            }
+         }
+      }
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Add this message id to the internal matching message vector
 
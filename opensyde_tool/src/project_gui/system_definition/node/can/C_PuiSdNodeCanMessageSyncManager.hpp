@@ -146,6 +146,7 @@ public:
 private:
    uint32_t m_GetMatchingMessageVectorIndex(
       const stw::opensyde_core::C_OscCanMessageIdentificationIndices & orc_MessageId) const;
+   void m_CheckMessageNamesAndIdsBus(bool * const opq_MessageNameInvalid, bool * const opq_MessageIdInvalid) const;
    void m_RegisterIfNecessary(const stw::opensyde_core::C_OscCanMessageIdentificationIndices & orc_MessageId);
    static bool mh_CheckIfAlreadyExisting(const stw::opensyde_core::C_OscCanMessageIdentificationIndices & orc_MessageId,
                                          const std::vector<std::vector<stw::opensyde_core::C_OscCanMessageIdentificationIndices> > & orc_Input);
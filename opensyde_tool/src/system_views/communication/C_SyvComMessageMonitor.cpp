@@ -1087,16 +1087,10 @@ bool C_SyvComMessageMonitor::m_InterpretDbcFile(const C_CieConverter::C_CieCanMe
 
                if (rc_Signal.q_DlcError == false)
                {
-                  try
-                  {
-                     u16_MultiplexerValue = static_cast<uint16_t>(rc_Signal.c_RawValueDec.ToInt());
-                     rc_Signal.c_Name += " (Multiplexer)";
-                     q_MultiplexerFound = true;
-                     u32_MultiplexerIndex = u32_Counter;
-                  }
-                  catch (...)
-                  {
-                  }
+                  u16_MultiplexerValue = static_cast<uint16_t>(rc_Signal.u64_RawValue);
+                  rc_Signal.c_Name += " (Multiplexer)";
+                  q_MultiplexerFound = true;
+                  u32_MultiplexerIndex = u32_Counter;
                }
             }
             break;
@@ -1174,13 +1168,13 @@ void C_SyvComMessageMonitor::mh_InterpretDbcFileCanSignal(C_OscComMessageLoggerD
       // Check if a value description matches to the current value
       try
       {
-         const int64_t s64_Value = c_Signal.c_RawValueDec.ToInt64();
+         const int64_t s64_Value = c_Signal.GetRawValueDec().ToInt64();
          const std::map<int64_t, stw::scl::C_SclString>::const_iterator c_ItDescription =
             orc_DbcSignal.c_ValueDescription.find(s64_Value);
 
          if (c_ItDescription != orc_DbcSignal.c_ValueDescription.end())
          {
-            c_Signal.c_Value = c_ItDescription->second;
+            c_Signal.c_ValueDescription = c_ItDescription->second;
          }
       }
       catch (...)
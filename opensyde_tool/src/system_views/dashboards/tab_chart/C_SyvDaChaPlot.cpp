@@ -12,6 +12,9 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "precomp_headers.hpp"
 
+#include <cmath>
+#include <limits>
+
 #include "stwtypes.hpp"
 #include "constants.hpp"
 #include "TglUtils.hpp"
@@ -22,6 +25,11 @@
 using namespace stw::opensyde_gui;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32_t C_SyvDaChaPlotGraph::mhu32_BUCKET_SIZE = 16U;
+// History of one graph: 2^21 data points (about 5.8 hours at 10 ms, 32 MB);
+// pruned in blocks of 16^4 data points, so the lower min/max levels can be kept
+const uint32_t C_SyvDaChaPlotGraph::mhu32_MAXIMUM_NUM_POINTS = 0x200000U;
+const uint32_t C_SyvDaChaPlotGraph::mhu32_PRUNE_NUM_POINTS = 0x10000U;
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
@@ -485,6 +493,354 @@ C_SyvDaChaPlot::~C_SyvDaChaPlot(void)
 {
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+
+   The graph registers itself at the plot of the key axis (same as QCustomPlot::addGraph)
+
+   \param[in,out]  opc_KeyAxis      Key axis of graph
+   \param[in,out]  opc_ValueAxis    Value axis of graph
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvDaChaPlotGraph::C_SyvDaChaPlotGraph(QCPAxis * const opc_KeyAxis, QCPAxis * const opc_ValueAxis) :
+   QCPGraph(opc_KeyAxis, opc_ValueAxis),
+   mu32_NumSyncedPoints(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default destructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvDaChaPlotGraph::~C_SyvDaChaPlotGraph(void)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Append one data point
+
+   The history of the graph is bounded: if it exceeds mhu32_MAXIMUM_NUM_POINTS,
+   the oldest mhu32_PRUNE_NUM_POINTS data points are removed.
+
+   \param[in]  of64_Key    Key of data point (timestamp)
+   \param[in]  of64_Value  Value of data point
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaChaPlotGraph::AddData(const float64_t of64_Key, const float64_t of64_Value)
+{
+   this->addData(of64_Key, of64_Value);
+   if (static_cast<uint32_t>(this->dataCount()) > mhu32_MAXIMUM_NUM_POINTS)
+   {
+      this->m_PruneOldestPoints();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Overridden line data optimization
+
+   Same result as the adaptive sampling of QCPGraph, but the data points of one pixel interval are merged by
+   the precalculated min/max levels where possible instead of one by one.
+   So the effort of a replot depends on the pixel width of the plot and not on the number of visible data points.
+
+   \param[out]  opc_LineData  Optimized line data
+   \param[in]   orc_Begin     Begin of visible data
+   \param[in]   orc_End       End of visible data
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaChaPlotGraph::getOptimizedLineData(QVector<QCPGraphData> * const opc_LineData,
+                                               const QCPGraphDataContainer::const_iterator & orc_Begin,
+                                               const QCPGraphDataContainer::const_iterator & orc_End) const
+{
+   const QCPAxis * const pc_KeyAxis = this->keyAxis();
+   bool q_UseLevels = false;
+
+   if (((((opc_LineData != NULL) && (pc_KeyAxis != NULL)) && (this->valueAxis() != NULL)) &&
+        ((this->adaptiveSampling() == true) && (orc_Begin != orc_End))) &&
+       (pc_KeyAxis->scaleType() == QCPAxis::stLinear))
+   {
+      // Same criterion as QCPGraph: at least two data points per pixel on average
+      const float64_t f64_KeyPixelSpan = std::abs(pc_KeyAxis->coordToPixel(orc_Begin->key) -
+                                                  pc_KeyAxis->coordToPixel((orc_End - 1)->key));
+      const float64_t f64_MaxCount = (2.0 * f64_KeyPixelSpan) + 2.0;
+      if (f64_MaxCount < static_cast<float64_t>(std::numeric_limits<int32_t>::max()))
+      {
+         q_UseLevels = ((orc_End - orc_Begin) >= static_cast<int32_t>(f64_MaxCount));
+      }
+   }
+
+   if (q_UseLevels == false)
+   {
+      QCPGraph::getOptimizedLineData(opc_LineData, orc_Begin, orc_End);
+   }
+   else
+   {
+      const QCPGraphDataContainer::const_iterator c_ItFirst = this->data()->constBegin();
+      const uint32_t u32_End = static_cast<uint32_t>(orc_End - c_ItFirst);
+      const float64_t f64_ReversedFactor = static_cast<float64_t>(pc_KeyAxis->pixelOrientation());
+      // Round down for normal and up for reversed axis
+      const float64_t f64_ReversedRound = (f64_ReversedFactor < 0.0) ? 1.0 : 0.0;
+      // Interval of one pixel, constant for linear axis
+      const float64_t f64_FirstIntervalStartKey =
+         pc_KeyAxis->pixelToCoord(static_cast<float64_t>(static_cast<int32_t>(pc_KeyAxis->coordToPixel(orc_Begin->key)
+                                                                              + f64_ReversedRound)));
+      const float64_t f64_KeyEpsilon =
+         std::abs(f64_FirstIntervalStartKey -
+                  pc_KeyAxis->pixelToCoord(pc_KeyAxis->coordToPixel(f64_FirstIntervalStartKey) + f64_ReversedFactor));
+      float64_t f64_LastIntervalEndKey = f64_FirstIntervalStartKey;
+      uint32_t u32_Index = static_cast<uint32_t>(orc_Begin - c_ItFirst);
+
+      this->m_UpdateLevels();
+
+      while (u32_Index < u32_End)
+      {
+         const QCPGraphData & rc_FirstPoint = *(c_ItFirst + u32_Index);
+         const float64_t f64_IntervalStartKey =
+            pc_KeyAxis->pixelToCoord(static_cast<float64_t>(static_cast<int32_t>(pc_KeyAxis->coordToPixel(
+                                                                                    rc_FirstPoint.key) +
+                                                                                 f64_ReversedRound)));
+         float64_t f64_Min = rc_FirstPoint.value;
+         float64_t f64_Max = rc_FirstPoint.value;
+         const uint32_t u32_IntervalEnd = this->m_ConsumePixelInterval(u32_Index + 1U, u32_End,
+                                                                       f64_IntervalStartKey + f64_KeyEpsilon,
+                                                                       f64_Min, f64_Max);
+
+         if ((u32_IntervalEnd - u32_Index) >= 2U)
+         {
+            // Multiple data points in this pixel: consolidate them to a cluster
+            if (f64_LastIntervalEndKey < (f64_IntervalStartKey - f64_KeyEpsilon))
+            {
+               // Previous point is further away, so first point of this cluster must be at a real data point
+               opc_LineData->append(QCPGraphData(f64_IntervalStartKey + (f64_KeyEpsilon * 0.2), rc_FirstPoint.value));
+            }
+            opc_LineData->append(QCPGraphData(f64_IntervalStartKey + (f64_KeyEpsilon * 0.25), f64_Min));
+            opc_LineData->append(QCPGraphData(f64_IntervalStartKey + (f64_KeyEpsilon * 0.75), f64_Max));
+            if ((u32_IntervalEnd < u32_End) &&
+                ((c_ItFirst + u32_IntervalEnd)->key > (f64_IntervalStartKey + (f64_KeyEpsilon * 2.0))))
+            {
+               // Next point is further away, so last point of this cluster must be at a real data point
+               opc_LineData->append(QCPGraphData(f64_IntervalStartKey + (f64_KeyEpsilon * 0.8),
+                                                 (c_ItFirst + (u32_IntervalEnd - 1U))->value));
+            }
+         }
+         else
+         {
+            opc_LineData->append(rc_FirstPoint);
+         }
+         f64_LastIntervalEndKey = (c_ItFirst + (u32_IntervalEnd - 1U))->key;
+         u32_Index = u32_IntervalEnd;
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Update min/max levels to the current data
+
+   Only the data points appended since the last update are processed.
+   The levels are rebuilt completely if the data container got smaller than the processed part
+   or if its first or last processed data point differs from the cached one.
+   Other changes inside the processed part are not detected; data is expected to be appended only
+   (AddData, which removes old data by m_PruneOldestPoints and keeps the levels consistent itself).
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaChaPlotGraph::m_UpdateLevels(void) const
+{
+   const QCPGraphDataContainer::const_iterator c_ItFirst = this->data()->constBegin();
+   const uint32_t u32_NumPoints = static_cast<uint32_t>(this->dataCount());
+   uint32_t u32_ItLevel;
+
+   if (this->mu32_NumSyncedPoints > 0U)
+   {
+      bool q_Changed = true;
+
+      if (u32_NumPoints >= this->mu32_NumSyncedPoints)
+      {
+         const QCPGraphData & rc_First = *c_ItFirst;
+         const QCPGraphData & rc_Last = *(c_ItFirst + (this->mu32_NumSyncedPoints - 1U));
+         //lint -e{777} //exact comparison intended: detects changed data, no calculation involved
+         q_Changed = ((((rc_First.key != this->mc_SyncedFirstPoint.key) ||
+                        (rc_First.value != this->mc_SyncedFirstPoint.value)) ||
+                       (rc_Last.key != this->mc_SyncedLastPoint.key)) ||
+                      (rc_Last.value != this->mc_SyncedLastPoint.value));
+      }
+      if (q_Changed == true)
+      {
+         this->mc_Levels.clear();
+         this->mu32_NumSyncedPoints = 0U;
+      }
+   }
+
+   // First level from data points
+   if ((this->mc_Levels.empty() == true) && (u32_NumPoints >= mhu32_BUCKET_SIZE))
+   {
+      C_MinMaxLevel c_Level;
+      c_Level.u32_NumPointsPerBucket = mhu32_BUCKET_SIZE;
+      this->mc_Levels.push_back(c_Level);
+   }
+   for (; (this->mu32_NumSyncedPoints + mhu32_BUCKET_SIZE) <= u32_NumPoints;
+        this->mu32_NumSyncedPoints += mhu32_BUCKET_SIZE)
+   {
+      QCPGraphDataContainer::const_iterator c_ItPoint = c_ItFirst + this->mu32_NumSyncedPoints;
+      const QCPGraphDataContainer::const_iterator c_ItBucketEnd = c_ItPoint + mhu32_BUCKET_SIZE;
+      C_MinMaxBucket c_Bucket;
+      c_Bucket.f64_Min = c_ItPoint->value;
+      c_Bucket.f64_Max = c_ItPoint->value;
+      for (++c_ItPoint; c_ItPoint != c_ItBucketEnd; ++c_ItPoint)
+      {
+         c_Bucket.f64_Min = std::min(c_Bucket.f64_Min, c_ItPoint->value);
+         c_Bucket.f64_Max = std::max(c_Bucket.f64_Max, c_ItPoint->value);
+      }
+      c_Bucket.f64_LastKey = (c_ItBucketEnd - 1)->key;
+      this->mc_Levels[0].c_Buckets.push_back(c_Bucket);
+   }
+   if (this->mu32_NumSyncedPoints > 0U)
+   {
+      this->mc_SyncedFirstPoint = *c_ItFirst;
+      this->mc_SyncedLastPoint = *(c_ItFirst + (this->mu32_NumSyncedPoints - 1U));
+   }
+
+   // Higher levels from previous level
+   for (u32_ItLevel = 1U; u32_ItLevel <= this->mc_Levels.size(); ++u32_ItLevel)
+   {
+      const uint32_t u32_NumLowerBuckets = static_cast<uint32_t>(this->mc_Levels[u32_ItLevel - 1U].c_Buckets.size());
+      if ((u32_ItLevel == this->mc_Levels.size()) && (u32_NumLowerBuckets >= mhu32_BUCKET_SIZE))
+      {
+         C_MinMaxLevel c_Level;
+         c_Level.u32_NumPointsPerBucket = this->mc_Levels[u32_ItLevel - 1U].u32_NumPointsPerBucket * mhu32_BUCKET_SIZE;
+         this->mc_Levels.push_back(c_Level);
+      }
+      if (u32_ItLevel < this->mc_Levels.size())
+      {
+         const std::vector<C_MinMaxBucket> & rc_LowerBuckets = this->mc_Levels[u32_ItLevel - 1U].c_Buckets;
+         std::vector<C_MinMaxBucket> & rc_Buckets = this->mc_Levels[u32_ItLevel].c_Buckets;
+         while (((rc_Buckets.size() + 1U) * mhu32_BUCKET_SIZE) <= u32_NumLowerBuckets)
+         {
+            const uint32_t u32_LowerStart = static_cast<uint32_t>(rc_Buckets.size()) * mhu32_BUCKET_SIZE;
+            C_MinMaxBucket c_Bucket = rc_LowerBuckets[u32_LowerStart];
+            for (uint32_t u32_ItLower = u32_LowerStart + 1U; u32_ItLower < (u32_LowerStart + mhu32_BUCKET_SIZE);
+                 ++u32_ItLower)
+            {
+               c_Bucket.f64_Min = std::min(c_Bucket.f64_Min, rc_LowerBuckets[u32_ItLower].f64_Min);
+               c_Bucket.f64_Max = std::max(c_Bucket.f64_Max, rc_LowerBuckets[u32_ItLower].f64_Max);
+            }
+            c_Bucket.f64_LastKey = rc_LowerBuckets[(u32_LowerStart + mhu32_BUCKET_SIZE) - 1U].f64_LastKey;
+            rc_Buckets.push_back(c_Bucket);
+         }
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Remove the oldest data points
+
+   Removes the first mhu32_PRUNE_NUM_POINTS data points.
+   Buckets of levels which combine a divisor of this number are removed from the front too,
+   all higher levels are dropped and rebuilt from the remaining ones by the next m_UpdateLevels.
+   If the removed number differs (equal keys at the block border), all levels are rebuilt.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaChaPlotGraph::m_PruneOldestPoints(void)
+{
+   const uint32_t u32_NumPointsBefore = static_cast<uint32_t>(this->dataCount());
+   const QCPGraphDataContainer::const_iterator c_ItNewFirst = this->data()->constBegin() + mhu32_PRUNE_NUM_POINTS;
+
+   this->data()->removeBefore(c_ItNewFirst->key);
+
+   if (((u32_NumPointsBefore - static_cast<uint32_t>(this->dataCount())) == mhu32_PRUNE_NUM_POINTS) &&
+       (this->mu32_NumSyncedPoints >= mhu32_PRUNE_NUM_POINTS))
+   {
+      uint32_t u32_NumKeptLevels = 0U;
+
+      for (; u32_NumKeptLevels < this->mc_Levels.size(); ++u32_NumKeptLevels)
+      {
+         C_MinMaxLevel & rc_Level = this->mc_Levels[u32_NumKeptLevels];
+         if ((mhu32_PRUNE_NUM_POINTS % rc_Level.u32_NumPointsPerBucket) != 0U)
+         {
+            break;
+         }
+         rc_Level.c_Buckets.erase(rc_Level.c_Buckets.begin(),
+                                  rc_Level.c_Buckets.begin() +
+                                  (mhu32_PRUNE_NUM_POINTS / rc_Level.u32_NumPointsPerBucket));
+      }
+      this->mc_Levels.resize(u32_NumKeptLevels);
+      this->mu32_NumSyncedPoints -= mhu32_PRUNE_NUM_POINTS;
+      if (this->mu32_NumSyncedPoints > 0U)
+      {
+         this->mc_SyncedFirstPoint = *this->data()->constBegin();
+      }
+   }
+   else
+   {
+      this->mc_Levels.clear();
+      this->mu32_NumSyncedPoints = 0U;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Merge all data points of one pixel interval
+
+   Uses the biggest available min/max bucket which is completely part of the interval.
+
+   \param[in]      ou32_Index    Index of first data point to check
+   \param[in]      ou32_End      End index of visible data points
+   \param[in]      of64_KeyLimit All data points with a smaller key are part of the interval
+   \param[in,out]  orf64_Min     Minimum value of interval
+   \param[in,out]  orf64_Max     Maximum value of interval
+
+   \return
+   Index of first data point not part of the interval
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_SyvDaChaPlotGraph::m_ConsumePixelInterval(const uint32_t ou32_Index, const uint32_t ou32_End,
+                                                     const float64_t of64_KeyLimit, float64_t & orf64_Min,
+                                                     float64_t & orf64_Max) const
+{
+   const QCPGraphDataContainer::const_iterator c_ItFirst = this->data()->constBegin();
+   uint32_t u32_Retval = ou32_Index;
+   bool q_Continue = true;
+
+   while ((q_Continue == true) && (u32_Retval < ou32_End))
+   {
+      bool q_BucketUsed = false;
+
+      // Try the coarsest level first
+      for (uint32_t u32_ItLevel = static_cast<uint32_t>(this->mc_Levels.size());
+           (u32_ItLevel > 0U) && (q_BucketUsed == false); --u32_ItLevel)
+      {
+         const C_MinMaxLevel & rc_Level = this->mc_Levels[u32_ItLevel - 1U];
+         const uint32_t u32_BucketIndex = u32_Retval / rc_Level.u32_NumPointsPerBucket;
+         if ((((u32_Retval % rc_Level.u32_NumPointsPerBucket) == 0U) &&
+              (u32_BucketIndex < rc_Level.c_Buckets.size())) &&
+             ((u32_Retval + rc_Level.u32_NumPointsPerBucket) <= ou32_End))
+         {
+            const C_MinMaxBucket & rc_Bucket = rc_Level.c_Buckets[u32_BucketIndex];
+            if (rc_Bucket.f64_LastKey < of64_KeyLimit)
+            {
+               orf64_Min = std::min(orf64_Min, rc_Bucket.f64_Min);
+               orf64_Max = std::max(orf64_Max, rc_Bucket.f64_Max);
+               u32_Retval += rc_Level.u32_NumPointsPerBucket;
+               q_BucketUsed = true;
+            }
+         }
+      }
+
+      if (q_BucketUsed == false)
+      {
+         const QCPGraphData & rc_Point = *(c_ItFirst + u32_Retval);
+         if (rc_Point.key < of64_KeyLimit)
+         {
+            orf64_Min = std::min(orf64_Min, rc_Point.value);
+            orf64_Max = std::max(orf64_Max, rc_Point.value);
+            ++u32_Retval;
+         }
+         else
+         {
+            q_Continue = false;
+         }
+      }
+   }
+   return u32_Retval;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Registers a cursor item
 
@@ -10,6 +10,8 @@
 #define C_SYVDACHAPLOT_H
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+
 #include "qcustomplot.h"
 
 #include "stwtypes.hpp"
@@ -94,6 +96,59 @@ private:
    bool mq_ItemsNextToPlotVisible;
 };
 
+class C_SyvDaChaPlotGraph :
+   public QCPGraph
+{
+   Q_OBJECT
+
+public:
+   C_SyvDaChaPlotGraph(QCPAxis * const opc_KeyAxis, QCPAxis * const opc_ValueAxis);
+   ~C_SyvDaChaPlotGraph(void) override;
+
+   void AddData(const float64_t of64_Key, const float64_t of64_Value);
+
+protected:
+   //lint -e{8001,8011,9272}  //name of function and parameters dictated by base class
+   void getOptimizedLineData(QVector<QCPGraphData> * const opc_LineData,
+                             const QCPGraphDataContainer::const_iterator & orc_Begin,
+                             const QCPGraphDataContainer::const_iterator & orc_End) const override;
+
+private:
+   class C_MinMaxBucket
+   {
+   public:
+      float64_t f64_Min;
+      float64_t f64_Max;
+      float64_t f64_LastKey;
+   };
+
+   class C_MinMaxLevel
+   {
+   public:
+      uint32_t u32_NumPointsPerBucket;
+      std::vector<C_MinMaxBucket> c_Buckets;
+   };
+
+   static const uint32_t mhu32_BUCKET_SIZE;
+   static const uint32_t mhu32_MAXIMUM_NUM_POINTS;
+   static const uint32_t mhu32_PRUNE_NUM_POINTS;
+
+   // Caches of the data container, updated on drawing
+   mutable std::vector<C_MinMaxLevel> mc_Levels; ///< Level N combines mhu32_BUCKET_SIZE^(N+1) data points
+   mutable uint32_t mu32_NumSyncedPoints;        ///< Number of data points covered by the first level
+   mutable QCPGraphData mc_SyncedFirstPoint;
+   mutable QCPGraphData mc_SyncedLastPoint;
+
+   void m_UpdateLevels(void) const;
+   void m_PruneOldestPoints(void);
+   uint32_t m_ConsumePixelInterval(const uint32_t ou32_Index, const uint32_t ou32_End, const float64_t of64_KeyLimit,
+                                   float64_t & orf64_Min, float64_t & orf64_Max) const;
+
+   //Avoid call
+   C_SyvDaChaPlotGraph(const C_SyvDaChaPlotGraph &);
+   C_SyvDaChaPlotGraph & operator =(const C_SyvDaChaPlotGraph &) &;
+};
+
 class C_SyvDaChaPlot :
    public QCustomPlot
 {
@@ -16,6 +16,7 @@
 
 #include "C_SyvDaChaPlotHandlerWidget.hpp"
 #include "ui_C_SyvDaChaPlotHandlerWidget.h"
+#include "C_SyvDaChaPlot.hpp"
 
 #include "constants.hpp"
 #include "stwerrors.hpp"
@@ -1033,7 +1034,8 @@ void C_SyvDaChaPlotHandlerWidget::AddGraphContent(const C_PuiSvDbNodeDataPoolLis
          if ((rc_CurDataPoolElementId == orc_DataPoolElementId) &&
              (static_cast<int32_t>(u32_ConfigCounter) < this->mpc_Ui->pc_Plot->graphCount()))
          {
-            QCPGraph * const pc_Graph = this->mpc_Ui->pc_Plot->graph(u32_ConfigCounter);
+            C_SyvDaChaPlotGraph * const pc_Graph =
+               dynamic_cast<C_SyvDaChaPlotGraph *>(this->mpc_Ui->pc_Plot->graph(u32_ConfigCounter));
 
             if (pc_Graph != NULL)
             {
@@ -1100,7 +1102,7 @@ void C_SyvDaChaPlotHandlerWidget::AddGraphContent(const C_PuiSvDbNodeDataPoolLis
                      }
                   }
 
-                  pc_Graph->addData(f64_Timestamp, f64_Value);
+                  pc_Graph->AddData(f64_Timestamp, f64_Value);
                }
 
                // Show the last formatted value in the selector widget
@@ -1365,8 +1367,16 @@ void C_SyvDaChaPlotHandlerWidget::m_AddGraph(const uint32_t ou32_DataPoolElement
       }
    }
 
-   // Add the new graph
-   pc_Graph = this->mpc_Ui->pc_Plot->addGraph(NULL, pc_VerticalAxis);
+   if (pc_VerticalAxis == NULL)
+   {
+      // Same default as QCustomPlot::addGraph
+      pc_VerticalAxis = this->mpc_Ui->pc_Plot->yAxis;
+   }
+
+   // Add the new graph with min/max levels for fast drawing of long recordings, registers itself at the plot
+   pc_Graph = new C_SyvDaChaPlotGraph(this->mpc_Ui->pc_Plot->xAxis, pc_VerticalAxis);
+   // Same default name as QCustomPlot::addGraph
+   pc_Graph->setName(static_cast<QString>("Graph %1").arg(this->mpc_Ui->pc_Plot->graphCount()));
 
    // Add tracer
    if (this->me_SettingCursorMode != eSETTING_CM_NO_CURSOR)
@@ -148,6 +148,25 @@ void C_TblTreSimpleItem::ClearChildren(void)
    this->c_Children.clear();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Delete the first children in one step
+
+   Faster than removing the children one by one, as the remaining children are only moved once
+
+   \param[in]  ou32_Count  Number of children to delete (limited to the number of available children)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_TblTreSimpleItem::RemoveFirstChildren(const uint32_t ou32_Count)
+{
+   const uint32_t u32_Count = std::min(ou32_Count, static_cast<uint32_t>(this->c_Children.size()));
+
+   for (uint32_t u32_ItChild = 0UL; u32_ItChild < u32_Count; ++u32_ItChild)
+   {
+      delete (this->c_Children[u32_ItChild]);
+   }
+   this->c_Children.erase(this->c_Children.begin(), this->c_Children.begin() + u32_Count);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Get index of item in vector
 
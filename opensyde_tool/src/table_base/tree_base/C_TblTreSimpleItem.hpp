@@ -33,6 +33,7 @@ public:
    void SetChild(const uint32_t ou32_Index, C_TblTreSimpleItem * const opc_Child);
    int32_t GetIndexInParentNumber(void) const;
    void ClearChildren(void);
+   void RemoveFirstChildren(const uint32_t ou32_Count);
    static int32_t h_GetIndex(const std::vector<C_TblTreSimpleItem *> & orc_Vector,
                              const C_TblTreSimpleItem * const opc_Item);
 